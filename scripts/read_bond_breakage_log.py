@@ -0,0 +1,73 @@
+#! /usr/bin/env python
+
+# Read the binary bond breakage log(s) written by Peridigm and print the
+# records as comma-separated values (step, time, point id, neighbor id).
+#
+# Usage:  read_bond_breakage_log.py <base name> [output file]
+#
+# The base name is the "File Name" given in the "Bond Breakage Log" parameter
+# list.  Both serial (<base name>.bbl) and parallel (<base name>.bbl.N.i) logs
+# are supported; records from all processors are merged and sorted by step.
+
+import sys
+import os
+import glob
+import struct
+
+HEADER_FORMAT = "=4siii"
+RECORD_FORMAT = "=idii"
+
+def read_log(file_name):
+  records = []
+  header_size = struct.calcsize(HEADER_FORMAT)
+  record_size = struct.calcsize(RECORD_FORMAT)
+  f = open(file_name, "rb")
+  header = f.read(header_size)
+  if len(header) != header_size:
+    f.close()
+    raise IOError("Truncated header in " + file_name)
+  magic, version, pid, num_proc = struct.unpack(HEADER_FORMAT, header)
+  if magic != b"PDBB":
+    f.close()
+    raise IOError(file_name + " is not a Peridigm bond breakage log")
+  if version != 1:
+    f.close()
+    raise IOError("Unsupported bond breakage log version " + str(version) + " in " + file_name)
+  data = f.read()
+  f.close()
+  num_records = len(data) // record_size
+  for i in range(num_records):
+    records.append(struct.unpack_from(RECORD_FORMAT, data, i*record_size))
+  return records
+
+def log_files(base_name):
+  if os.path.isfile(base_name):
+    return [base_name]
+  files = glob.glob(base_name + ".bbl")
+  files.extend(glob.glob(base_name + ".bbl.*.*"))
+  return sorted(files)
+
+if __name__ == "__main__":
+
+  if len(sys.argv) < 2:
+    print("\nUsage:  read_bond_breakage_log.py <base name> [output file]\n")
+    sys.exit(1)
+
+  files = log_files(sys.argv[1])
+  if files == []:
+    print("\nError:  no bond breakage log found for " + sys.argv[1] + "\n")
+    sys.exit(1)
+
+  records = []
+  for file_name in files:
+    records.extend(read_log(file_name))
+  records.sort(key=lambda r: (r[0], r[2], r[3]))
+
+  out = sys.stdout
+  if len(sys.argv) > 2:
+    out = open(sys.argv[2], "w")
+  out.write("step,time,point_id,neighbor_id\n")
+  for r in records:
+    out.write("%d,%.16e,%d,%d\n" % r)
+  if out is not sys.stdout:
+    out.close()
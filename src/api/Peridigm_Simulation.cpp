@@ -0,0 +1,149 @@
+/*! \file Peridigm_Simulation.cpp */
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include <map>
+
+#include <Epetra_Vector.h>
+#include <Teuchos_Assert.hpp>
+
+#include "Peridigm_Simulation.hpp"
+#include "Peridigm_Enums.hpp"
+
+using namespace std;
+
+PeridigmNS::Simulation::Simulation(const MPI_Comm& comm,
+                                   Teuchos::RCP<Teuchos::ParameterList> params,
+                                   const std::string& solverName)
+  : time(0.0), explicitSteppingInitialized(false), numQuasiStaticLoadSteps(0)
+{
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(params.is_null(), "**** Error:  Simulation constructed with a null parameter list.\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(!params->isSublist(solverName),
+                              "**** Error:  Simulation could not find the solver parameter list \"" + solverName + "\".\n");
+
+  // Same defaults as PeridigmFactory
+  if(!params->isParameter("Verbose"))
+    params->set("Verbose", false);
+
+  peridigm = Teuchos::rcp(new PeridigmNS::Peridigm(comm, params, Teuchos::null));
+
+  solverParams = Teuchos::sublist(params, solverName);
+  if(solverParams->isParameter("Initial Time"))
+    time = solverParams->get<double>("Initial Time");
+
+  // Loads from the calling application are accumulated into this vector, which starts at zero
+  peridigm->setAppliedExternalForce(Teuchos::rcp(new Epetra_Vector(*peridigm->getThreeDimensionalMap())));
+}
+
+PeridigmNS::Simulation::~Simulation()
+{
+}
+
+double PeridigmNS::Simulation::advanceExplicit(int numSteps)
+{
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(!solverParams->isSublist("Verlet"), "**** Error:  Simulation::advanceExplicit() requires a Verlet solver.\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(numSteps < 0, "**** Error:  Simulation::advanceExplicit() called with a negative number of steps.\n");
+
+  if(!explicitSteppingInitialized){
+    peridigm->initializeExplicitStepping(solverParams);
+    explicitSteppingInitialized = true;
+  }
+
+  time = peridigm->stepExplicit(numSteps);
+  return time;
+}
+
+double PeridigmNS::Simulation::advanceQuasiStatic(double timeIncrement)
+{
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(!solverParams->isSublist("QuasiStatic"), "**** Error:  Simulation::advanceQuasiStatic() requires a QuasiStatic solver.\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(!(timeIncrement > 0.0), "**** Error:  Simulation::advanceQuasiStatic() requires a positive time increment.\n");
+
+  // Run the solver over a window containing a single load step; the initial configuration is written only once,
+  // and the load steps are numbered (for the bond breakage log and the predictor) as in a single run
+  Teuchos::RCP<Teuchos::ParameterList> loadStepParams = Teuchos::rcp(new Teuchos::ParameterList(*solverParams));
+  loadStepParams->set("Initial Time", time);
+  loadStepParams->set("Final Time", time + timeIncrement);
+  loadStepParams->sublist("QuasiStatic").set("Number of Load Steps", 1);
+  loadStepParams->set("Write Initial Configuration", numQuasiStaticLoadSteps == 0);
+  loadStepParams->set("Load Step Offset", numQuasiStaticLoadSteps);
+
+  peridigm->execute(loadStepParams);
+
+  numQuasiStaticLoadSteps += 1;
+  time += timeIncrement;
+  return time;
+}
+
+double PeridigmNS::Simulation::advanceQuasiStatic()
+{
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(!solverParams->isSublist("QuasiStatic"), "**** Error:  Simulation::advanceQuasiStatic() requires a QuasiStatic solver.\n");
+  Teuchos::ParameterList& quasiStaticParams = solverParams->sublist("QuasiStatic");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(!solverParams->isParameter("Final Time") || !quasiStaticParams.isParameter("Number of Load Steps"),
+                              "**** Error:  Simulation::advanceQuasiStatic() without a time increment requires \"Final Time\" and \"Number of Load Steps\".\n");
+
+  double timeInitial = 0.0;
+  if(solverParams->isParameter("Initial Time"))
+    timeInitial = solverParams->get<double>("Initial Time");
+  double timeFinal = solverParams->get<double>("Final Time");
+  int numLoadSteps = quasiStaticParams.get<int>("Number of Load Steps");
+
+  return advanceQuasiStatic((timeFinal - timeInitial)/numLoadSteps);
+}
+
+vector<int> PeridigmNS::Simulation::getNodeSetLocalIds(const string& nodeSetName)
+{
+  // getExodusNodeSets() returns one-based local ids of the owned points
+  // Node set names are stored in the form produced by tidy_string(), e.g., "Node Set 1" becomes "NODE_SET_1"
+  string name(nodeSetName);
+  tidy_string(name);
+  Teuchos::RCP< map< string, vector<int> > > nodeSets = peridigm->getExodusNodeSets();
+  map< string, vector<int> >::const_iterator it = nodeSets->find(name);
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(it == nodeSets->end(), "**** Error:  Simulation::getNodeSetLocalIds(), node set not found: " + nodeSetName + "\n");
+
+  vector<int> localIds(it->second.size());
+  for(unsigned int i=0 ; i<localIds.size() ; ++i)
+    localIds[i] = it->second[i] - 1;
+  return localIds;
+}
@@ -0,0 +1,151 @@
+/*! \file Peridigm_Simulation.hpp */
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+#ifndef PERIDIGM_SIMULATION_HPP
+#define PERIDIGM_SIMULATION_HPP
+
+#include <string>
+#include <vector>
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_RCP.hpp>
+
+#include "Peridigm.hpp"
+
+namespace PeridigmNS {
+
+  /*!
+   * \brief In-process driver for embedding Peridigm in another application.
+   *
+   * Builds a Peridigm object from a parameter list with the structure of a Peridigm input deck and advances
+   * the solution a few steps at a time, so that a coupled code can exchange data with Peridigm in memory
+   * between calls.  The vectors returned by the accessors are views of Peridigm's owned mothership vectors,
+   * not copies; they are indexed by the local ids of the owned points, with three entries per point for
+   * vector quantities.
+   */
+  class Simulation {
+  public:
+
+    //! Constructor; solverName selects the solver parameter list that is advanced.
+    Simulation(const MPI_Comm& comm,
+               Teuchos::RCP<Teuchos::ParameterList> params,
+               const std::string& solverName = "Solver");
+
+    //! Destructor; does not write buffered output, call flushOutput() first.
+    ~Simulation();
+
+    //! Advance the Verlet solver by numSteps time steps; returns the current time.
+    double advanceExplicit(int numSteps = 1);
+
+    //! Advance the QuasiStatic solver by a single load step of the given size; returns the current time.
+    double advanceQuasiStatic(double timeIncrement);
+
+    //! Advance the QuasiStatic solver by a single load step of size (Final Time - Initial Time)/Number of Load Steps.
+    double advanceQuasiStatic();
+
+    //! Current time.
+    double getTime() const { return time; }
+
+    //! Time step of the Verlet solver (zero before the first call to advanceExplicit()).
+    double getTimeStep() { return peridigm->getExplicitTimeStep(); }
+
+    //! Number of owned points on this processor.
+    int getNumOwnedPoints() { return peridigm->getOneDimensionalMap()->NumMyElements(); }
+
+    //! @name Views of the owned mothership vectors
+    //@{
+    Teuchos::RCP<Epetra_Vector> getModelCoordinates() { return peridigm->getX(); }
+    Teuchos::RCP<Epetra_Vector> getCurrentCoordinates() { return peridigm->getY(); }
+    Teuchos::RCP<Epetra_Vector> getDisplacement() { return peridigm->getU(); }
+    Teuchos::RCP<Epetra_Vector> getVelocity() { return peridigm->getV(); }
+    Teuchos::RCP<Epetra_Vector> getAcceleration() { return peridigm->getA(); }
+    Teuchos::RCP<Epetra_Vector> getForce() { return peridigm->getForce(); }
+    Teuchos::RCP<Epetra_Vector> getExternalForce() { return peridigm->getExternalForce(); }
+    Teuchos::RCP<Epetra_Vector> getVolume() { return peridigm->getVolume(); }
+    //@}
+
+    /** \brief Force density applied by the calling application.
+     *
+     *  The external force is rebuilt from the body force boundary conditions at every step, so loads from a
+     *  coupled code are written here instead; they are added to the external force each time it is rebuilt.
+     */
+    Teuchos::RCP<Epetra_Vector> getAppliedExternalForce() { return peridigm->getAppliedExternalForce(); }
+
+    //! Write buffered output to disk; collective, so it must be called on all processors.
+    void flushOutput() { peridigm->flushOutput(); }
+
+    //! Local ids of the owned points in the given node set.
+    std::vector<int> getNodeSetLocalIds(const std::string& nodeSetName);
+
+    //! Access to the underlying Peridigm object.
+    Teuchos::RCP<PeridigmNS::Peridigm> getPeridigm() { return peridigm; }
+
+  private:
+
+    //! Private copy constructor to prohibit copying.
+    Simulation(const Simulation&);
+
+    //! Private assignment operator to prohibit copying.
+    Simulation& operator=(const Simulation&);
+
+    //! The Peridigm object being advanced
+    Teuchos::RCP<PeridigmNS::Peridigm> peridigm;
+
+    //! Solver parameters from the input deck
+    Teuchos::RCP<Teuchos::ParameterList> solverParams;
+
+    //! Current time
+    double time;
+
+    //! Flag indicating that the explicit stepping has been initialized
+    bool explicitSteppingInitialized;
+
+    //! Number of quasi-static load steps taken
+    int numQuasiStaticLoadSteps;
+  };
+
+}
+
+#endif // PERIDIGM_SIMULATION_HPP
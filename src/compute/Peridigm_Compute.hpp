@@ -50,12 +50,82 @@
 
 #include <Epetra_Comm.h>
 #include <Teuchos_RCP.hpp>
+#include <Teuchos_Assert.hpp>
+#include <vector>
 
 #include "Peridigm_Block.hpp"
 #include "Peridigm_ServiceManager.hpp"
 
 namespace PeridigmNS {
 
+  /** \brief Buffer for the global reductions performed by compute classes.
+   *
+   *  Compute classes append their local contributions with add(), the buffer is reduced across
+   *  processors with a single collective call per reduction operation, and the compute classes
+   *  then read back the reduced values with next(), in the same order in which they were added.
+   */
+  class ComputeReduction{
+
+  public:
+
+    enum Operation { SUM = 0, MINIMUM = 1, MAXIMUM = 2 };
+
+    //! Constructor.
+    ComputeReduction() { clear(); }
+
+    //! Append local values to be reduced with the given operation.
+    void add(Operation op, const double* values, int length) {
+      localValues[op].insert(localValues[op].end(), values, values + length);
+    }
+
+    //! Append a single local value to be reduced with the given operation.
+    void add(Operation op, double value) { add(op, &value, 1); }
+
+    //! Reduce the buffered values across processors; the number of values added must match on all processors.
+    void reduce(const Epetra_Comm& comm) {
+      for(int op=0 ; op<3 ; ++op){
+        globalValues[op].resize(localValues[op].size());
+        cursor[op] = 0;
+        if(localValues[op].empty())
+          continue;
+        int length = static_cast<int>(localValues[op].size());
+        if(op == SUM)
+          comm.SumAll(&localValues[op][0], &globalValues[op][0], length);
+        else if(op == MINIMUM)
+          comm.MinAll(&localValues[op][0], &globalValues[op][0], length);
+        else if(op == MAXIMUM)
+          comm.MaxAll(&localValues[op][0], &globalValues[op][0], length);
+      }
+    }
+
+    //! Returns the next length reduced values for the given operation.
+    const double* next(Operation op, int length) {
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(cursor[op] + length > globalValues[op].size(),
+                                  "**** Error:  ComputeReduction::next() requested more values than were reduced.\n");
+      const double* values = &globalValues[op][cursor[op]];
+      cursor[op] += length;
+      return values;
+    }
+
+    //! Returns the next reduced value for the given operation.
+    double next(Operation op) { return *next(op, 1); }
+
+    //! Discard all values.
+    void clear() {
+      for(int op=0 ; op<3 ; ++op){
+        localValues[op].clear();
+        globalValues[op].clear();
+        cursor[op] = 0;
+      }
+    }
+
+  private:
+
+    std::vector<double> localValues[3];
+    std::vector<double> globalValues[3];
+    std::size_t cursor[3];
+  };
+
   //! Base class defining the Peridigm compute class interface.
   class Compute{
 
@@ -79,15 +149,49 @@ namespace PeridigmNS {
     //! Initialize the compute class
     virtual void initialize( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks  ) {};
 
+    //! Update any locally-indexed data held by the compute class after the blocks have been rebalanced
+    virtual void rebalance( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks  ) {};
+
     //! Perform computation
     virtual int compute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks  ) const = 0;
 
     //! Pre compute initialization
     virtual int pre_compute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks  ) const {return 0;}
 
+    /** \brief First phase of a computation with deferred global reductions.
+     *
+     *  Compute classes that reduce data across processors may override computeLocal() and finishCompute()
+     *  so that the ComputeManager can combine their reductions into a single collective call per operation.
+     *  The default implementation performs the complete computation.
+     */
+    virtual int computeLocal( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction ) const { return compute(blocks); }
+
+    //! Second phase of a computation with deferred global reductions, consumes the reduced values appended by computeLocal().
+    virtual int finishCompute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction ) const { return 0; }
+
+    //! Inputs on which the results of a compute class depend, ordered from least to most frequently changing.
+    enum Dependency { REFERENCE_CONFIGURATION=0, BOND_CONNECTIVITY=1, EVERY_STEP=2 };
+
+    /** \brief Returns the inputs on which the results of the compute class depend.
+     *
+     *  The ComputeManager only re-runs compute classes that depend on the reference configuration or on the
+     *  bond connectivity after these inputs have changed, for example after a rebalance.  The default is to
+     *  recompute on every call.
+     */
+    virtual Dependency getDependency() const { return EVERY_STEP; }
+
 
   protected:
 
+    //! Perform both phases of the computation with a private reduction buffer.
+    int computeAndReduce( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks ) const {
+      ComputeReduction reduction;
+      int retval = computeLocal(blocks, reduction);
+      reduction.reduce(*epetraComm);
+      int finishRetval = finishCompute(blocks, reduction);
+      return retval != 0 ? retval : finishRetval;
+    }
+
     //! Copy constructor.
     Compute( const Compute& C );
 
@@ -80,11 +80,12 @@ int PeridigmNS::Compute_Angular_Momentum::compute( Teuchos::RCP< std::vector<Per
 }        
 
 //! Fill the angular momentum vector
-int PeridigmNS::Compute_Angular_Momentum::computeAngularMomentum( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, bool storeLocal  ) const
+int PeridigmNS::Compute_Angular_Momentum::computeAngularMomentum( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, bool storeLocal, ComputeReduction* reduction  ) const
 {
   int retval;
 
-  double globalAM = 0.0;
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(!storeLocal && reduction == NULL, "**** Error:  Compute_Angular_Momentum requires a reduction buffer to compute the global angular momentum.\n");
+
   Teuchos::RCP<Epetra_Vector> velocity,  arm, volume, angular_momentum;
   std::vector<Block>::iterator blockIt;
   for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++)
@@ -144,21 +145,31 @@ int PeridigmNS::Compute_Angular_Momentum::computeAngularMomentum( Teuchos::RCP<
     
     if (!storeLocal)
     {
-      // Update info across processors
-      std::vector<double> localAngularMomentum(3), globalAngularMomentum(3);
+      // Defer the update across processors to the reduction buffer
+      double localAngularMomentum[3];
       localAngularMomentum[0] = angular_momentum_x;
       localAngularMomentum[1] = angular_momentum_y;
       localAngularMomentum[2] = angular_momentum_z;
 	
-      epetraComm->SumAll(&localAngularMomentum[0], &globalAngularMomentum[0], 3);
-		
-      globalAM += sqrt(globalAngularMomentum[0]*globalAngularMomentum[0] + globalAngularMomentum[1]*globalAngularMomentum[1] + globalAngularMomentum[2]*globalAngularMomentum[2]);
+      reduction->add(ComputeReduction::SUM, localAngularMomentum, 3);
     }
   }
 
+  return(0);
+
+}
+
+int PeridigmNS::Compute_Angular_Momentum::finishAngularMomentum( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction  ) const
+{
+  double globalAM = 0.0;
+  for(unsigned int i=0 ; i<blocks->size() ; ++i)
+  {
+    const double* globalAngularMomentum = reduction.next(ComputeReduction::SUM, 3);
+    globalAM += sqrt(globalAngularMomentum[0]*globalAngularMomentum[0] + globalAngularMomentum[1]*globalAngularMomentum[1] + globalAngularMomentum[2]*globalAngularMomentum[2]);
+  }
+
   // Store global angular momentum
-  if (!storeLocal)  
-    (*(blocks->begin()->getData(m_globalAngularMomentumFieldId, PeridigmField::STEP_NONE)))[0] = globalAM;
+  (*(blocks->begin()->getData(m_globalAngularMomentumFieldId, PeridigmField::STEP_NONE)))[0] = globalAM;
 
   return(0);
 
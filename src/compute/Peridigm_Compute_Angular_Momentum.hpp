@@ -77,8 +77,11 @@ namespace PeridigmNS {
     //! Perform computation
     virtual int compute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks  ) const;
 
-    //! Compute the angular momentum and optionally store the nodal values. 
-    int computeAngularMomentum( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, bool storeLocal ) const ;
+    //! Compute the angular momentum and optionally store the nodal values; if storeLocal is false, the local block totals are appended to the reduction buffer. 
+    int computeAngularMomentum( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, bool storeLocal, ComputeReduction* reduction = NULL ) const ;
+
+    //! Store the global angular momentum from the reduced block totals.
+    int finishAngularMomentum( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction ) const ;
   
   private:
 
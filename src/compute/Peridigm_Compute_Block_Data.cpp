@@ -119,12 +119,16 @@ void PeridigmNS::Compute_Block_Data::initialize( Teuchos::RCP< std::vector<Perid
 }
 
 int PeridigmNS::Compute_Block_Data::compute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks ) const {
+  return computeAndReduce(blocks);
+}
+
+int PeridigmNS::Compute_Block_Data::computeLocal( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction ) const {
 
   PeridigmField::Step step = PeridigmField::STEP_NONE;
   if(m_variableIsStated)
     step = PeridigmField::STEP_NP1;
   
-  std::vector<double> localData(3), globalData(3);
+  std::vector<double> localData(3);
 
   if(m_calculationType == MINIMUM){
     for(int i=0 ; i<3 ; ++i)
@@ -191,27 +195,27 @@ int PeridigmNS::Compute_Block_Data::compute( Teuchos::RCP< std::vector<PeridigmN
     }
   }
 
+  // Defer the update across processors to the reduction buffer
+  reduction.add(reductionOperation(), &localData[0], m_variableLength);
+
+  return 0;
+}
+
+int PeridigmNS::Compute_Block_Data::finishCompute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction ) const {
+
+  const double* globalData = reduction.next(reductionOperation(), m_variableLength);
+
   Teuchos::RCP<Epetra_Vector> outputData = blocks->begin()->getData(m_outputFieldId, PeridigmField::STEP_NONE);
-  if(m_variableLength == 1){
-    if(m_calculationType == MINIMUM)
-      epetraComm()->MinAll(&localData[0], &globalData[0], 1);
-    else if(m_calculationType == MAXIMUM)
-      epetraComm()->MaxAll(&localData[0], &globalData[0], 1);
-    else if(m_calculationType == SUM)
-      epetraComm()->SumAll(&localData[0], &globalData[0], 1);
-    (*outputData)[0] = globalData[0];
-  }
-  else if(m_variableLength == 3){
-    if(m_calculationType == MINIMUM)
-      epetraComm()->MinAll(&localData[0], &globalData[0], 3);
-    else if(m_calculationType == MAXIMUM)
-      epetraComm()->MaxAll(&localData[0], &globalData[0], 3);
-    else if(m_calculationType == SUM)
-      epetraComm()->SumAll(&localData[0], &globalData[0], 3);
-    (*outputData)[0] = globalData[0];
-    (*outputData)[1] = globalData[1];
-    (*outputData)[2] = globalData[2];
-  }
+  for(int i=0 ; i<m_variableLength ; ++i)
+    (*outputData)[i] = globalData[i];
 
   return 0;
 }
+
+PeridigmNS::ComputeReduction::Operation PeridigmNS::Compute_Block_Data::reductionOperation() const {
+  if(m_calculationType == MINIMUM)
+    return ComputeReduction::MINIMUM;
+  else if(m_calculationType == MAXIMUM)
+    return ComputeReduction::MAXIMUM;
+  return ComputeReduction::SUM;
+}
@@ -80,8 +80,17 @@ namespace PeridigmNS {
     //! Perform computation
     virtual int compute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks ) const;
 
+    //! Compute the local result and append it to the reduction buffer
+    virtual int computeLocal( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction ) const;
+
+    //! Store the reduced result
+    virtual int finishCompute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction ) const;
+
   private:
 
+    //! Reduction operation corresponding to the calculation type
+    ComputeReduction::Operation reductionOperation() const;
+
     //! Name of variable to be tracked
     std::string m_variable;
     int m_variableLength;
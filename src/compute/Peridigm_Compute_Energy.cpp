@@ -89,10 +89,14 @@ PeridigmNS::Compute_Energy::~Compute_Energy(){}
 
 //! Fill the energy vectors
 int PeridigmNS::Compute_Energy::compute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks  ) const
+{
+  return computeAndReduce(blocks);
+}
+
+//! Fill the energy vectors and collect the local block totals
+int PeridigmNS::Compute_Energy::computeLocal( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction ) const
 {
   int retval;
-  double globalKE, globalSE, globalSEDensity;
-  globalKE = globalSE = globalSEDensity = 0.0;
   Teuchos::RCP<Epetra_Vector> velocity, volume, force, ref, coord, w_volume, dilatation, numNeighbors, neighborID, kinetic_energy, strain_energy, strain_energy_density;
   std::vector<Block>::iterator blockIt;
   for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
@@ -196,18 +200,24 @@ int PeridigmNS::Compute_Energy::compute( Teuchos::RCP< std::vector<PeridigmNS::B
         kinetic_energy_values[i] = 0.5*vol*density*(v1*v1 + v2*v2 + v3*v3);	
       }
     
-    // Update info across processors
-    double localKE, localSE, globalBlockKE, globalBlockSE;
-    localKE = KE;
-    localSE = SE;
-    
-    epetraComm->SumAll(&localKE, &globalBlockKE, 1);
-    epetraComm->SumAll(&localSE, &globalBlockSE, 1);
-
-    globalKE += globalBlockKE;
-    globalSE += globalBlockSE;
+    // Defer the update across processors to the reduction buffer
+    reduction.add(ComputeReduction::SUM, KE);
+    reduction.add(ComputeReduction::SUM, SE);
 	}
 
+  return(0);
+}
+
+//! Store the global energies
+int PeridigmNS::Compute_Energy::finishCompute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction ) const
+{
+  double globalKE, globalSE;
+  globalKE = globalSE = 0.0;
+  for(unsigned int i=0 ; i<blocks->size() ; ++i){
+    globalKE += reduction.next(ComputeReduction::SUM);
+    globalSE += reduction.next(ComputeReduction::SUM);
+  }
+
   // Store global values
   Teuchos::RCP<Epetra_Vector> data;
   data = blocks->begin()->getData(m_globalKineticEnergyFieldId, PeridigmField::STEP_NONE);
@@ -80,6 +80,12 @@ namespace PeridigmNS {
     //! Perform computation
     int compute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks  ) const;
 
+    //! Fill the nodal energy vectors and append the local block totals to the reduction buffer
+    int computeLocal( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction ) const;
+
+    //! Store the global energies from the reduced block totals
+    int finishCompute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction ) const;
+
   private:
 
     // field ids for all relevant data
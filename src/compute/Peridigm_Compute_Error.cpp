@@ -93,7 +93,12 @@ PeridigmNS::Compute_Error::~Compute_Error(){}
 //! Fill the energy vectors
 int PeridigmNS::Compute_Error::compute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks  ) const
 {
-  double globalError = 0.0;
+  return computeAndReduce(blocks);
+}
+
+int PeridigmNS::Compute_Error::computeLocal( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction ) const
+{
+  double localError = 0.0;
 
   for(std::vector<Block>::iterator blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
 
@@ -201,13 +206,19 @@ int PeridigmNS::Compute_Error::compute( Teuchos::RCP< std::vector<PeridigmNS::Bl
       double errorVal = computeError_1(dispX, dispY, dispZ, x1, x2, y1, y2, z1, z2);
 
       error[localId] = errorVal;
-      globalError += errorVal;
+      localError += errorVal;
     }
   }
 
-  // Sum the global error across processors
-  double temp = globalError;
-  epetraComm->SumAll(&temp, &globalError, 1);
+  // Defer the sum across processors to the reduction buffer
+  reduction.add(ComputeReduction::SUM, localError);
+
+  return(0);
+}
+
+int PeridigmNS::Compute_Error::finishCompute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction ) const
+{
+  double globalError = reduction.next(ComputeReduction::SUM);
 
   // Store global value
   Teuchos::RCP<Epetra_Vector> data = blocks->begin()->getData(m_globalErrorFieldId, PeridigmField::STEP_NONE);
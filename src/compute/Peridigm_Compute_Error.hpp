@@ -78,6 +78,12 @@ namespace PeridigmNS {
     //! Perform computation
     int compute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks  ) const;
 
+    //! Compute the nodal error and append the local total to the reduction buffer
+    int computeLocal( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction ) const;
+
+    //! Store the global error
+    int finishCompute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction ) const;
+
   private:
 
     double computeError_1(double peridynamicSolutionX,
@@ -59,8 +59,19 @@ PeridigmNS::Compute_Global_Angular_Momentum::~Compute_Global_Angular_Momentum(){
 
 //! Compute the global angular momentum
 int PeridigmNS::Compute_Global_Angular_Momentum::compute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks  ) const
+{
+  return computeAndReduce(blocks);
+}
+
+//! Compute the local block totals
+int PeridigmNS::Compute_Global_Angular_Momentum::computeLocal( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction ) const
 {
   bool storeLocal = false;
-  int result = computeAngularMomentum(blocks, storeLocal);
-  return result;
+  return computeAngularMomentum(blocks, storeLocal, &reduction);
+}
+
+//! Store the global angular momentum
+int PeridigmNS::Compute_Global_Angular_Momentum::finishCompute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction ) const
+{
+  return finishAngularMomentum(blocks, reduction);
 }
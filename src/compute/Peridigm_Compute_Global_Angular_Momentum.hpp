@@ -79,6 +79,12 @@ namespace PeridigmNS {
 
     //! Perform computation
     int compute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks  ) const;
+
+    //! Compute the local block totals and append them to the reduction buffer
+    int computeLocal( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction ) const;
+
+    //! Store the global angular momentum from the reduced block totals
+    int finishCompute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction ) const;
   };
 }
 
@@ -61,8 +61,19 @@ PeridigmNS::Compute_Global_Kinetic_Energy::~Compute_Global_Kinetic_Energy(){}
 
 //! Compute the global kinetic energy
 int PeridigmNS::Compute_Global_Kinetic_Energy::compute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks  ) const
+{
+  	return computeAndReduce(blocks);
+}
+
+//! Compute the local block totals
+int PeridigmNS::Compute_Global_Kinetic_Energy::computeLocal( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction ) const
 {
   	bool storeLocal = false;
-  	int result = computeKineticEnergy(blocks, storeLocal);
-  	return result;
+  	return computeKineticEnergy(blocks, storeLocal, &reduction);
+}
+
+//! Store the global kinetic energy
+int PeridigmNS::Compute_Global_Kinetic_Energy::finishCompute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction ) const
+{
+  	return finishKineticEnergy(blocks, reduction);
 }
@@ -61,8 +61,19 @@ PeridigmNS::Compute_Global_Linear_Momentum::~Compute_Global_Linear_Momentum(){}
 
 //! Calculate the global linear momentum
 int PeridigmNS::Compute_Global_Linear_Momentum::compute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks  ) const
+{
+  return computeAndReduce(blocks);
+}
+
+//! Compute the local block totals
+int PeridigmNS::Compute_Global_Linear_Momentum::computeLocal( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction ) const
 {
   bool storeLocal = false;
-  int result = computeLinearMomentum(blocks, storeLocal);
-  return result;
+  return computeLinearMomentum(blocks, storeLocal, &reduction);
+}
+
+//! Store the global linear momentum
+int PeridigmNS::Compute_Global_Linear_Momentum::finishCompute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction ) const
+{
+  return finishLinearMomentum(blocks, reduction);
 }
@@ -76,11 +76,12 @@ int PeridigmNS::Compute_Kinetic_Energy::compute( Teuchos::RCP< std::vector<Perid
 	return 0;
 }
 
-int PeridigmNS::Compute_Kinetic_Energy::computeKineticEnergy( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, bool storeLocal ) const
+int PeridigmNS::Compute_Kinetic_Energy::computeKineticEnergy( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, bool storeLocal, ComputeReduction* reduction ) const
 { 
 	int retval;
 	
-	double globalKE = 0.0;
+	TEUCHOS_TEST_FOR_EXCEPT_MSG(!storeLocal && reduction == NULL, "**** Error:  Compute_Kinetic_Energy requires a reduction buffer to compute the global kinetic energy.\n");
+
 	Teuchos::RCP<Epetra_Vector> velocity, volume, force, numNeighbors, neighborID, kinetic_energy;
 	std::vector<Block>::iterator blockIt;
 	for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++)
@@ -137,24 +138,24 @@ int PeridigmNS::Compute_Kinetic_Energy::computeKineticEnergy( Teuchos::RCP< std:
 			
 		}
 
+		// Defer the update across processors to the reduction buffer
 		if (!storeLocal)
-		{
-			// Update info across processors
-			double localKE, globalBlockKE;
-			localKE = KE;
+			reduction->add(ComputeReduction::SUM, KE);
+	}
 
-			epetraComm->SumAll(&localKE, &globalBlockKE, 1);
+	return(0);
+
+}
+
+int PeridigmNS::Compute_Kinetic_Energy::finishKineticEnergy( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction ) const
+{
+	double globalKE = 0.0;
+	for(unsigned int i=0 ; i<blocks->size() ; ++i)
+		globalKE += reduction.next(ComputeReduction::SUM);
 
-			globalKE += globalBlockKE;
-		}
-	}
-	
 	// Store global energy in block (block globals are static, so only need to assign data to first block)
-	if (!storeLocal){
-      Teuchos::RCP<Epetra_Vector> data = blocks->begin()->getData(m_globalKineticEnergyFieldId, PeridigmField::STEP_NONE);
-      (*data)[0] = globalKE;
-    }
+	Teuchos::RCP<Epetra_Vector> data = blocks->begin()->getData(m_globalKineticEnergyFieldId, PeridigmField::STEP_NONE);
+	(*data)[0] = globalKE;
 
 	return(0);
-
 }
@@ -77,8 +77,11 @@ namespace PeridigmNS {
     //! Perform computation
     virtual int compute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks  ) const;
 
-    //! Compute the kinetic energy and optionally store the nodal values. 
-    int computeKineticEnergy( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, bool storeLocal ) const ;
+    //! Compute the kinetic energy and either store the nodal values or append the local block totals to the reduction buffer.
+    int computeKineticEnergy( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, bool storeLocal, ComputeReduction* reduction = NULL ) const ;
+
+    //! Store the global kinetic energy from the reduced block totals.
+    int finishKineticEnergy( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction ) const ;
 
   private:
 
@@ -78,11 +78,12 @@ int PeridigmNS::Compute_Linear_Momentum::compute( Teuchos::RCP< std::vector<Peri
 }
  
 //! Fill the linear momentum vector
-int PeridigmNS::Compute_Linear_Momentum::computeLinearMomentum( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, bool storeLocal  ) const
+int PeridigmNS::Compute_Linear_Momentum::computeLinearMomentum( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, bool storeLocal, ComputeReduction* reduction  ) const
 {
   int retval;
 
-  double globalLM = 0.0;
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(!storeLocal && reduction == NULL, "**** Error:  Compute_Linear_Momentum requires a reduction buffer to compute the global linear momentum.\n");
+
   Teuchos::RCP<Epetra_Vector> velocity, volume, linear_momentum;
   std::vector<Block>::iterator blockIt;
   for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++)
@@ -137,18 +138,29 @@ int PeridigmNS::Compute_Linear_Momentum::computeLinearMomentum( Teuchos::RCP< st
 
     if (!storeLocal)
     {
-      // Update info across processors
-      std::vector<double> localLinearMomentum(3), globalLinearMomentum(3);
+      // Defer the update across processors to the reduction buffer
+      double localLinearMomentum[3];
       localLinearMomentum[0] = linear_momentum_x;
       localLinearMomentum[1] = linear_momentum_y;
       localLinearMomentum[2] = linear_momentum_z;
 
-      epetraComm->SumAll(&localLinearMomentum[0], &globalLinearMomentum[0], 3);
-
-      globalLM += sqrt(globalLinearMomentum[0]*globalLinearMomentum[0] + globalLinearMomentum[1]*globalLinearMomentum[1] + globalLinearMomentum[2]*globalLinearMomentum[2]);
+      reduction->add(ComputeReduction::SUM, localLinearMomentum, 3);
     }
   }
 
+  return(0);
+
+}
+
+int PeridigmNS::Compute_Linear_Momentum::finishLinearMomentum( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction  ) const
+{
+  double globalLM = 0.0;
+  for(unsigned int i=0 ; i<blocks->size() ; ++i)
+  {
+    const double* globalLinearMomentum = reduction.next(ComputeReduction::SUM, 3);
+    globalLM += sqrt(globalLinearMomentum[0]*globalLinearMomentum[0] + globalLinearMomentum[1]*globalLinearMomentum[1] + globalLinearMomentum[2]*globalLinearMomentum[2]);
+  }
+
 /*
 	if ((params, epetraComm)->MyPID() == 0)
 	{
@@ -161,10 +173,8 @@ int PeridigmNS::Compute_Linear_Momentum::computeLinearMomentum( Teuchos::RCP< st
 */
 
   // Store global energy in block (block globals are static, so only need to assign data to first block)
-  if (!storeLocal){
-    Teuchos::RCP<Epetra_Vector> data = blocks->begin()->getData(m_globalLinearMomentumFieldId, PeridigmField::STEP_NONE);
-    (*data)[0] = globalLM;
-  }
+  Teuchos::RCP<Epetra_Vector> data = blocks->begin()->getData(m_globalLinearMomentumFieldId, PeridigmField::STEP_NONE);
+  (*data)[0] = globalLM;
 
   return(0);
 
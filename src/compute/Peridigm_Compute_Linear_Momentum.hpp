@@ -77,8 +77,11 @@ namespace PeridigmNS {
     //! Perform computation
     virtual int compute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks  ) const;
 
-    //! Compute the linear momentum and optionally store the nodal values. 
-    int computeLinearMomentum( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, bool storeLocal ) const ;
+    //! Compute the linear momentum and optionally store the nodal values; if storeLocal is false, the local block totals are appended to the reduction buffer. 
+    int computeLinearMomentum( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, bool storeLocal, ComputeReduction* reduction = NULL ) const ;
+
+    //! Store the global linear momentum from the reduced block totals.
+    int finishLinearMomentum( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction ) const ;
 
   private:
 
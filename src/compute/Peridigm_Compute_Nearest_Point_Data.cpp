@@ -198,12 +198,16 @@ void PeridigmNS::Compute_Nearest_Point_Data::initialize( Teuchos::RCP< std::vect
 }
 
 int PeridigmNS::Compute_Nearest_Point_Data::compute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks ) const {
+  return computeAndReduce(blocks);
+}
+
+int PeridigmNS::Compute_Nearest_Point_Data::computeLocal( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction ) const {
 
   PeridigmField::Step step = PeridigmField::STEP_NONE;
   if(m_variableIsStated)
     step = PeridigmField::STEP_NP1;
   
-  std::vector<double> localData(3), globalData(3);
+  std::vector<double> localData(3);
   localData[0] = 0.0;
 
   for(std::vector<Block>::iterator blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
@@ -223,17 +227,19 @@ int PeridigmNS::Compute_Nearest_Point_Data::compute( Teuchos::RCP< std::vector<P
     }
   }
 
+  // Only the processor that owns the element contributes a nonzero value
+  reduction.add(ComputeReduction::SUM, &localData[0], m_variableLength);
+
+  return 0;
+}
+
+int PeridigmNS::Compute_Nearest_Point_Data::finishCompute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction ) const {
+
+  const double* globalData = reduction.next(ComputeReduction::SUM, m_variableLength);
+
   Teuchos::RCP<Epetra_Vector> outputData = blocks->begin()->getData(m_outputFieldId, PeridigmField::STEP_NONE);
-  if(m_variableLength == 1){
-    epetraComm()->SumAll(&localData[0], &globalData[0], 1);
-    (*outputData)[0] = globalData[0];
-  }
-  else if(m_variableLength == 3){
-    epetraComm()->SumAll(&localData[0], &globalData[0], 3);
-    (*outputData)[0] = globalData[0];
-    (*outputData)[1] = globalData[1];
-    (*outputData)[2] = globalData[2];
-  }
+  for(int i=0 ; i<m_variableLength ; ++i)
+    (*outputData)[i] = globalData[i];
 
   return 0;
 }
@@ -65,6 +65,10 @@ PeridigmNS::Compute_Neighborhood_Volume::Compute_Neighborhood_Volume(Teuchos::RC
 PeridigmNS::Compute_Neighborhood_Volume::~Compute_Neighborhood_Volume(){}
 
 void PeridigmNS::Compute_Neighborhood_Volume::initialize( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks ) {
+  compute(blocks);
+}
+
+int PeridigmNS::Compute_Neighborhood_Volume::compute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks ) const {
 
   FieldManager& fieldManager = FieldManager::self();
 
@@ -106,8 +110,5 @@ void PeridigmNS::Compute_Neighborhood_Volume::initialize( Teuchos::RCP< std::vec
     }
   }
 
-}
-
-int PeridigmNS::Compute_Neighborhood_Volume::compute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks ) const {
   return 0;
 }
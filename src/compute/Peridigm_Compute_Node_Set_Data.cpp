@@ -46,6 +46,7 @@
 //@HEADER
 
 #include <vector>
+#include <algorithm>
 
 #include "Peridigm_Compute_Node_Set_Data.hpp"
 #include "Peridigm_Discretization.hpp"
@@ -57,8 +58,8 @@ using namespace std;
 PeridigmNS::Compute_Node_Set_Data::Compute_Node_Set_Data(Teuchos::RCP<const Teuchos::ParameterList> params,
                                                          Teuchos::RCP<const Epetra_Comm> epetraComm_,
                                                          Teuchos::RCP<const Teuchos::ParameterList> computeClassGlobalData_)
-  : Compute(params, epetraComm_, computeClassGlobalData_), m_calculationType(UNDEFINED_CALCULATION),
-    m_variableFieldId(-1), m_outputFieldId(-1)
+  : Compute(params, epetraComm_, computeClassGlobalData_), m_nodeSetIsGlobal(false),
+    m_calculationType(UNDEFINED_CALCULATION), m_variableFieldId(-1), m_outputFieldId(-1)
 {
   m_nodeSetName = params->get<string>("Node Set");
   m_variable = params->get<string>("Variable");
@@ -135,13 +136,42 @@ void PeridigmNS::Compute_Node_Set_Data::initialize( Teuchos::RCP< std::vector<Pe
   }
 }
 
+void PeridigmNS::Compute_Node_Set_Data::rebalance( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks ) {
+
+  // The node set provided by the discretization covers only the points owned in the initial decomposition,
+  // so the members from all processors are gathered the first time the points migrate
+  if(!m_nodeSetIsGlobal){
+    int localSize = static_cast<int>(m_nodeSet.size());
+    int maxSize(0);
+    epetraComm->MaxAll(&localSize, &maxSize, 1);
+    if(maxSize > 0){
+      vector<int> localMembers(maxSize, -1);
+      std::copy(m_nodeSet.begin(), m_nodeSet.end(), localMembers.begin());
+      vector<int> globalMembers(maxSize*epetraComm->NumProc());
+      epetraComm->GatherAll(&localMembers[0], &globalMembers[0], maxSize);
+      for(unsigned int i=0 ; i<globalMembers.size() ; ++i){
+        if(globalMembers[i] != -1)
+          m_nodeSet.insert(globalMembers[i]);
+      }
+    }
+    m_nodeSetIsGlobal = true;
+  }
+
+  m_blockLocalIds.clear();
+  initialize(blocks);
+}
+
 int PeridigmNS::Compute_Node_Set_Data::compute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks ) const {
+  return computeAndReduce(blocks);
+}
+
+int PeridigmNS::Compute_Node_Set_Data::computeLocal( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction ) const {
 
   PeridigmField::Step step = PeridigmField::STEP_NONE;
   if(m_variableIsStated)
     step = PeridigmField::STEP_NP1;
   
-  std::vector<double> localData(3), globalData(3);
+  std::vector<double> localData(3);
 
   if(m_calculationType == MINIMUM){
     for(int i=0 ; i<3 ; ++i)
@@ -213,27 +243,27 @@ int PeridigmNS::Compute_Node_Set_Data::compute( Teuchos::RCP< std::vector<Peridi
     }
   }
 
+  // Defer the update across processors to the reduction buffer
+  reduction.add(reductionOperation(), &localData[0], m_variableLength);
+
+  return 0;
+}
+
+int PeridigmNS::Compute_Node_Set_Data::finishCompute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction ) const {
+
+  const double* globalData = reduction.next(reductionOperation(), m_variableLength);
+
   Teuchos::RCP<Epetra_Vector> outputData = blocks->begin()->getData(m_outputFieldId, PeridigmField::STEP_NONE);
-  if(m_variableLength == 1){
-    if(m_calculationType == MINIMUM)
-      epetraComm()->MinAll(&localData[0], &globalData[0], 1);
-    else if(m_calculationType == MAXIMUM)
-      epetraComm()->MaxAll(&localData[0], &globalData[0], 1);
-    else if(m_calculationType == SUM)
-      epetraComm()->SumAll(&localData[0], &globalData[0], 1);
-    (*outputData)[0] = globalData[0];
-  }
-  else if(m_variableLength == 3){
-    if(m_calculationType == MINIMUM)
-      epetraComm()->MinAll(&localData[0], &globalData[0], 3);
-    else if(m_calculationType == MAXIMUM)
-      epetraComm()->MaxAll(&localData[0], &globalData[0], 3);
-    else if(m_calculationType == SUM)
-      epetraComm()->SumAll(&localData[0], &globalData[0], 3);
-    (*outputData)[0] = globalData[0];
-    (*outputData)[1] = globalData[1];
-    (*outputData)[2] = globalData[2];
-  }
+  for(int i=0 ; i<m_variableLength ; ++i)
+    (*outputData)[i] = globalData[i];
 
   return 0;
 }
+
+PeridigmNS::ComputeReduction::Operation PeridigmNS::Compute_Node_Set_Data::reductionOperation() const {
+  if(m_calculationType == MINIMUM)
+    return ComputeReduction::MINIMUM;
+  else if(m_calculationType == MAXIMUM)
+    return ComputeReduction::MAXIMUM;
+  return ComputeReduction::SUM;
+}
@@ -77,11 +77,23 @@ namespace PeridigmNS {
     //! Initialize the compute class
     void initialize( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks  );
 
+    //! Recompute the local ids of the node set after the blocks have been rebalanced
+    void rebalance( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks  );
+
     //! Perform computation
     virtual int compute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks ) const;
 
+    //! Compute the local result and append it to the reduction buffer
+    virtual int computeLocal( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction ) const;
+
+    //! Store the reduced result
+    virtual int finishCompute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, ComputeReduction& reduction ) const;
+
   private:
 
+    //! Reduction operation corresponding to the calculation type
+    ComputeReduction::Operation reductionOperation() const;
+
     //! Name of variable to be tracked
     std::string m_variable;
     int m_variableLength;
@@ -89,6 +101,9 @@ namespace PeridigmNS {
     std::string m_nodeSetName;
     std::set<int> m_nodeSet;
 
+    //! Flag indicating that m_nodeSet contains the node set members on all processors
+    bool m_nodeSetIsGlobal;
+
     //! List of local ids for the nodes in the node set
     std::map< std::string, std::vector<int> > m_blockLocalIds;
 
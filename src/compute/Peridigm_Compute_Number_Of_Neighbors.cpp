@@ -63,6 +63,10 @@ PeridigmNS::Compute_Number_Of_Neighbors::Compute_Number_Of_Neighbors(Teuchos::RC
 PeridigmNS::Compute_Number_Of_Neighbors::~Compute_Number_Of_Neighbors(){}
 
 void PeridigmNS::Compute_Number_Of_Neighbors::initialize( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks ) {
+  compute(blocks);
+}
+
+int PeridigmNS::Compute_Number_Of_Neighbors::compute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks ) const {
 
   std::vector<PeridigmNS::Block>::iterator blockIt;
   for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
@@ -79,8 +83,6 @@ void PeridigmNS::Compute_Number_Of_Neighbors::initialize( Teuchos::RCP< std::vec
       neighborhoodListIndex += numNeighbors;
     }
   }
-}
 
-int PeridigmNS::Compute_Number_Of_Neighbors::compute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks ) const {
   return 0;
 }
@@ -80,6 +80,9 @@ namespace PeridigmNS {
     //! Perform computation
     virtual int compute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks ) const;
 
+    //! Results depend only on the bond connectivity and the reference volumes, so they are not recomputed every step
+    virtual Dependency getDependency() const { return BOND_CONNECTIVITY; }
+
   private:
 
     // field ids for all relevant data
@@ -66,6 +66,10 @@ PeridigmNS::Compute_Radius::Compute_Radius(Teuchos::RCP<const Teuchos::Parameter
 PeridigmNS::Compute_Radius::~Compute_Radius(){}
 
 void PeridigmNS::Compute_Radius::initialize( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks ) {
+  compute(blocks);
+}
+
+int PeridigmNS::Compute_Radius::compute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks ) const {
 
   Teuchos::RCP<Epetra_Vector> force, acceleration;
   std::vector<Block>::iterator blockIt;
@@ -83,8 +87,6 @@ void PeridigmNS::Compute_Radius::initialize( Teuchos::RCP< std::vector<PeridigmN
     for(int iID=0 ; iID<numOwnedPoints ; ++iID)
       radius[iID] = pow(constant*volume[iID], oneThird);
   }
-}
 
-int PeridigmNS::Compute_Radius::compute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks ) const {
   return(0);
 }
@@ -80,6 +80,9 @@ namespace PeridigmNS {
     //! Perform computation
     int compute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks  ) const;
 
+    //! Results depend only on the reference volumes, so they are not recomputed every step
+    virtual Dependency getDependency() const { return REFERENCE_CONFIGURATION; }
+
   private:
 
     // field ids for all relevant data
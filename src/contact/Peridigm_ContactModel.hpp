@@ -52,6 +52,7 @@
 #include <Teuchos_ParameterList.hpp>
 #include <Epetra_Vector.h>
 #include "Peridigm_DataManager.hpp"
+#include "Peridigm_ContactPairList.hpp"
 
 namespace PeridigmNS {
 
@@ -80,6 +81,12 @@ namespace PeridigmNS {
                  const int* contactNeighborhoodList,
                  PeridigmNS::DataManager& dataManager) const = 0;
 
+	//! Evaluate the forces on the cells from a list of contact pairs
+	virtual void
+	computeForce(const double dt,
+                 const PeridigmNS::ContactPairList& contactPairs,
+                 PeridigmNS::DataManager& dataManager) const = 0;
+
     virtual void 
     evaluateParserFriction(double & currentValue, double & previousValue, const double & timeCurrent=0.0, const double & timePrevious=0.0) = 0;          
            
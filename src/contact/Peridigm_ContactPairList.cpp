@@ -0,0 +1,102 @@
+/*! \file Peridigm_ContactPairList.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include "Peridigm_ContactPairList.hpp"
+#include <Teuchos_Assert.hpp>
+#include <algorithm>
+#include <utility>
+
+using namespace std;
+
+void PeridigmNS::ContactPairList::initialize(const int numOwnedPoints,
+                                             const int* ownedIDs,
+                                             const int* contactNeighborhoodList)
+{
+  m_firstIDs.clear();
+  m_secondIDs.clear();
+  m_weights.clear();
+
+  // Flag the locally-owned points
+  int maxOwnedID = -1;
+  for(int iID=0 ; iID<numOwnedPoints ; ++iID)
+    maxOwnedID = max(maxOwnedID, ownedIDs[iID]);
+  vector<bool> isOwned(maxOwnedID+1, false);
+  for(int iID=0 ; iID<numOwnedPoints ; ++iID)
+    isOwned[ownedIDs[iID]] = true;
+
+  // Pairs of owned points are stored as (smaller ID, larger ID) so that both directions can be merged
+  vector< pair<int,int> > ownedPairs;
+  int neighborhoodListIndex = 0;
+  for(int iID=0 ; iID<numOwnedPoints ; ++iID){
+    int nodeID = ownedIDs[iID];
+    int numNeighbors = contactNeighborhoodList[neighborhoodListIndex++];
+    for(int iNID=0 ; iNID<numNeighbors ; ++iNID){
+      int neighborID = contactNeighborhoodList[neighborhoodListIndex++];
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(neighborID < 0, "Invalid neighbor list\n");
+      if(neighborID <= maxOwnedID && isOwned[neighborID]){
+        ownedPairs.push_back(make_pair(min(nodeID, neighborID), max(nodeID, neighborID)));
+      }
+      else{
+        m_firstIDs.push_back(nodeID);
+        m_secondIDs.push_back(neighborID);
+        m_weights.push_back(1.0);
+      }
+    }
+  }
+
+  // Merge duplicate owned pairs, recording their multiplicity
+  sort(ownedPairs.begin(), ownedPairs.end());
+  for(unsigned int i=0 ; i<ownedPairs.size() ; ){
+    unsigned int j = i+1;
+    while(j<ownedPairs.size() && ownedPairs[j] == ownedPairs[i])
+      j++;
+    m_firstIDs.push_back(ownedPairs[i].first);
+    m_secondIDs.push_back(ownedPairs[i].second);
+    m_weights.push_back(static_cast<double>(j-i));
+    i = j;
+  }
+}
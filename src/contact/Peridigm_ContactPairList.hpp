@@ -0,0 +1,95 @@
+//! \file Peridigm_ContactPairList.hpp
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef PERIDIGM_CONTACTPAIRLIST_HPP
+#define PERIDIGM_CONTACTPAIRLIST_HPP
+
+#include <vector>
+
+namespace PeridigmNS {
+
+/*! \brief List of contact pairs stored in structure-of-arrays form.
+ *
+ *  Each pair of locally-owned points appears once, with a weight equal to the number of
+ *  times the pair appears in the contact neighborhood list.  Pairs that involve a point
+ *  that is not locally owned appear once per entry in the contact neighborhood list.
+ */
+  class ContactPairList {
+  public:
+
+    //! Constructor.
+    ContactPairList() {}
+
+    //! Destructor.
+    ~ContactPairList() {}
+
+    //! Build the pair list from a contact neighborhood list (numNeighbors, n1, n2, ..., numNeighbors, n1, ...).
+    void initialize(const int numOwnedPoints,
+                    const int* ownedIDs,
+                    const int* contactNeighborhoodList);
+
+    //! Number of contact pairs.
+    int NumPairs() const { return static_cast<int>(m_firstIDs.size()); }
+
+    //! Local ID of the first point in each pair.
+    const int* FirstIDs() const { return m_firstIDs.empty() ? 0 : &m_firstIDs[0]; }
+
+    //! Local ID of the second point in each pair.
+    const int* SecondIDs() const { return m_secondIDs.empty() ? 0 : &m_secondIDs[0]; }
+
+    //! Multiplicity of each pair.
+    const double* Weights() const { return m_weights.empty() ? 0 : &m_weights[0]; }
+
+  protected:
+
+    std::vector<int> m_firstIDs;
+    std::vector<int> m_secondIDs;
+    std::vector<double> m_weights;
+  };
+}
+
+#endif // PERIDIGM_CONTACTPAIRLIST_HPP
@@ -100,6 +100,16 @@ PeridigmNS::ShortRangeForceContactModel::computeForce(const double dt,
                                                       const int* ownedIDs,
                                                       const int* contactNeighborhoodList,
                                                       PeridigmNS::DataManager& dataManager) const
+{
+  ContactPairList contactPairs;
+  contactPairs.initialize(numOwnedPoints, ownedIDs, contactNeighborhoodList);
+  computeForce(dt, contactPairs, dataManager);
+}
+
+void
+PeridigmNS::ShortRangeForceContactModel::computeForce(const double dt,
+                                                      const PeridigmNS::ContactPairList& contactPairs,
+                                                      PeridigmNS::DataManager& dataManager) const
 {
   // Zero out the forces
   dataManager.getData(m_contactForceDensityFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
@@ -110,152 +120,111 @@ PeridigmNS::ShortRangeForceContactModel::computeForce(const double dt,
   dataManager.getData(m_velocityFieldId, PeridigmField::STEP_NP1)->ExtractView(&velocity);
   dataManager.getData(m_contactForceDensityFieldId, PeridigmField::STEP_NP1)->ExtractView(&contactForce);
 
-  int neighborhoodListIndex(0), numNeighbors, nodeID, neighborID, iID, iNID;
-  double nodeCurrentX[3], nodeCurrentV[3], nodeVolume, currentDistance, c, temp, neighborVolume;
-  double normal[3], currentDotNormal, currentDotNeighbor, nodeCurrentVperp[3], nodeNeighborVperp[3], Vcm[3], nodeCurrentVrel[3], nodeNeighborVrel[3];
-  double normCurrentVrel, normNeighborVrel, currentNormalForce[3], neighborNormalForce[3], normCurrentNormalForce, normNeighborNormalForce, currentFrictionForce[3], neighborFrictionForce[3];
-
-  double currentDistanceSquared;
-  double contactRadiusSquared = m_contactRadius*m_contactRadius;
-
   const double pi = boost::math::constants::pi<double>();
 
-  for(iID=0 ; iID<numOwnedPoints ; ++iID){
-    numNeighbors = contactNeighborhoodList[neighborhoodListIndex++];
-    if(numNeighbors > 0){
-      nodeID = ownedIDs[iID];
-      nodeCurrentX[0] = y[nodeID*3];
-      nodeCurrentX[1] = y[nodeID*3+1];
-      nodeCurrentX[2] = y[nodeID*3+2];
-      nodeCurrentV[0] = velocity[nodeID*3];
-      nodeCurrentV[1] = velocity[nodeID*3+1];
-      nodeCurrentV[2] = velocity[nodeID*3+2];
-      nodeVolume = cellVolume[nodeID];
-      for(iNID=0 ; iNID<numNeighbors ; ++iNID){
-        neighborID = contactNeighborhoodList[neighborhoodListIndex++];
-        TEUCHOS_TEST_FOR_EXCEPT_MSG(neighborID < 0, "Invalid neighbor list\n");
-	currentDistanceSquared =  distanceSquared(nodeCurrentX[0], nodeCurrentX[1], nodeCurrentX[2],
-						  y[neighborID*3], y[neighborID*3+1], y[neighborID*3+2]);
-        if(currentDistanceSquared < contactRadiusSquared){
-	  currentDistance = distance(nodeCurrentX[0], nodeCurrentX[1], nodeCurrentX[2],
-				     y[neighborID*3], y[neighborID*3+1], y[neighborID*3+2]);
-          c = 9.0*m_springConstant/(pi*m_horizon*m_horizon*m_horizon*m_horizon);	// half value (of 18) due to force being applied to both nodes
-          temp = c*(m_contactRadius - currentDistance)/m_horizon;
-          neighborVolume = cellVolume[neighborID];
-          
-          if (m_frictionCoefficient != 0.0){
-
-            // calculate the perpendicular velocity of the current node wrt the vector between the nodes 
-
-            normal[0] = (y[neighborID*3] - nodeCurrentX[0])/currentDistance;
-            normal[1] = (y[neighborID*3+1] - nodeCurrentX[1])/currentDistance;
-            normal[2] = (y[neighborID*3+2] - nodeCurrentX[2])/currentDistance;
-
-            currentDotNormal = nodeCurrentV[0]*normal[0] + 
-              nodeCurrentV[1]*normal[1] + 
-              nodeCurrentV[2]*normal[2];
-
-            currentDotNeighbor = velocity[neighborID*3]*normal[0] + 
-              velocity[neighborID*3+1]*normal[1] + 
-              velocity[neighborID*3+2]*normal[2]; 
-
-            nodeCurrentVperp[0] = nodeCurrentV[0] - currentDotNormal*normal[0];
-            nodeCurrentVperp[1] = nodeCurrentV[1] - currentDotNormal*normal[1];
-            nodeCurrentVperp[2] = nodeCurrentV[2] - currentDotNormal*normal[2];
-
-            nodeNeighborVperp[0] = velocity[neighborID*3] - currentDotNeighbor*normal[0];
-            nodeNeighborVperp[1] = velocity[neighborID*3+1] - currentDotNeighbor*normal[1];
-            nodeNeighborVperp[2] = velocity[neighborID*3+2] - currentDotNeighbor*normal[2];
-
-            // calculate frame of reference for the perpendicular velocities
-
-            Vcm[0] = 0.5*(nodeCurrentVperp[0] + nodeNeighborVperp[0]);
-            Vcm[1] = 0.5*(nodeCurrentVperp[1] + nodeNeighborVperp[1]);
-            Vcm[2] = 0.5*(nodeCurrentVperp[2] + nodeNeighborVperp[2]);
-          
-            // calculate the relative velocity of the current node wrt the neighboring node and vice versa
-
-            nodeCurrentVrel[0] = nodeCurrentVperp[0] - Vcm[0];
-            nodeCurrentVrel[1] = nodeCurrentVperp[1] - Vcm[1];
-            nodeCurrentVrel[2] = nodeCurrentVperp[2] - Vcm[2];
-
-            nodeNeighborVrel[0] = nodeNeighborVperp[0] - Vcm[0];
-            nodeNeighborVrel[1] = nodeNeighborVperp[1] - Vcm[1];
-            nodeNeighborVrel[2] = nodeNeighborVperp[2] - Vcm[2];
+  // half value (of 18) due to force being applied to both nodes
+  const double c = 9.0*m_springConstant/(pi*m_horizon*m_horizon*m_horizon*m_horizon);
 
-            normCurrentVrel = sqrt(nodeCurrentVrel[0]*nodeCurrentVrel[0] + 
-                                   nodeCurrentVrel[1]*nodeCurrentVrel[1] + 
-                                   nodeCurrentVrel[2]*nodeCurrentVrel[2]); 
-
-            normNeighborVrel = sqrt(nodeNeighborVrel[0]*nodeNeighborVrel[0] + 
-                                    nodeNeighborVrel[1]*nodeNeighborVrel[1] + 
-                                    nodeNeighborVrel[2]*nodeNeighborVrel[2]);         
-            
-            // calculate the normal forces
-
-            currentNormalForce[0] = -(temp*neighborVolume*(y[neighborID*3]   - nodeCurrentX[0])/currentDistance);
-            currentNormalForce[1] = -(temp*neighborVolume*(y[neighborID*3+1] - nodeCurrentX[1])/currentDistance);
-            currentNormalForce[2] = -(temp*neighborVolume*(y[neighborID*3+2] - nodeCurrentX[2])/currentDistance);
-
-            neighborNormalForce[0] = (temp*nodeVolume*(y[neighborID*3]   - nodeCurrentX[0])/currentDistance);
-            neighborNormalForce[1] = (temp*nodeVolume*(y[neighborID*3+1] - nodeCurrentX[1])/currentDistance);
-            neighborNormalForce[2] = (temp*nodeVolume*(y[neighborID*3+2] - nodeCurrentX[2])/currentDistance);
-
-            normCurrentNormalForce = sqrt(currentNormalForce[0]*currentNormalForce[0] + 
-                                          currentNormalForce[1]*currentNormalForce[1] + 
-                                          currentNormalForce[2]*currentNormalForce[2]);
-
-            normNeighborNormalForce = sqrt(neighborNormalForce[0]*neighborNormalForce[0] + 
-                                           neighborNormalForce[1]*neighborNormalForce[1] + 
-                                           neighborNormalForce[2]*neighborNormalForce[2]);
-            
-            // calculate the friction forces
-
-            if (normCurrentVrel != 0.0) {
-              currentFrictionForce[0] = -m_frictionCoefficient*normCurrentNormalForce*nodeCurrentVrel[0]/normCurrentVrel;
-              currentFrictionForce[1] = -m_frictionCoefficient*normCurrentNormalForce*nodeCurrentVrel[1]/normCurrentVrel;
-              currentFrictionForce[2] = -m_frictionCoefficient*normCurrentNormalForce*nodeCurrentVrel[2]/normCurrentVrel;
-            }
-            else {
-              currentFrictionForce[0] = 0.0;
-              currentFrictionForce[1] = 0.0;
-              currentFrictionForce[2] = 0.0;
-            }
-
-            if (normNeighborVrel != 0.0) {
-              neighborFrictionForce[0] = -m_frictionCoefficient*normNeighborNormalForce*nodeNeighborVrel[0]/normNeighborVrel;
-              neighborFrictionForce[1] = -m_frictionCoefficient*normNeighborNormalForce*nodeNeighborVrel[1]/normNeighborVrel;
-              neighborFrictionForce[2] = -m_frictionCoefficient*normNeighborNormalForce*nodeNeighborVrel[2]/normNeighborVrel;
-            }
-            else {
-              neighborFrictionForce[0] = 0.0;
-              neighborFrictionForce[1] = 0.0;
-              neighborFrictionForce[2] = 0.0;
-            }
-
-            // compute total contributions to force density
-
-            contactForce[nodeID*3]       += currentNormalForce[0] + currentFrictionForce[0];
-            contactForce[nodeID*3+1]     += currentNormalForce[1] + currentFrictionForce[1];
-            contactForce[nodeID*3+2]     += currentNormalForce[2] + currentFrictionForce[2];
-            contactForce[neighborID*3]   += neighborNormalForce[0] + neighborFrictionForce[0];
-            contactForce[neighborID*3+1] += neighborNormalForce[1] + neighborFrictionForce[1];
-            contactForce[neighborID*3+2] += neighborNormalForce[2] + neighborFrictionForce[2];
-          }
-          else {          
+  computeShortRangeContactForce(contactPairs, c, m_contactRadius, m_horizon, m_frictionCoefficient,
+                                cellVolume, y, velocity, contactForce);
+}
 
-            // compute contributions to force density (Normal Force Only)
+namespace {
 
-            contactForce[nodeID*3]       -= temp*neighborVolume*(y[neighborID*3]   - nodeCurrentX[0])/currentDistance;
-            contactForce[nodeID*3+1]     -= temp*neighborVolume*(y[neighborID*3+1] - nodeCurrentX[1])/currentDistance;
-            contactForce[nodeID*3+2]     -= temp*neighborVolume*(y[neighborID*3+2] - nodeCurrentX[2])/currentDistance;
-            contactForce[neighborID*3]   += temp*nodeVolume*(y[neighborID*3]   - nodeCurrentX[0])/currentDistance;
-            contactForce[neighborID*3+1] += temp*nodeVolume*(y[neighborID*3+1] - nodeCurrentX[1])/currentDistance;
-            contactForce[neighborID*3+2] += temp*nodeVolume*(y[neighborID*3+2] - nodeCurrentX[2])/currentDistance;
+  //! Add value to target; atomic when the pair loop is threaded.
+  inline void addContactForce(double& target, const double value)
+  {
+#ifdef PERIDIGM_OPENMP
+    #pragma omp atomic
+#endif
+    target += value;
+  }
+}
 
-          }
-        }
+void PeridigmNS::computeShortRangeContactForce(const PeridigmNS::ContactPairList& contactPairs,
+                                               const double springCoefficient,
+                                               const double contactRadius,
+                                               const double horizon,
+                                               const double frictionCoefficient,
+                                               const double* cellVolume,
+                                               const double* y,
+                                               const double* velocity,
+                                               double* contactForce)
+{
+  const int numPairs = contactPairs.NumPairs();
+  const int* firstIDs = contactPairs.FirstIDs();
+  const int* secondIDs = contactPairs.SecondIDs();
+  const double* weights = contactPairs.Weights();
+  const double contactRadiusSquared = contactRadius*contactRadius;
+  const double springCoefficientOverHorizon = springCoefficient/horizon;
+  const bool hasFriction = (frictionCoefficient != 0.0);
+
+#ifdef PERIDIGM_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for(int iPair=0 ; iPair<numPairs ; ++iPair){
+
+    const int nodeID = firstIDs[iPair];
+    const int neighborID = secondIDs[iPair];
+
+    const double dx = y[neighborID*3]   - y[nodeID*3];
+    const double dy = y[neighborID*3+1] - y[nodeID*3+1];
+    const double dz = y[neighborID*3+2] - y[nodeID*3+2];
+    const double currentDistanceSquared = dx*dx + dy*dy + dz*dz;
+    if(currentDistanceSquared >= contactRadiusSquared)
+      continue;
+
+    const double currentDistance = sqrt(currentDistanceSquared);
+    // normal force per unit volume, divided by the distance so that it can be applied to (dx, dy, dz) directly
+    const double temp = weights[iPair]*springCoefficientOverHorizon*(contactRadius - currentDistance)/currentDistance;
+    const double nodeVolume = cellVolume[nodeID];
+    const double neighborVolume = cellVolume[neighborID];
+
+    double currentForce[3], neighborForce[3];
+    currentForce[0] = -temp*neighborVolume*dx;
+    currentForce[1] = -temp*neighborVolume*dy;
+    currentForce[2] = -temp*neighborVolume*dz;
+    neighborForce[0] = temp*nodeVolume*dx;
+    neighborForce[1] = temp*nodeVolume*dy;
+    neighborForce[2] = temp*nodeVolume*dz;
+
+    if(hasFriction){
+
+      // calculate the perpendicular velocity of each node wrt the vector between the nodes
+      const double normal[3] = {dx/currentDistance, dy/currentDistance, dz/currentDistance};
+      const double* nodeV = &velocity[nodeID*3];
+      const double* neighborV = &velocity[neighborID*3];
+      const double currentDotNormal = nodeV[0]*normal[0] + nodeV[1]*normal[1] + nodeV[2]*normal[2];
+      const double neighborDotNormal = neighborV[0]*normal[0] + neighborV[1]*normal[1] + neighborV[2]*normal[2];
+
+      // relative perpendicular velocities in the frame of the pair's perpendicular center-of-mass velocity
+      double nodeVrel[3], neighborVrel[3];
+      for(int dof=0 ; dof<3 ; ++dof){
+        const double nodeVperp = nodeV[dof] - currentDotNormal*normal[dof];
+        const double neighborVperp = neighborV[dof] - neighborDotNormal*normal[dof];
+        const double Vcm = 0.5*(nodeVperp + neighborVperp);
+        nodeVrel[dof] = nodeVperp - Vcm;
+        neighborVrel[dof] = neighborVperp - Vcm;
       }
+      const double normNodeVrel = sqrt(nodeVrel[0]*nodeVrel[0] + nodeVrel[1]*nodeVrel[1] + nodeVrel[2]*nodeVrel[2]);
+      const double normNeighborVrel = sqrt(neighborVrel[0]*neighborVrel[0] + neighborVrel[1]*neighborVrel[1] + neighborVrel[2]*neighborVrel[2]);
+
+      // friction forces are proportional to the magnitude of the normal forces
+      if(normNodeVrel != 0.0){
+        const double scale = -frictionCoefficient*temp*neighborVolume*currentDistance/normNodeVrel;
+        for(int dof=0 ; dof<3 ; ++dof)
+          currentForce[dof] += scale*nodeVrel[dof];
+      }
+      if(normNeighborVrel != 0.0){
+        const double scale = -frictionCoefficient*temp*nodeVolume*currentDistance/normNeighborVrel;
+        for(int dof=0 ; dof<3 ; ++dof)
+          neighborForce[dof] += scale*neighborVrel[dof];
+      }
+    }
+
+    for(int dof=0 ; dof<3 ; ++dof){
+      addContactForce(contactForce[nodeID*3+dof], currentForce[dof]);
+      addContactForce(contactForce[neighborID*3+dof], neighborForce[dof]);
     }
   }
 }
@@ -75,6 +75,12 @@ namespace PeridigmNS {
                  const int* contactNeighborhoodList,
                  PeridigmNS::DataManager& dataManager) const;
 
+    //! Evaluate the forces on the cells from a list of contact pairs.
+    virtual void
+    computeForce(const double dt,
+                 const PeridigmNS::ContactPairList& contactPairs,
+                 PeridigmNS::DataManager& dataManager) const;
+
     virtual void 
     evaluateParserFriction(double & currentValue, double & previousValue, const double & timeCurrent=0.0, const double & timePrevious=0.0);               
 
@@ -109,4 +115,18 @@ namespace PeridigmNS {
   };
 }
 
+namespace PeridigmNS {
+
+  //! Accumulate short-range contact force densities over a list of contact pairs, applying each pair's force to both points.
+  void computeShortRangeContactForce(const PeridigmNS::ContactPairList& contactPairs,
+                                     const double springCoefficient,
+                                     const double contactRadius,
+                                     const double horizon,
+                                     const double frictionCoefficient,
+                                     const double* cellVolume,
+                                     const double* y,
+                                     const double* velocity,
+                                     double* contactForce);
+}
+
 #endif // PERIDIGM_SHORTRANGEFORCECONTACTMODEL_HPP
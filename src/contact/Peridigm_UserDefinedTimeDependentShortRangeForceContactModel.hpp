@@ -49,13 +49,8 @@
 #define PERIDIGM_ADAPTIVESHORTRANGEFORCECONTACTMODEL_HPP
 
 #include "Peridigm_ContactModel.hpp"
-
-#include <Trilinos_version.h>
-#if TRILINOS_MAJOR_MINOR_VERSION >= 111100
-#include "RTC_FunctionRTC.hh"
-#else
-#include "FunctionRTC.hh"
-#endif
+#include "Peridigm_ShortRangeForceContactModel.hpp"
+#include "Peridigm_Expression.hpp"
 
 namespace PeridigmNS {
 
@@ -83,6 +78,12 @@ namespace PeridigmNS {
                  const int* ownedIDs,
                  const int* contactNeighborhoodList,
                  PeridigmNS::DataManager& dataManager) const;
+
+    //! Evaluate the forces on the cells from a list of contact pairs.
+    virtual void
+    computeForce(const double dt,
+                 const PeridigmNS::ContactPairList& contactPairs,
+                 PeridigmNS::DataManager& dataManager) const;
                  
     //! evaluate Parser
     virtual void 
@@ -113,8 +114,8 @@ namespace PeridigmNS {
     //! string defined funciton
     std::string functionfriction, checkfriction;
     
-    //! Run-time compiler, used as function parser
-    Teuchos::RCP<PG_RuntimeCompiler::Function> rtcFunction;
+    //! Compiled function parser
+    Teuchos::RCP<PeridigmNS::Expression> expression;
 
     // field ids for all relevant data
     std::vector<int> m_fieldIds;
@@ -55,6 +55,7 @@
 #include <vector>
 #include <map>
 #include <string>
+#include <algorithm>
 
 #include <boost/unordered_set.hpp>
 #include <boost/math/special_functions/fpclassify.hpp>
@@ -64,12 +65,14 @@
 #include "Peridigm_InfluenceFunction.hpp"
 #include "Peridigm_DiscretizationFactory.hpp"
 #include "Peridigm_OutputManager_ExodusII.hpp"
+#include "Peridigm_OutputManager_Probe.hpp"
 #include "Peridigm_ComputeManager.hpp"
 #include "Peridigm_ContactModelFactory.hpp"
 #include "Peridigm_BoundaryAndInitialConditionManager.hpp"
 #include "Peridigm_CriticalTimeStep.hpp"
 #include "Peridigm_CriticalThermalTimeStep.hpp"
 #include "Peridigm_Timer.hpp"
+#include "Peridigm_BondBreakageLog.hpp"
 #include "Peridigm_MaterialFactory.hpp"
 #include "Peridigm_DamageModelFactory.hpp"
 #include "Peridigm_InterfaceAwareDamageModel.hpp"
@@ -79,6 +82,9 @@
 #include "Peridigm.hpp"
 #include "correspondence.h" // For Invert3by3Matrix
 #include "Peridigm_DataManager.hpp" //For readBlocktoDisk & writeBlocktoDisk
+#include "Peridigm_PdQuickGridDiscretization.hpp"
+#include "Peridigm_ProximitySearch.hpp"
+#include "PdZoltan.h"
 #ifdef PERIDIGM_PV
   #include "Peridigm_PartialVolumeCalculator.hpp"
 #endif
@@ -91,6 +97,7 @@
 #include <Epetra_RowMatrixTransposer.h>
 #include <Ifpack.h>
 #include <Ifpack_IC.h>
+#include <ml_MultiLevelPreconditioner.h>
 #include <Teuchos_VerboseObject.hpp>
 
 // required for restart
@@ -112,6 +119,17 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
     hasThermalShock(false),
     computeIntersections(false),
     constructInterfaces(false),
+    multigridBaselineIterations(-1),
+    multigridRebuildRequested(false),
+    multigridRebuildFactor(2.0),
+    explicitTimeStep(0.0),
+    explicitTime(0.0),
+    explicitStep(0),
+    subcyclingFinalStep(0),
+    explicitThermalTimeStep(0.0),
+    explicitThermalStepInterval(1),
+    currentValue(0.0),
+    previousValue(0.0),
     deltaTemperatureFieldId(-1),
     numThermalDoFs(0), // MODIFIED NOTE
     blockIdFieldId(-1),
@@ -264,7 +282,7 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
     }
     if(solverParameters[i]->isParameter("Peridigm Preconditioner")){
       std::string peridigmPreconditionerType = solverParameters[i]->get<string>("Peridigm Preconditioner");
-      if(peridigmPreconditionerType == "Full Tangent")
+      if(peridigmPreconditionerType == "Full Tangent" || peridigmPreconditionerType == "Algebraic Multigrid")
         userSpecifiedFullTangent = true;
       // Note:  Currently, Peridigm must have some sort of tangent to avoid null pointer errors (\todo:  Fix this!)
       //        For the time being, if the users requests NOX with no precondioner, go ahead and allocate the 3x3
@@ -372,8 +390,6 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
 
     contactBlocks = contactManager->getContactBlocks();
 
-    double currentValue = 0.0;
-    double previousValue = 0.0;
     double timeCurrent = 0.0;
     double timePrevious =0.0;
 
@@ -459,8 +475,6 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
     blockIt->setMaterialModel(materialModel);
 
     // Set the damage model (if any)
-    double currentValue = 0.0;
-    double previousValue = 0.0;
     double timeCurrent = 0.0;
     double timePrevious = 0.0;
     string damageModelName = blockIt->getDamageModelName();
@@ -765,10 +779,16 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
   // Initialize output manager
   initializeOutputManager();
 
+  // Open the bond breakage log, if requested
+  if(peridigmParams->isSublist("Bond Breakage Log"))
+    PeridigmNS::BondBreakageLog::self().initialize(peridigmParams->sublist("Bond Breakage Log"), peridigmComm->MyPID(), peridigmComm->NumProc());
+
   // Call rebalance function if analysis has contact
   // this is required to set up proper contact neighbor list
-  if(analysisHasContact)
+  if(analysisHasContact){
+    contactManager->setMaterialBlocks(blocks);
     contactManager->rebalance(0);
+  }
 
   // Create service manager
   serviceManager = Teuchos::rcp(new PeridigmNS::ServiceManager());
@@ -829,7 +849,9 @@ void PeridigmNS::Peridigm::checkContactSearchRadius(const Teuchos::ParameterList
     TEUCHOS_TEST_FOR_EXCEPTION(true, Teuchos::Exceptions::InvalidParameter, "Contact parameter \"Search Radius\" not specified.");
 
   const double maxRatio = 10.0;  // TODO: this might need to be adjusted
-  const double contactRad = contactParams.get<double>("Search Radius");
+  double contactRad = contactParams.get<double>("Search Radius");
+  if(contactParams.isParameter("Skin Distance"))
+    contactRad += contactParams.get<double>("Skin Distance");
   const double maxRad = peridigmDisc->getMaxElementRadius();
 
   if(contactRad/maxRad >= maxRatio){
@@ -1304,11 +1326,13 @@ void PeridigmNS::Peridigm::initializeOutputManager() {
       outputParams->set("MyPID", (int)(peridigmComm->MyPID()));
       // Make the default format "ExodusII"
       string outputFormat = outputParams->get("Output File Type", "ExodusII");
-      TEUCHOS_TEST_FOR_EXCEPTION( outputFormat != "ExodusII",
+      TEUCHOS_TEST_FOR_EXCEPTION( outputFormat != "ExodusII" && outputFormat != "Probe",
                                   std::invalid_argument,
-                                  "PeridigmNS::Peridigm: \"Output File Type\" must be \"ExodusII\".");
+                                  "PeridigmNS::Peridigm: \"Output File Type\" must be \"ExodusII\" or \"Probe\".");
       if (outputFormat == "ExodusII")
         outputManager->add( Teuchos::rcp(new PeridigmNS::OutputManager_ExodusII( outputParams, this, blocks ) ) );
+      else if (outputFormat == "Probe")
+        outputManager->add( Teuchos::rcp(new PeridigmNS::OutputManager_Probe( outputParams, this, blocks ) ) );
     }
   }
 }
@@ -1329,11 +1353,22 @@ void PeridigmNS::Peridigm::execute(Teuchos::RCP<Teuchos::ParameterList> solverPa
   else if(solverParams->isSublist("Implicit"))
     executeImplicit(solverParams);
 
+  // Jacobian-free quasi-statics:  Dynamic Relaxation
+  else if(solverParams->isSublist("Dynamic Relaxation"))
+    executeDynamicRelaxation(solverParams);
+
+  flushOutput();
+
   PeridigmNS::Memstat * memstat = PeridigmNS::Memstat::Instance();
   const std::string statTag = "Post Execute";
   memstat->addStat(statTag);
 }
 
+void PeridigmNS::Peridigm::flushOutput() {
+  outputManager->flush();
+  PeridigmNS::BondBreakageLog::self().flush();
+}
+
 void PeridigmNS::Peridigm::executeSolvers() {
   for(unsigned int i=0 ; i<solverParameters.size() ; ++i){
     execute(solverParameters[i]);
@@ -1349,13 +1384,26 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
 
   // Compute the approximate critical time step
   double criticalTimeStep = 1.0e50;
+  vector<double> blockCriticalTimeSteps;
   for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
     double blockCriticalTimeStep = ComputeCriticalTimeStep(*peridigmComm, *blockIt);
+    blockCriticalTimeSteps.push_back(blockCriticalTimeStep);
     if(blockCriticalTimeStep < criticalTimeStep)
       criticalTimeStep = blockCriticalTimeStep;
   }
   double globalCriticalTimeStep;
   peridigmComm->MinAll(&criticalTimeStep, &globalCriticalTimeStep, 1);
+  // Optionally replace the bond-sum bound with a sharper power-iteration estimate of the maximum eigenfrequency
+  string timeStepEstimator = verletParams->get("Time Step Estimator", "Bond Sum");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(timeStepEstimator != "Bond Sum" && timeStepEstimator != "Power Iteration",
+                              "**** Error:  Unknown Time Step Estimator, valid options are \"Bond Sum\" and \"Power Iteration\".\n");
+  if(timeStepEstimator == "Power Iteration" && !verletParams->isParameter("Fixed dt")){
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(analysisHasMultiphysics, "**** Error:  The Power Iteration time step estimator is not multiphysics compatible.\n");
+    PeridigmNS::Timer::self().startTimer("Critical Time Step");
+    workset->timeStep = globalCriticalTimeStep;
+    globalCriticalTimeStep = computePowerIterationCriticalTimeStep(verletParams->sublist("Power Iteration"), globalCriticalTimeStep);
+    PeridigmNS::Timer::self().stopTimer("Critical Time Step");
+  }
   double dt = globalCriticalTimeStep;
   // Query for a user-supplied time step, which overrides the computed value
   double userDefinedTimeStep = 0.0;
@@ -1373,7 +1421,6 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
   double timeFinal   = solverParams->get("Final Time", 1.0);
   double timeCurrent = timeInitial;
   workset->timeStep = dt;
-  double dt2 = dt/2.0;
   int nsteps = static_cast<int>( floor((timeFinal-timeInitial)/dt) );
 
   // Check to make sure the number of time steps is sane
@@ -1386,6 +1433,76 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
     nsteps = INT_MAX;
   }
 
+  // Adaptive time step control:  the critical time step is periodically re-estimated from the current
+  // configuration and intact bonds, and the time step is grown (at a limited rate) or shrunk accordingly
+  bool adaptiveTimeStep = verletParams->isSublist("Adaptive Time Step");
+  int timeStepUpdateFrequency = 10;
+  double maxTimeStepGrowthFactor = 1.1;
+  double maxTimeStep = 1.0e50;
+  if(adaptiveTimeStep){
+    Teuchos::ParameterList& adaptiveParams = verletParams->sublist("Adaptive Time Step");
+    timeStepUpdateFrequency = adaptiveParams.get("Update Frequency", 10);
+    maxTimeStepGrowthFactor = adaptiveParams.get("Maximum Growth Factor", 1.1);
+    if(adaptiveParams.isParameter("Maximum Time Step"))
+      maxTimeStep = adaptiveParams.get<double>("Maximum Time Step");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(verletParams->isParameter("Fixed dt"), "**** Error:  Adaptive Time Step and Fixed dt cannot both be specified.\n");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(analysisHasThermal, "**** Error:  Adaptive Time Step is not compatible with thermal analyses.\n");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(timeStepUpdateFrequency < 1, "**** Error:  Adaptive Time Step Update Frequency must be at least one.\n");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(maxTimeStepGrowthFactor < 1.0, "**** Error:  Adaptive Time Step Maximum Growth Factor must be at least one.\n");
+    // The maximum time step also bounds the initial time step, which sets the output interval
+    if(dt > maxTimeStep){
+      dt = maxTimeStep;
+      workset->timeStep = dt;
+      nsteps = static_cast<int>( floor((timeFinal-timeInitial)/dt) );
+    }
+  }
+
+  // Multi-rate subcycling:  each block is advanced with its own time step, an integer multiple of the global time step.
+  // All points are drifted at the global time step, so the positions of points in coarse blocks are linearly
+  // interpolated between their force evaluations, and their forces are held constant over their macro step.
+  bool subcycling = verletParams->get("Subcycling", false);
+  int maxSubcycleRatio = verletParams->get("Maximum Subcycle Ratio", 16);
+  blockSubcycleRatio.clear();
+  pointBlockIndex.clear();
+  subcyclingFinalStep = nsteps;
+  if(subcycling){
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(analysisHasThermal, "**** Error:  Subcycling is not compatible with thermal analyses.\n");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(adaptiveTimeStep, "**** Error:  Subcycling is not compatible with Adaptive Time Step.\n");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(maxSubcycleRatio < 1, "**** Error:  Maximum Subcycle Ratio must be at least one.\n");
+    blockSubcycleRatio.resize(blocks->size(), 1);
+    pointBlockIndex.resize(oneDimensionalMap->NumMyElements(), 0);
+    int blockIndex = 0;
+    for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++, blockIndex++){
+      // Restrict the ratios to powers of two so that the macro steps of the blocks nest
+      double blockStableTimeStep = safetyFactor*blockCriticalTimeSteps[blockIndex];
+      int ratio = 1;
+      while(2*ratio <= maxSubcycleRatio && 2*ratio*dt <= blockStableTimeStep)
+        ratio *= 2;
+      blockSubcycleRatio[blockIndex] = ratio;
+      Teuchos::RCP<const Epetra_BlockMap> ownedScalarPointMap = blockIt->getOwnedScalarPointMap();
+      for(int i=0 ; i<ownedScalarPointMap->NumMyElements() ; ++i)
+        pointBlockIndex[oneDimensionalMap->LID(ownedScalarPointMap->GID(i))] = blockIndex;
+    }
+  }
+
+  // Dynamic load balancing:  the wall time spent in the internal force evaluation is measured on each processor,
+  // and the material blocks are repartitioned, weighted by unbroken bonds, when the imbalance exceeds the threshold
+  bool dynamicLoadBalance = verletParams->isSublist("Dynamic Load Balance") && peridigmComm->NumProc() > 1;
+  int loadBalanceCheckInterval = 100;
+  double loadBalanceImbalanceThreshold = 1.2;
+  double internalForceWallTime = 0.0;
+  if(dynamicLoadBalance){
+    Teuchos::ParameterList& loadBalanceParams = verletParams->sublist("Dynamic Load Balance");
+    loadBalanceCheckInterval = loadBalanceParams.get("Check Interval", 100);
+    loadBalanceImbalanceThreshold = loadBalanceParams.get("Imbalance Threshold", 1.2);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(loadBalanceCheckInterval < 1, "**** Error:  Dynamic Load Balance Check Interval must be at least one.\n");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(loadBalanceImbalanceThreshold < 1.0, "**** Error:  Dynamic Load Balance Imbalance Threshold must be at least one.\n");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(analysisHasMultiphysics, "**** Error:  Dynamic Load Balance is not compatible with multiphysics analyses.\n");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(analysisHasThermal, "**** Error:  Dynamic Load Balance is not compatible with thermal analyses.\n");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(subcycling, "**** Error:  Dynamic Load Balance is not compatible with Subcycling.\n");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(constructInterfaces, "**** Error:  Dynamic Load Balance is not compatible with interface construction.\n");
+  }
+
   // Write time step information to stdout
   if(peridigmComm->MyPID() == 0){
     cout << "Time step (seconds):" << endl;
@@ -1399,7 +1516,22 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
     else
       cout << "  Safety factor       not provided " << endl;
     cout << "  Time step           " << dt << "\n" << endl;
-    cout << "Total number of time steps " << nsteps << "\n" << endl;
+    if(subcycling){
+      cout << "Subcycling:" << endl;
+      int blockIndex = 0;
+      for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++, blockIndex++)
+        cout << "  " << blockIt->getName() << ":  stable time step " << blockCriticalTimeSteps[blockIndex]
+             << ", subcycle ratio " << blockSubcycleRatio[blockIndex] << endl;
+      cout << endl;
+    }
+    if(adaptiveTimeStep){
+      cout << "Adaptive time step:" << endl;
+      cout << "  Update frequency    " << timeStepUpdateFrequency << endl;
+      cout << "  Max growth factor   " << maxTimeStepGrowthFactor << "\n" << endl;
+      cout << "Estimated number of time steps " << nsteps << "\n" << endl;
+    }
+    else
+      cout << "Total number of time steps " << nsteps << "\n" << endl;
   }
 
   // Compute the approximate critical time step for the thermal problem
@@ -1470,22 +1602,8 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
 		}
 	}
 
-  // Pointer index into sub-vectors for use with BLAS
-  double *xPtr, *uPtr, *yPtr, *vPtr, *aPtr;
-  x->ExtractView( &xPtr );
-  u->ExtractView( &uPtr );
-  y->ExtractView( &yPtr );
-  v->ExtractView( &vPtr );
-  a->ExtractView( &aPtr );
-
-  double *deltaTemperaturePtr, *heatFlowPtr, *internalHeatSourcePtr;
-  deltaTemperature->ExtractView( &deltaTemperaturePtr );
-  if(analysisHasThermal){
-    heatFlow->ExtractView( &heatFlowPtr );
-    internalHeatSource->ExtractView( &internalHeatSourcePtr );
-  }
-
-  int length = a->MyLength();
+  explicitThermalTimeStep = Tdt;
+  explicitThermalStepInterval = static_cast<int>( floor(nsteps/nTsteps) );
 
   // Set the prescribed displacements (allow for nonzero initial displacements).
   // Then back compute the displacement vector.  Leave the velocity as zero.
@@ -1509,8 +1627,7 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
   // \todo The velocity copied into the DataManager is actually the midstep velocity, not the NP1 velocity; this can be fixed by creating a midstep velocity field in the DataManager and setting the NP1 value as invalid.
 
   Teuchos::RCP< map< string, vector<int> > > nodeSets = boundaryAndInitialConditionManager->getNodeSets();
-  vector<int> thermalShockNodeList;
-  vector<int> localThermalShockNodeList;
+  localThermalShockNodeList.clear();
 
   if (analysisHasThermal && hasThermalShock){
     vector<int>& thermalShockNodeList = (*nodeSets)["THERMAL_SHOCK_NODE_SET"];
@@ -1570,6 +1687,11 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
     (*a)[i] += (*externalForce)[i];
     (*a)[i] /= (*density)[i/3];
   }
+  // With an adaptive time step the step count is not known in advance, so output is scheduled by time
+  // at multiples of the output frequency times the initial time step
+  if(adaptiveTimeStep)
+    outputManager->scheduleOutputByTime(timeInitial, dt);
+
   // Write initial configuration to disk
   PeridigmNS::Timer::self().startTimer("Output");
   synchDataManagers();
@@ -1579,169 +1701,867 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
   int displayTrigger = nsteps/100;
   if(displayTrigger == 0)
     displayTrigger = 1;
+  int displayedPercent = -1;
+
+  // Time step allowed by the stability estimate, the step actually taken may be shortened to land on an output time
+  double adaptiveDt = dt;
+
+  for(int step=1; adaptiveTimeStep ? (timeCurrent < timeFinal) : (step<=nsteps); step++){
+
+    double timePrevious = timeCurrent;
+    if(adaptiveTimeStep){
+      // Re-estimate the stable time step from the current configuration
+      if(step > 1 && (step-1)%timeStepUpdateFrequency == 0){
+        PeridigmNS::Timer::self().startTimer("Critical Time Step");
+        double stableTimeStep = safetyFactor*ComputeCurrentCriticalTimeStep(*peridigmComm, *blocks);
+        PeridigmNS::Timer::self().stopTimer("Critical Time Step");
+        // Shrink immediately if required for stability, otherwise grow at a limited rate
+        adaptiveDt = std::min(stableTimeStep, maxTimeStepGrowthFactor*adaptiveDt);
+        adaptiveDt = std::min(adaptiveDt, maxTimeStep);
+      }
+      // Truncate the step to land exactly on the next output time or the final time
+      double timeTarget = std::min(timeFinal, outputManager->nextOutputTime(timeCurrent));
+      if(timeCurrent + adaptiveDt >= timeTarget - 1.0e-12*adaptiveDt){
+        dt = timeTarget - timeCurrent;
+        timeCurrent = timeTarget;
+      }
+      else{
+        dt = adaptiveDt;
+        timeCurrent += dt;
+      }
+    }
+    else
+      timeCurrent = timeInitial + (step*dt);
+
+    if(adaptiveTimeStep){
+      int percent = static_cast<int>( floor((timePrevious-timeInitial)*100.0/(timeFinal-timeInitial)) );
+      if(percent > displayedPercent){
+        displayProgress("Explicit time integration", (timePrevious-timeInitial)*100.0/(timeFinal-timeInitial));
+        displayedPercent = percent;
+      }
+    }
+    else if((step-1)%displayTrigger==0)
+      displayProgress("Explicit time integration", (step-1)*100.0/nsteps);
+
+    // Dynamic load balancing; contact rebalancing is done within the step
+    if(dynamicLoadBalance && step > 1 && (step-1)%loadBalanceCheckInterval == 0){
+      PeridigmNS::Timer::self().startTimer("Rebalance");
+      double maxInternalForceWallTime, sumInternalForceWallTime;
+      peridigmComm->MaxAll(&internalForceWallTime, &maxInternalForceWallTime, 1);
+      peridigmComm->SumAll(&internalForceWallTime, &sumInternalForceWallTime, 1);
+      internalForceWallTime = 0.0;
+      double averageInternalForceWallTime = sumInternalForceWallTime/peridigmComm->NumProc();
+      if(averageInternalForceWallTime > 0.0 && maxInternalForceWallTime/averageInternalForceWallTime > loadBalanceImbalanceThreshold){
+        if(peridigmComm->MyPID() == 0)
+          cout << "\nInternal force imbalance " << maxInternalForceWallTime/averageInternalForceWallTime << " at step " << step << endl;
+        rebalanceBlocks();
+      }
+      PeridigmNS::Timer::self().stopTimer("Rebalance");
+    }
+
+    internalForceWallTime += explicitVerletStep(step, timeCurrent, timePrevious, dt);
+  }
+  displayProgress("Explicit time integration", 100.0);
+  *out << "\n\n";
+}
+
+double PeridigmNS::Peridigm::explicitVerletStep(int step, double timeCurrent, double timePrevious, double dt)
+{
+  workset->timeStep = dt;
+  double dt2 = dt/2.0;
+
+  // Pointer index into sub-vectors for use with BLAS; extracted on every step because rebalancing reallocates the mothership vectors
+  double *xPtr, *uPtr, *yPtr, *vPtr, *aPtr;
+  x->ExtractView( &xPtr );
+  u->ExtractView( &uPtr );
+  y->ExtractView( &yPtr );
+  v->ExtractView( &vPtr );
+  a->ExtractView( &aPtr );
+  int length = a->MyLength();
+
+  double *deltaTemperaturePtr, *heatFlowPtr, *internalHeatSourcePtr;
+  deltaTemperature->ExtractView( &deltaTemperaturePtr );
+  if(analysisHasThermal){
+    heatFlow->ExtractView( &heatFlowPtr );
+    internalHeatSource->ExtractView( &internalHeatSourcePtr );
+  }
+  bool thermalStep = analysisHasThermal && fmod(step, explicitThermalStepInterval) == 0;
+
+  PeridigmNS::BondBreakageLog::self().setStep(step, timeCurrent);
 
   Teuchos::ParameterList damageModelParams;
   if(peridigmParams->isSublist("Damage Models"))
     damageModelParams = peridigmParams->sublist("Damage Models");
   DamageModelFactory damageModelFactory;
+  for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
+    string damageModelName = blockIt->getDamageModelName();
+    if(damageModelName != "None"){
+       Teuchos::ParameterList damageParams = damageModelParams.sublist(damageModelName, true);
+       Teuchos::RCP<PeridigmNS::DamageModel> damageModel = damageModelFactory.create(damageParams);
+       blockIt->setDamageModel(damageModel);
+       if(damageModel->Name() == "Time Dependent Critical Stretch"){
+         CSDamageModel = Teuchos::rcp_dynamic_cast< PeridigmNS::UserDefinedTimeDependentCriticalStretchDamageModel >(damageModel);
+         CSDamageModel->evaluateParserDmg(currentValue, previousValue, timeCurrent, timePrevious);
+       }
+    }
+  }
 
-  double currentValue = 0.0;
-  double previousValue = 0.0;
+  // rebalance, if requested
+  PeridigmNS::Timer::self().startTimer("Rebalance");
+  // \todo Should we load updated information first?  If so, only do this if we're really going to rebalance.
+  if(analysisHasContact)
+    contactManager->rebalance(step);
+  PeridigmNS::Timer::self().stopTimer("Rebalance");
+
+  // Do one step of velocity-Verlet
+
+  int numBlocks = static_cast<int>(blocks->size());
+  vector<int> blockMacroStepLength(numBlocks, 1);
+  vector<int> blockIsStarting(numBlocks, 1);
+  vector<int> blockIsEnding(numBlocks, 1);
+  vector<double> blockTimeSteps(numBlocks, dt);
+  bool subcycling = !blockSubcycleRatio.empty();
+  if(subcycling){
+    // Determine the macro step of each block; the final macro step is truncated at the final time
+    for(int b=0 ; b<numBlocks ; ++b){
+      int ratio = blockSubcycleRatio[b];
+      int macroStepStart = ((step-1)/ratio)*ratio + 1;
+      blockMacroStepLength[b] = std::min(ratio, subcyclingFinalStep - macroStepStart + 1);
+      blockIsStarting[b] = (step == macroStepStart);
+      blockIsEnding[b] = (step == macroStepStart + blockMacroStepLength[b] - 1);
+      blockTimeSteps[b] = blockIsEnding[b] ? blockMacroStepLength[b]*dt : 0.0;
+    }
+    // V^{n+m/2} = V^{n} + (m*dt/2)*A^{n} for points in blocks starting a macro step
+    for(int i=0 ; i<length ; ++i){
+      int b = pointBlockIndex[i/3];
+      if(blockIsStarting[b])
+        vPtr[i] += blockMacroStepLength[b]*dt2*aPtr[i];
+    }
+  }
+  else{
+    // V^{n+1/2} = V^{n} + (dt/2)*A^{n}
+    // blas.AXPY(const int N, const double ALPHA, const double *X, double *Y, const int INCX=1, const int INCY=1) const
+    blas.AXPY(length, dt2, aPtr, vPtr, 1, 1);
+  }
+
+  // Set the velocities for dof with kinematic boundary conditions.
+  // This will propagate through the Verlet integrator and result in the proper
+  // displacement boundary conditions on y and consistent values for v and u.
+  PeridigmNS::Timer::self().startTimer("Apply Kinematic B.C.");
+  boundaryAndInitialConditionManager->applyBoundaryConditions(timeCurrent, timePrevious);
+  PeridigmNS::Timer::self().stopTimer("Apply Kinematic B.C.");
+
+  // evaluate the external (body) forces:
+  PeridigmNS::Timer::self().startTimer("Apply Body Forces");
+  boundaryAndInitialConditionManager->applyForceContributions(timeCurrent, 0.0); // external forces are dirichlet BCs so the previous time is defaulted to 0.0
+  PeridigmNS::Timer::self().stopTimer("Apply Body Forces");
 
-  const int deltaStep =  static_cast<int>( floor(nsteps/nTsteps) );
+  // Y^{n+1} = X_{o} + U^{n} + (dt)*V^{n+1/2}
+  // TODO Replace with blas call
+  for(int i=0 ; i<y->MyLength() ; ++i)
+    yPtr[i] = xPtr[i] + uPtr[i] + dt*vPtr[i];
 
-  for(int step=1; step<=nsteps; step++){
+  // U^{n+1} = U^{n} + (dt)*V^{n+1/2}
+  // blas.AXPY(const int N, const double ALPHA, const double *X, double *Y, const int INCX=1, const int INCY=1) const
+  blas.AXPY(length, dt, vPtr, uPtr, 1, 1);
 
-    double timePrevious = timeCurrent;
-    timeCurrent = timeInitial + (step*dt);
+  // TODO The velocity copied into the DataManager is actually the midstep velocity, not the NP1 velocity; this can be fixed by creating a midstep velocity field in the DataManager and setting the NP1 value as invalid.
 
-    for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-      string damageModelName = blockIt->getDamageModelName();
-      if(damageModelName != "None"){
-         Teuchos::ParameterList damageParams = damageModelParams.sublist(damageModelName, true);
-         Teuchos::RCP<PeridigmNS::DamageModel> damageModel = damageModelFactory.create(damageParams);
-         blockIt->setDamageModel(damageModel);
-         if(damageModel->Name() == "Time Dependent Critical Stretch"){
-           CSDamageModel = Teuchos::rcp_dynamic_cast< PeridigmNS::UserDefinedTimeDependentCriticalStretchDamageModel >(damageModel);
-           CSDamageModel->evaluateParserDmg(currentValue, previousValue, timeCurrent, timePrevious);
-         }
+  // Copy data from mothership vectors to overlap vectors in data manager
+  PeridigmNS::Timer::self().startTimer("Gather/Scatter");
+  double* horizonPtr;
+  horizon->ExtractView(&horizonPtr);
+  if(thermalStep){
+    const double Tdt = explicitThermalTimeStep;
+    if (hasThermalShock){
+      for (size_t i=0; i<localThermalShockNodeList.size(); i++){
+        int j = localThermalShockNodeList[i];
+        deltaTemperaturePtr[j] += Tdt/((*density)[j]*(*specificHeat)[j])* ( (*convectionConstant)[j]*(-deltaTemperaturePtr[j] + (*fluidTemperature)[j])/(horizonPtr[j]) + internalHeatSourcePtr[j] );
       }
     }
+    for (int j=0; j<heatFlow->MyLength(); j++)
+      deltaTemperaturePtr[j] += Tdt/((*density)[j]*(*specificHeat)[j])*( heatFlowPtr[j]/(horizonPtr[j]) + (*density)[j]*internalHeatSourcePtr[j] );
+  }
+  for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
+    blockIt->importData(*u, displacementFieldId, PeridigmField::STEP_NP1, Insert);
+    blockIt->importData(*y, coordinatesFieldId, PeridigmField::STEP_NP1, Insert);
+    blockIt->importData(*v, velocityFieldId, PeridigmField::STEP_NP1, Insert);
+    blockIt->importData(*deltaTemperature, deltaTemperatureFieldId, PeridigmField::STEP_NP1, Insert);
+  }
 
-    if((step-1)%displayTrigger==0)
-      displayProgress("Explicit time integration", (step-1)*100.0/nsteps);
+  if(analysisHasContact){
+    if(contactModel->Name() == "Time-Dependent Short-Range Force"){
+      for(contactBlockIt = contactBlocks->begin() ; contactBlockIt != contactBlocks->end() ; contactBlockIt++) {
+        New_contactModel->evaluateParserFriction(currentValue, previousValue, timeCurrent, timePrevious);
+      }
+    }
+    contactManager->importData(volume, y, v);
+  }
+  PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
 
-    // rebalance, if requested
-    PeridigmNS::Timer::self().startTimer("Rebalance");
-    // \todo Should we load updated information first?  If so, only do this if we're really going to rebalance.
-    if(analysisHasContact)
-      contactManager->rebalance(step);
-    PeridigmNS::Timer::self().stopTimer("Rebalance");
+  // Update forces based on new positions
+  // When subcycling, only blocks completing a macro step are evaluated; the others retain their previous forces
+  PeridigmNS::Timer::self().startTimer("Internal Force");
+  Epetra_Time internalForceTimer(*peridigmComm);
+  if(subcycling)
+    modelEvaluator->evalModel(workset, blockTimeSteps);
+  else
+    modelEvaluator->evalModel(workset);
+  double internalForceWallTime = internalForceTimer.ElapsedTime();
+  PeridigmNS::Timer::self().stopTimer("Internal Force");
 
-    // Do one step of velocity-Verlet
+  // Copy force from the data manager to the mothership vector
+  PeridigmNS::Timer::self().startTimer("Gather/Scatter");
+  force->PutScalar(0.0);
+  if(thermalStep){
+// 			Copy heat flow from the data manager to the mothership vector
+			PeridigmNS::Timer::self().startTimer("Heat Flow");
+			modelEvaluator->evalHeatFlow(workset);
+			PeridigmNS::Timer::self().stopTimer("Heat Flow");
 
-    // V^{n+1/2} = V^{n} + (dt/2)*A^{n}
-    // blas.AXPY(const int N, const double ALPHA, const double *X, double *Y, const int INCX=1, const int INCY=1) const
+// 			Copy heat flow from the data manager to the mothership vector
+			heatFlow->PutScalar(0.0); // MODIFIED NOTE
+		}
+  for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
+    scratch->PutScalar(0.0);
+    blockIt->exportData(*scratch, forceDensityFieldId, PeridigmField::STEP_NP1, Add);
+    force->Update(1.0, *scratch, 1.0);
+    if(thermalStep){
+					scratchOneD->PutScalar(0.0);
+					blockIt->exportData(*scratchOneD, heatFlowFieldId, PeridigmField::STEP_NP1, Add);
+					heatFlow->Update(1.0, *scratchOneD, 1.0);
+			}
+  }
+  PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
+
+  // Check for NaNs in heat flow evaluation
+		if(analysisHasThermal){
+			for(int i=0 ; i<heatFlow->MyLength() ; ++i)
+				TEUCHOS_TEST_FOR_EXCEPT_MSG(!boost::math::isfinite((heatFlowPtr)[i]), "**** NaN returned by heat flow evaluation.\n");
+		}
+  // Check for NaNs in force evaluation
+  // We'd like to know now because a NaN will likely cause a difficult-to-unravel crash downstream.
+  for(int i=0 ; i<force->MyLength() ; ++i)
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(!boost::math::isfinite((*force)[i]), "**** NaN returned by force evaluation.\n");
+
+  // Check for NaNs in force evaluation
+  // We'd like to know now because a NaN will likely cause a difficult-to-unravel crash downstream.
+  for(int i=0 ; i<externalForce->MyLength() ; ++i)
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(!boost::math::isfinite((*externalForce)[i]), "**** NaN returned by external force evaluation.\n");
+
+  if(analysisHasContact){
+    contactManager->exportData(contactForce);
+    // Check for NaNs in contact force evaluation
+    for(int i=0 ; i<contactForce->MyLength() ; ++i)
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(!boost::math::isfinite((*contactForce)[i]), "**** NaN returned by contact force evaluation.\n");
+    // Add contact forces to forces
+    force->Update(1.0, *contactForce, 1.0);
+  }
+
+  // fill the acceleration vector
+  (*a) = (*force);
+  for(int i=0 ; i<a->MyLength() ; ++i){
+    (*a)[i] += (*externalForce)[i];
+    (*a)[i] /= (*density)[i/3];
+  }
+
+  if(subcycling){
+    // V^{n+m} = V^{n+m/2} + (m*dt/2)*A^{n+m} for points in blocks completing a macro step
+    for(int i=0 ; i<length ; ++i){
+      int b = pointBlockIndex[i/3];
+      if(blockIsEnding[b])
+        vPtr[i] += blockMacroStepLength[b]*dt2*aPtr[i];
+    }
+  }
+  else{
+    // V^{n+1}   = V^{n+1/2} + (dt/2)*A^{n+1}
+    //blas.AXPY(const int N, const double ALPHA, const double *X, double *Y, const int INCX=1, const int INCY=1) const
     blas.AXPY(length, dt2, aPtr, vPtr, 1, 1);
+  }
+
+  PeridigmNS::Timer::self().startTimer("Output");
+  synchDataManagers();
+  outputManager->write(blocks, timeCurrent);
+  PeridigmNS::Timer::self().stopTimer("Output");
+
+  // swap state N and state NP1
+  // When subcycling, blocks in the middle of a macro step keep state N from the start of the macro step
+  int blockIndex = 0;
+  for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++, blockIndex++){
+    if(blockIsEnding[blockIndex]){
+      blockIt->updateState();
+      // Blocks skipped on the following substeps export Force_Density STEP_NP1, which the swap
+      // has just pointed at the force from the previous macro step; hold the force computed
+      // at the end of this macro step instead
+      if(subcycling && blockSubcycleRatio[blockIndex] > 1)
+        blockIt->getData(forceDensityFieldId, PeridigmField::STEP_NP1)->Update(1.0, *blockIt->getData(forceDensityFieldId, PeridigmField::STEP_N), 0.0);
+    }
+  }
+
+  return internalForceWallTime;
+}
+
+double PeridigmNS::Peridigm::computePowerIterationCriticalTimeStep(Teuchos::ParameterList& powerIterationParams, double bondSumCriticalTimeStep) {
+
+  // Estimate the largest eigenvalue of M^{-1} K by power iteration on the symmetric matrix A = M^{-1/2} K M^{-1/2},
+  // where the action of K on a vector s is approximated by a directional difference of the internal force,
+  // K s ~ -( f(u + eps*s) - f(u) )/eps.  The critical time step for the central difference scheme is dt = 2/omega_max.
+  //
+  // The iteration stops when the residual of the Rayleigh quotient, ||A q - lambda q||, is small relative to lambda,
+  // and the estimate lambda + ||A q - lambda q|| is used so that an unconverged mode errs on the side of a smaller
+  // time step.  The bond-sum time step corresponds to the Gershgorin bound 4/dt^2 on the largest eigenvalue, which
+  // caps the estimate and is used outright if the iteration does not converge.
+
+  int maxIterations = powerIterationParams.get("Maximum Iterations", 100);
+  double tolerance = powerIterationParams.get("Tolerance", 1.0e-3);
+  double margin = powerIterationParams.get("Margin", 0.95);
+  double perturbationScale = powerIterationParams.get("Perturbation Scale", 1.0e-6);
+
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(bondSumCriticalTimeStep <= 0.0, "**** Error:  Power iteration for the critical time step requires a positive bond-sum time step.\n");
+  double eigenvalueBound = 4.0/(bondSumCriticalTimeStep*bondSumCriticalTimeStep);
+
+  // Size the perturbation relative to the horizon
+  double maxHorizon;
+  horizon->MaxValue(&maxHorizon);
+
+  Epetra_Vector uInitial(*u);
+  Epetra_Vector forceInitial(force->Map());
+  Epetra_Vector q(*threeDimensionalMap);
+  Epetra_Vector w(*threeDimensionalMap);
+  Epetra_Vector s(*threeDimensionalMap);
+  Epetra_Vector inverseSqrtMass(*threeDimensionalMap);
+  double *xPtr, *uPtr, *yPtr, *forcePtr, *forceInitialPtr, *qPtr, *wPtr, *sPtr, *inverseSqrtMassPtr, *uInitialPtr;
+  x->ExtractView( &xPtr );
+  u->ExtractView( &uPtr );
+  y->ExtractView( &yPtr );
+  force->ExtractView( &forcePtr );
+  forceInitial.ExtractView( &forceInitialPtr );
+  q.ExtractView( &qPtr );
+  w.ExtractView( &wPtr );
+  s.ExtractView( &sPtr );
+  inverseSqrtMass.ExtractView( &inverseSqrtMassPtr );
+  uInitial.ExtractView( &uInitialPtr );
+  int length = u->MyLength();
+
+  for(int i=0 ; i<length ; ++i)
+    inverseSqrtMassPtr[i] = 1.0/sqrt((*density)[i/3]*(*volume)[i/3]);
+
+  // Internal force (not force density) in the initial configuration; the damage models are not evaluated here or
+  // for the perturbed configurations, so the bond damage is left untouched
+  for(int i=0 ; i<length ; ++i)
+    yPtr[i] = xPtr[i] + uPtr[i];
+  computeInternalForce(false);
+  forceInitial = *force;
+
+  // Random starting vector
+  q.Random();
+  double norm;
+  q.Norm2(&norm);
+  q.Scale(1.0/norm);
+
+  double eigenvalue = 0.0;
+  double residualNorm = 0.0;
+  bool converged = false;
+  int iteration;
+  for(iteration=1 ; iteration<=maxIterations ; ++iteration){
+
+    // Perturbed configuration along s = M^{-1/2} q
+    s.Multiply(1.0, inverseSqrtMass, q, 0.0);
+    double sNorm;
+    s.NormInf(&sNorm);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(sNorm <= 0.0, "**** Error:  Power iteration for the critical time step produced a zero vector.\n");
+    double epsilon = perturbationScale*maxHorizon/sNorm;
+    for(int i=0 ; i<length ; ++i){
+      uPtr[i] = uInitialPtr[i] + epsilon*sPtr[i];
+      yPtr[i] = xPtr[i] + uPtr[i];
+    }
+    computeInternalForce(false);
+
+    // w <- M^{-1/2} K M^{-1/2} q
+    for(int i=0 ; i<length ; ++i)
+      wPtr[i] = -inverseSqrtMassPtr[i]*(forcePtr[i] - forceInitialPtr[i])/epsilon;
+
+    // Rayleigh quotient and residual for the unit vector q
+    w.Dot(q, &eigenvalue);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(eigenvalue <= 0.0, "**** Error:  Power iteration for the critical time step produced a nonpositive eigenvalue.\n");
+    s.Update(1.0, w, -eigenvalue, q, 0.0);
+    s.Norm2(&residualNorm);
+
+    w.Norm2(&norm);
+    q.Update(1.0/norm, w, 0.0);
+
+    if(residualNorm < tolerance*eigenvalue){
+      converged = true;
+      break;
+    }
+  }
+  if(iteration > maxIterations)
+    iteration = maxIterations;
+
+  // Restore the initial state
+  *u = uInitial;
+  for(int i=0 ; i<length ; ++i)
+    yPtr[i] = xPtr[i] + uPtr[i];
+  force->PutScalar(0.0);
+
+  double eigenvalueEstimate = eigenvalue + residualNorm;
+  if(!converged || eigenvalueEstimate > eigenvalueBound)
+    eigenvalueEstimate = eigenvalueBound;
+
+  double omegaMax = sqrt(eigenvalueEstimate);
+  double criticalTimeStep = margin*2.0/omegaMax;
+
+  if(peridigmComm->MyPID() == 0){
+    cout << "Power iteration estimate of the critical time step:" << endl;
+    cout << "  Iterations          " << iteration << endl;
+    if(!converged)
+      cout << "  Not converged, using the bond-sum estimate" << endl;
+    cout << "  Relative residual   " << residualNorm/eigenvalue << endl;
+    cout << "  Max eigenfrequency  " << omegaMax << endl;
+    cout << "  Margin              " << margin << endl;
+    cout << "  Critical time step  " << criticalTimeStep << "\n" << endl;
+  }
+
+  return criticalTimeStep;
+}
+
+void PeridigmNS::Peridigm::rebalanceBlocks() {
+
+  const Epetra_Comm& comm = oneDimensionalMap->Comm();
+  int numOwnedPoints = oneDimensionalMap->NumMyElements();
+
+  // The cost of a point is taken as the number of unbroken bonds, plus one for the point itself
+  vector<double> pointWeights(numOwnedPoints > 0 ? numOwnedPoints : 1, 1.0);
+  PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
+  int bondDamageFieldId = fieldManager.hasField("Bond_Damage") ? fieldManager.getFieldId("Bond_Damage") : -1;
+  for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
+    Teuchos::RCP<NeighborhoodData> neighborhoodData = blockIt->getNeighborhoodData();
+    Teuchos::RCP<const Epetra_BlockMap> blockOwnedMap = blockIt->getOwnedScalarPointMap();
+    const int* neighborhoodList = neighborhoodData->NeighborhoodList();
+    double* bondDamage(0);
+    if(bondDamageFieldId != -1 && blockIt->hasData(bondDamageFieldId, PeridigmField::STEP_NP1))
+      blockIt->getData(bondDamageFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondDamage);
+    int neighborhoodListIndex = 0;
+    int bondIndex = 0;
+    for(int iID=0 ; iID<neighborhoodData->NumOwnedPoints() ; ++iID){
+      int numNeighbors = neighborhoodList[neighborhoodListIndex++];
+      neighborhoodListIndex += numNeighbors;
+      int numActiveBonds = numNeighbors;
+      if(bondDamage != 0){
+        for(int iNID=0 ; iNID<numNeighbors ; ++iNID){
+          if(bondDamage[bondIndex + iNID] >= 1.0)
+            numActiveBonds -= 1;
+        }
+      }
+      bondIndex += numNeighbors;
+      int mothershipLocalID = oneDimensionalMap->LID(blockOwnedMap->GID(iID));
+      pointWeights[mothershipLocalID] += numActiveBonds;
+    }
+  }
+
+  // Partition the current configuration
+  int dimension = 3;
+  QUICKGRID::Data decomp = QUICKGRID::allocatePdGridData(numOwnedPoints, dimension);
+  decomp.globalNumPoints = oneDimensionalMap->NumGlobalElements();
+  UTILITIES::Array<int> myGlobalIDs(numOwnedPoints);
+  UTILITIES::Array<double> myX(numOwnedPoints*dimension);
+  UTILITIES::Array<double> cellVolume(numOwnedPoints);
+  if(numOwnedPoints > 0){
+    double *yPtr, *volumePtr;
+    y->ExtractView(&yPtr);
+    volume->ExtractView(&volumePtr);
+    memcpy(myGlobalIDs.get(), oneDimensionalMap->MyGlobalElements(), numOwnedPoints*sizeof(int));
+    memcpy(myX.get(), yPtr, numOwnedPoints*dimension*sizeof(double));
+    memcpy(cellVolume.get(), volumePtr, numOwnedPoints*sizeof(double));
+  }
+  decomp.myGlobalIDs = myGlobalIDs.get_shared_ptr();
+  decomp.myX = myX.get_shared_ptr();
+  decomp.cellVolume = cellVolume.get_shared_ptr();
+
+  double imbalanceBefore, imbalanceAfter;
+  decomp = PDNEIGH::getWeightedLoadBalancedDiscretization(decomp, &pointWeights[0], imbalanceBefore, imbalanceAfter);
+
+  Teuchos::RCP<const Epetra_BlockMap> rebalancedOneDimensionalMap =
+    Teuchos::rcp(new Epetra_BlockMap(PdQuickGridDiscretization::getOwnedMap(comm, decomp, 1)));
+  Teuchos::RCP<const Epetra_BlockMap> rebalancedThreeDimensionalMap =
+    Teuchos::rcp(new Epetra_BlockMap(PdQuickGridDiscretization::getOwnedMap(comm, decomp, 3)));
+
+  // Migrate the global neighborhood list; the order of the neighbors of each point is preserved,
+  // which allows the bond data in the blocks to be migrated element by element
+  Teuchos::RCP<Epetra_BlockMap> rebalancedOneDimensionalOverlapMap;
+  int rebalancedNeighborListSize(0);
+  int* rebalancedNeighborList(0);
+  ProximitySearch::RebalanceNeighborhoodList(oneDimensionalMap,
+                                             oneDimensionalOverlapMap,
+                                             globalNeighborhoodData->NeighborhoodListSize(),
+                                             globalNeighborhoodData->NeighborhoodList(),
+                                             rebalancedOneDimensionalMap,
+                                             rebalancedOneDimensionalOverlapMap,
+                                             rebalancedNeighborListSize,
+                                             rebalancedNeighborList);
+
+  int rebalancedNumOwnedPoints = rebalancedOneDimensionalMap->NumMyElements();
+  Teuchos::RCP<NeighborhoodData> rebalancedNeighborhoodData = Teuchos::rcp(new NeighborhoodData);
+  rebalancedNeighborhoodData->SetNumOwned(rebalancedNumOwnedPoints);
+  rebalancedNeighborhoodData->SetNeighborhoodListSize(rebalancedNeighborListSize);
+  if(rebalancedNeighborListSize > 0)
+    memcpy(rebalancedNeighborhoodData->NeighborhoodList(), rebalancedNeighborList, rebalancedNeighborListSize*sizeof(int));
+  delete[] rebalancedNeighborList;
+
+  // Create the bond map, points with no neighbors have no entry in the bond map
+  int* ownedIDs = rebalancedNeighborhoodData->OwnedIDs();
+  int* neighborhoodPtr = rebalancedNeighborhoodData->NeighborhoodPtr();
+  int* neighborhoodList = rebalancedNeighborhoodData->NeighborhoodList();
+  vector<int> bondMapGlobalIDs;
+  vector<int> bondMapElementSizes;
+  int neighborhoodListIndex = 0;
+  for(int i=0 ; i<rebalancedNumOwnedPoints ; ++i){
+    ownedIDs[i] = i;
+    neighborhoodPtr[i] = neighborhoodListIndex;
+    int numNeighbors = neighborhoodList[neighborhoodListIndex];
+    if(numNeighbors > 0){
+      bondMapGlobalIDs.push_back(rebalancedOneDimensionalMap->GID(i));
+      bondMapElementSizes.push_back(numNeighbors);
+    }
+    neighborhoodListIndex += 1 + numNeighbors;
+  }
+  int* bondMapGlobalIDsPtr = bondMapGlobalIDs.size() > 0 ? &bondMapGlobalIDs[0] : 0;
+  int* bondMapElementSizesPtr = bondMapElementSizes.size() > 0 ? &bondMapElementSizes[0] : 0;
+  Teuchos::RCP<const Epetra_BlockMap> rebalancedBondMap =
+    Teuchos::rcp(new Epetra_BlockMap(-1, static_cast<int>(bondMapGlobalIDs.size()), bondMapGlobalIDsPtr, bondMapElementSizesPtr, 0, comm));
+
+  Teuchos::RCP<const Epetra_BlockMap> rebalancedThreeDimensionalOverlapMap =
+    Teuchos::rcp(new Epetra_BlockMap(-1,
+                                     rebalancedOneDimensionalOverlapMap->NumMyElements(),
+                                     rebalancedOneDimensionalOverlapMap->MyGlobalElements(),
+                                     3,
+                                     0,
+                                     comm));
+
+  // Migrate the mothership vectors and reset the views into them
+  Teuchos::RCP<Epetra_MultiVector> rebalancedOneDimensionalMothership =
+    Teuchos::rcp(new Epetra_MultiVector(*rebalancedOneDimensionalMap, oneDimensionalMothership->NumVectors()));
+  Epetra_Import oneDimensionalImporter(*rebalancedOneDimensionalMap, *oneDimensionalMap);
+  rebalancedOneDimensionalMothership->Import(*oneDimensionalMothership, oneDimensionalImporter, Insert);
+
+  Teuchos::RCP<Epetra_MultiVector> rebalancedThreeDimensionalMothership =
+    Teuchos::rcp(new Epetra_MultiVector(*rebalancedThreeDimensionalMap, threeDimensionalMothership->NumVectors()));
+  Epetra_Import threeDimensionalImporter(*rebalancedThreeDimensionalMap, *threeDimensionalMap);
+  rebalancedThreeDimensionalMothership->Import(*threeDimensionalMothership, threeDimensionalImporter, Insert);
+
+  Teuchos::RCP<const Epetra_BlockMap> currentOneDimensionalMap = oneDimensionalMap;
+
+  oneDimensionalMap = rebalancedOneDimensionalMap;
+  threeDimensionalMap = rebalancedThreeDimensionalMap;
+  oneDimensionalOverlapMap = rebalancedOneDimensionalOverlapMap;
+  bondMap = rebalancedBondMap;
+  globalNeighborhoodData = rebalancedNeighborhoodData;
+
+  oneDimensionalMothership = rebalancedOneDimensionalMothership;
+  blockIDs = Teuchos::rcp((*oneDimensionalMothership)(0), false);         // block ID
+  horizon = Teuchos::rcp((*oneDimensionalMothership)(1), false);          // horizon for each point
+  volume = Teuchos::rcp((*oneDimensionalMothership)(2), false);           // cell volume
+  density = Teuchos::rcp((*oneDimensionalMothership)(3), false);          // density
+  deltaTemperature = Teuchos::rcp((*oneDimensionalMothership)(4), false); // change in temperature
+
+  threeDimensionalMothership = rebalancedThreeDimensionalMothership;
+  x = Teuchos::rcp((*threeDimensionalMothership)(0), false);             // initial positions
+  u = Teuchos::rcp((*threeDimensionalMothership)(1), false);             // displacement
+  y = Teuchos::rcp((*threeDimensionalMothership)(2), false);             // current positions
+  v = Teuchos::rcp((*threeDimensionalMothership)(3), false);             // velocities
+  a = Teuchos::rcp((*threeDimensionalMothership)(4), false);             // accelerations
+  force = Teuchos::rcp((*threeDimensionalMothership)(5), false);         // force
+  contactForce = Teuchos::rcp((*threeDimensionalMothership)(6), false);  // contact force (used only for contact simulations)
+  externalForce = Teuchos::rcp((*threeDimensionalMothership)(7), false); // external force
+  deltaU = Teuchos::rcp((*threeDimensionalMothership)(8), false);        // increment in displacement (used only for implicit time integration)
+  scratch = Teuchos::rcp((*threeDimensionalMothership)(9), false);       // scratch space
+
+  if(!appliedExternalForce.is_null()){
+    Teuchos::RCP<Epetra_Vector> rebalancedAppliedExternalForce = Teuchos::rcp(new Epetra_Vector(*threeDimensionalMap));
+    rebalancedAppliedExternalForce->Import(*appliedExternalForce, threeDimensionalImporter, Insert);
+    appliedExternalForce = rebalancedAppliedExternalForce;
+  }
+
+  // Migrate the block data
+  for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++)
+    blockIt->rebalance(oneDimensionalMap,
+                       oneDimensionalOverlapMap,
+                       threeDimensionalMap,
+                       rebalancedThreeDimensionalOverlapMap,
+                       bondMap,
+                       blockIDs,
+                       globalNeighborhoodData);
+
+  // Update the objects that hold views into the mothership vectors or local indexing
+  boundaryAndInitialConditionManager->rebalance(currentOneDimensionalMap, oneDimensionalMap);
+  if(analysisHasContact)
+    contactManager->setMothershipMaps(oneDimensionalMap, threeDimensionalMap);
+  computeManager->rebalance(blocks);
+  outputManager->repartition();
+
+  if(peridigmComm->MyPID() == 0)
+    cout << "\nRebalanced material blocks, bond imbalance " << imbalanceBefore << " -> " << imbalanceAfter << "\n" << endl;
+}
+
+void PeridigmNS::Peridigm::executeDynamicRelaxation(Teuchos::RCP<Teuchos::ParameterList> solverParams) {
+
+  // Adaptive dynamic relaxation (Underwood; Kilic and Madenci, 2010).
+  // The static solution for each load step is found as the steady state of a fictitious, critically
+  // damped dynamic system integrated with a unit time step.  Only internal force evaluations are required.
+
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(analysisHasMultiphysics, "**** PeridigmNS::Peridigm::executeDynamicRelaxation() is not multiphysics compatible.\n");
+
+  bool solverVerbose = solverParams->get("Verbose", false);
+  Teuchos::RCP<Teuchos::ParameterList> dynamicRelaxationParams = sublist(solverParams, "Dynamic Relaxation", true);
+  int maxSolverIterations = dynamicRelaxationParams->get("Maximum Solver Iterations", 100000);
+  double massSafetyFactor = dynamicRelaxationParams->get("Fictitious Mass Safety Factor", 2.0);
+
+  // Determine tolerance
+  double tolerance = dynamicRelaxationParams->get("Relative Tolerance", 1.0e-6);
+  bool useAbsoluteTolerance = false;
+  if(dynamicRelaxationParams->isParameter("Absolute Tolerance")){
+    useAbsoluteTolerance = true;
+    tolerance = dynamicRelaxationParams->get<double>("Absolute Tolerance");
+  }
+
+  // Fictitious diagonal mass density, obtained by inverting the critical time step estimate for a unit time step:
+  // dt_crit = sqrt(2*rho/k)  ==>  rho = k/2, where k is the bond-sum stiffness at each point
+  Epetra_Vector fictitiousMass(*oneDimensionalMap);
+  for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++)
+    ComputeBondSumStiffness(*blockIt, fictitiousMass);
+  fictitiousMass.Scale(0.5*massSafetyFactor);
+  double* massPtr;
+  fictitiousMass.ExtractView(&massPtr);
+  for(int i=0 ; i<fictitiousMass.MyLength() ; ++i){
+    // Points with no bonds carry no internal force; any positive mass will do
+    if(massPtr[i] <= 0.0)
+      massPtr[i] = 1.0;
+  }
+
+  // Mask for the degrees of freedom with kinematic boundary conditions (zero for constrained dof, one otherwise).
+  // The boundary and initial condition manager expects a vector with element size one for this operation.
+  int numMyDoFs = 3*oneDimensionalMap->NumMyElements();
+  vector<int> myGlobalDoFs(numMyDoFs);
+  int* oneDimensionalMapGlobalElements = oneDimensionalMap->MyGlobalElements();
+  for(int iElem=0 ; iElem<oneDimensionalMap->NumMyElements() ; ++iElem){
+    for(int dof=0 ; dof<3 ; ++dof)
+      myGlobalDoFs[3*iElem + dof] = 3*oneDimensionalMapGlobalElements[iElem] + dof;
+  }
+  Epetra_Map dofMap(3*oneDimensionalMap->NumGlobalElements(), numMyDoFs, &myGlobalDoFs[0], 0, *peridigmComm);
+  myGlobalDoFs.clear();
+  Teuchos::RCP<Epetra_Vector> freeDoFMask = Teuchos::rcp(new Epetra_Vector(dofMap));
+  freeDoFMask->PutScalar(1.0);
+  boundaryAndInitialConditionManager->applyKinematicBC_InsertZeros(freeDoFMask, numMultiphysDoFs);
+  double* maskPtr;
+  freeDoFMask->ExtractView(&maskPtr);
+
+  // Vectors specific to dynamic relaxation
+  Epetra_Vector relaxationVelocity(*threeDimensionalMap);
+  Epetra_Vector previousForce(*threeDimensionalMap);
+  Teuchos::RCP<Epetra_Vector> reaction = Teuchos::rcp(new Epetra_Vector(force->Map()));
+
+  // Pointers into mothership vectors
+  double *xPtr, *uPtr, *yPtr, *vPtr, *deltaUPtr, *forcePtr, *externalForcePtr, *volumePtr;
+  double *relaxationVelocityPtr, *previousForcePtr, *scratchPtr;
+  x->ExtractView( &xPtr );
+  u->ExtractView( &uPtr );
+  y->ExtractView( &yPtr );
+  v->ExtractView( &vPtr );
+  deltaU->ExtractView( &deltaUPtr );
+  force->ExtractView( &forcePtr );
+  externalForce->ExtractView( &externalForcePtr );
+  volume->ExtractView( &volumePtr );
+  scratch->ExtractView( &scratchPtr );
+  relaxationVelocity.ExtractView( &relaxationVelocityPtr );
+  previousForce.ExtractView( &previousForcePtr );
+  int length = u->MyLength();
+
+  // Initialize velocity to zero
+  v->PutScalar(0.0);
+
+  // Create list of time steps, using the same conventions as the QuasiStatic solver
+  vector<double> timeSteps = createLoadSteps(solverParams, dynamicRelaxationParams);
+
+  double timeCurrent = timeSteps[0];
+
+  // Write initial configuration to disk
+  PeridigmNS::Timer::self().startTimer("Output");
+  synchDataManagers();
+  outputManager->write(blocks, timeCurrent);
+  PeridigmNS::Timer::self().stopTimer("Output");
+
+  Epetra_Time loadStepCPUTime(*peridigmComm);
+  double cumulativeLoadStepCPUTime = 0.0;
+
+  for(int step=1 ; step<(int)timeSteps.size() ; step++){
+
+    loadStepCPUTime.ResetStartTime();
+
+    double timePrevious = timeCurrent;
+    timeCurrent = timeSteps[step];
+    PeridigmNS::BondBreakageLog::self().setStep(step, timeCurrent);
+    double timeIncrement = timeCurrent - timePrevious;
+    workset->timeStep = timeIncrement;
+
+    // Update nodal positions for nodes with kinematic B.C.
+    deltaU->PutScalar(0.0);
+
+    PeridigmNS::Timer::self().startTimer("Apply Kinematic B.C.");
+    boundaryAndInitialConditionManager->applyBoundaryConditions(timeCurrent, timePrevious);
+    PeridigmNS::Timer::self().stopTimer("Apply Kinematic B.C.");
+
+    // evaluate the external (body) forces:
+    PeridigmNS::Timer::self().startTimer("Apply Body Forces");
+    boundaryAndInitialConditionManager->applyForceContributions(timeCurrent, timePrevious);
+    PeridigmNS::Timer::self().stopTimer("Apply Body Forces");
+
+    relaxationVelocity.PutScalar(0.0);
+    previousForce.PutScalar(0.0);
+
+    double residualNorm = 0.0;
+    double toleranceMultiplier = 1.0;
+    double dampingCoefficient = 0.0;
+    int solverIteration = 0;
+
+    while(solverIteration <= maxSolverIterations){
+
+      // Set the current position and velocity
+      for(int i=0 ; i<length ; ++i){
+        yPtr[i] = xPtr[i] + uPtr[i] + deltaUPtr[i];
+        vPtr[i] = deltaUPtr[i]/timeIncrement;
+      }
+
+      // Copy data from mothership vectors to overlap vectors in data manager
+      PeridigmNS::Timer::self().startTimer("Gather/Scatter");
+      for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
+        blockIt->importData(*u, displacementFieldId, PeridigmField::STEP_NP1, Insert);
+        blockIt->importData(*y, coordinatesFieldId, PeridigmField::STEP_NP1, Insert);
+        blockIt->importData(*v, velocityFieldId, PeridigmField::STEP_NP1, Insert);
+        blockIt->importData(*deltaTemperature, deltaTemperatureFieldId, PeridigmField::STEP_NP1, Insert);
+      }
+      PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
+
+      // Update forces based on new positions
+      PeridigmNS::Timer::self().startTimer("Internal Force");
+      modelEvaluator->evalModel(workset);
+      PeridigmNS::Timer::self().stopTimer("Internal Force");
+
+      // Copy force from the data manager to the mothership vector
+      PeridigmNS::Timer::self().startTimer("Gather/Scatter");
+      force->PutScalar(0.0);
+      for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
+        scratch->PutScalar(0.0);
+        blockIt->exportData(*scratch, forceDensityFieldId, PeridigmField::STEP_NP1, Add);
+        force->Update(1.0, *scratch, 1.0);
+      }
+      PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
+
+      // Check for NaNs in force evaluation
+      for(int i=0 ; i<length ; ++i)
+        TEUCHOS_TEST_FOR_EXCEPT_MSG(!boost::math::isfinite(forcePtr[i]), "**** NaN returned by force evaluation.\n");
 
-    // Set the velocities for dof with kinematic boundary conditions.
-    // This will propagate through the Verlet integrator and result in the proper
-    // displacement boundary conditions on y and consistent values for v and u.
-    PeridigmNS::Timer::self().startTimer("Apply Kinematic B.C.");
-    boundaryAndInitialConditionManager->applyBoundaryConditions(timeCurrent, timePrevious);
-    PeridigmNS::Timer::self().stopTimer("Apply Kinematic B.C.");
+      // On the first iteration of the load step, set the convergence criterion relative to the reactions
+      if(solverIteration == 0 && !useAbsoluteTolerance){
+        boundaryAndInitialConditionManager->applyKinematicBC_ComputeReactions(force, reaction, numMultiphysDoFs);
+        for(int i=0 ; i<reaction->MyLength() ; ++i)
+          (*reaction)[i] *= volumePtr[i/3];
+        double reactionNorm2;
+        reaction->Norm2(&reactionNorm2);
+        toleranceMultiplier = reactionNorm2;
+        if(peridigmComm->MyPID() == 0)
+          cout << "Load step " << step << ", initial time = " << timePrevious << ", final time = " << timeCurrent <<
+            ", convergence criterion = " << tolerance*toleranceMultiplier << endl;
+      }
 
-    // evaluate the external (body) forces:
-    PeridigmNS::Timer::self().startTimer("Apply Body Forces");
-    boundaryAndInitialConditionManager->applyForceContributions(timeCurrent, 0.0); // external forces are dirichlet BCs so the previous time is defaulted to 0.0
-    PeridigmNS::Timer::self().stopTimer("Apply Body Forces");
+      // Residual (net force, with zeros at dof with kinematic boundary conditions), stored in scratch
+      for(int i=0 ; i<length ; ++i)
+        scratchPtr[i] = maskPtr[i]*(forcePtr[i] + externalForcePtr[i]);
 
-    // Y^{n+1} = X_{o} + U^{n} + (dt)*V^{n+1/2}
-    // TODO Replace with blas call
-    for(int i=0 ; i<y->MyLength() ; ++i)
-      yPtr[i] = xPtr[i] + uPtr[i] + dt*vPtr[i];
+      // Compute the residual norm, converting force density to force
+      double localResidualNormSquared = 0.0;
+      for(int i=0 ; i<length ; ++i)
+        localResidualNormSquared += scratchPtr[i]*volumePtr[i/3]*scratchPtr[i]*volumePtr[i/3];
+      double globalResidualNormSquared;
+      peridigmComm->SumAll(&localResidualNormSquared, &globalResidualNormSquared, 1);
+      residualNorm = sqrt(globalResidualNormSquared);
 
-    // U^{n+1} = U^{n} + (dt)*V^{n+1/2}
-    // blas.AXPY(const int N, const double ALPHA, const double *X, double *Y, const int INCX=1, const int INCY=1) const
-    blas.AXPY(length, dt, vPtr, uPtr, 1, 1);
+      if(solverVerbose && solverIteration%100 == 0 && peridigmComm->MyPID() == 0)
+        cout << "  iteration " << solverIteration << ": residual = " << residualNorm << ", damping coefficient = " << dampingCoefficient << endl;
 
-    // TODO The velocity copied into the DataManager is actually the midstep velocity, not the NP1 velocity; this can be fixed by creating a midstep velocity field in the DataManager and setting the NP1 value as invalid.
+      if(residualNorm < tolerance*toleranceMultiplier || solverIteration == maxSolverIterations)
+        break;
 
-    // Copy data from mothership vectors to overlap vectors in data manager
-    PeridigmNS::Timer::self().startTimer("Gather/Scatter");
-    double* horizonPtr;
-    horizon->ExtractView(&horizonPtr);
-    if(analysisHasThermal && fmod(step,deltaStep) == 0){
-      if (hasThermalShock){
-        for (size_t i=0; i<localThermalShockNodeList.size(); i++){
-          int j = localThermalShockNodeList[i];
-          deltaTemperaturePtr[j] += Tdt/((*density)[j]*(*specificHeat)[j])* ( (*convectionConstant)[j]*(-deltaTemperaturePtr[j] + (*fluidTemperature)[j])/(horizonPtr[j]) + internalHeatSourcePtr[j] );
-        }
+      if(solverIteration == 0){
+        // V^{1/2} = F^{0}/(2*lambda)
+        for(int i=0 ; i<length ; ++i)
+          relaxationVelocityPtr[i] = 0.5*scratchPtr[i]/massPtr[i/3];
       }
-      for (int j=0; j<heatFlow->MyLength(); j++)
-        deltaTemperaturePtr[j] += Tdt/((*density)[j]*(*specificHeat)[j])*( heatFlowPtr[j]/(horizonPtr[j]) + (*density)[j]*internalHeatSourcePtr[j] );
-    }
-    for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-      blockIt->importData(*u, displacementFieldId, PeridigmField::STEP_NP1, Insert);
-      blockIt->importData(*y, coordinatesFieldId, PeridigmField::STEP_NP1, Insert);
-      blockIt->importData(*v, velocityFieldId, PeridigmField::STEP_NP1, Insert);
-      blockIt->importData(*deltaTemperature, deltaTemperatureFieldId, PeridigmField::STEP_NP1, Insert);
-    }
-
-    if(analysisHasContact){
-      if(contactModel->Name() == "Time-Dependent Short-Range Force"){
-        for(contactBlockIt = contactBlocks->begin() ; contactBlockIt != contactBlocks->end() ; contactBlockIt++) {
-    	 New_contactModel->evaluateParserFriction(currentValue, previousValue, timeCurrent, timePrevious);
+      else{
+        // Adaptive damping from the Rayleigh quotient of the local diagonal stiffness
+        // K_ii = -(F_i^{n} - F_i^{n-1})/(lambda_ii V_i^{n-1/2})
+        // c = 2*sqrt( (U^T K U)/(U^T U) )
+        double localQuotient[2] = {0.0, 0.0};
+        double globalQuotient[2];
+        for(int i=0 ; i<length ; ++i){
+          if(relaxationVelocityPtr[i] != 0.0){
+            double localStiffness = -(scratchPtr[i] - previousForcePtr[i])/(massPtr[i/3]*relaxationVelocityPtr[i]);
+            localQuotient[0] += deltaUPtr[i]*localStiffness*deltaUPtr[i];
+          }
+          localQuotient[1] += maskPtr[i]*deltaUPtr[i]*deltaUPtr[i];
         }
+        peridigmComm->SumAll(localQuotient, globalQuotient, 2);
+        dampingCoefficient = 0.0;
+        if(globalQuotient[0] > 0.0 && globalQuotient[1] > 0.0)
+          dampingCoefficient = 2.0*sqrt(globalQuotient[0]/globalQuotient[1]);
+        // The integration is unstable for c*dt >= 2
+        if(dampingCoefficient > 1.9)
+          dampingCoefficient = 1.9;
+
+        // V^{n+1/2} = ( (2 - c)*V^{n-1/2} + 2*F^{n}/lambda )/(2 + c)
+        for(int i=0 ; i<length ; ++i)
+          relaxationVelocityPtr[i] = ( (2.0 - dampingCoefficient)*relaxationVelocityPtr[i] + 2.0*scratchPtr[i]/massPtr[i/3] )/(2.0 + dampingCoefficient);
       }
-      contactManager->importData(volume, y, v);
-    }
-    PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
 
-    // Update forces based on new positions
-    PeridigmNS::Timer::self().startTimer("Internal Force");
-    modelEvaluator->evalModel(workset);
-    PeridigmNS::Timer::self().stopTimer("Internal Force");
+      // U^{n+1} = U^{n} + V^{n+1/2}, leaving the dof with kinematic boundary conditions untouched
+      for(int i=0 ; i<length ; ++i){
+        deltaUPtr[i] += maskPtr[i]*relaxationVelocityPtr[i];
+        previousForcePtr[i] = scratchPtr[i];
+      }
 
-    // Copy force from the data manager to the mothership vector
-    PeridigmNS::Timer::self().startTimer("Gather/Scatter");
-    force->PutScalar(0.0);
-    if(analysisHasThermal && fmod(step,deltaStep) == 0){
-// 			Copy heat flow from the data manager to the mothership vector
-			PeridigmNS::Timer::self().startTimer("Heat Flow");
-			modelEvaluator->evalHeatFlow(workset);
-			PeridigmNS::Timer::self().stopTimer("Heat Flow");
+      // Track the total number of iterations taken over the simulation
+      *nonlinearSolverIterations += 1;
 
-// 			Copy heat flow from the data manager to the mothership vector
-			heatFlow->PutScalar(0.0); // MODIFIED NOTE
-		}
-    for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-      scratch->PutScalar(0.0);
-      blockIt->exportData(*scratch, forceDensityFieldId, PeridigmField::STEP_NP1, Add);
-      force->Update(1.0, *scratch, 1.0);
-      if(analysisHasThermal && fmod(step,deltaStep) == 0){
-					scratchOneD->PutScalar(0.0);
-					blockIt->exportData(*scratchOneD, heatFlowFieldId, PeridigmField::STEP_NP1, Add);
-					heatFlow->Update(1.0, *scratchOneD, 1.0);
-			}
+      solverIteration++;
     }
-    PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
 
-    // Check for NaNs in heat flow evaluation
-		if(analysisHasThermal){
-			for(int i=0 ; i<heatFlow->MyLength() ; ++i)
-				TEUCHOS_TEST_FOR_EXCEPT_MSG(!boost::math::isfinite((heatFlowPtr)[i]), "**** NaN returned by heat flow evaluation.\n");
-		}
-    // Check for NaNs in force evaluation
-    // We'd like to know now because a NaN will likely cause a difficult-to-unravel crash downstream.
-    for(int i=0 ; i<force->MyLength() ; ++i)
-      TEUCHOS_TEST_FOR_EXCEPT_MSG(!boost::math::isfinite((*force)[i]), "**** NaN returned by force evaluation.\n");
-
-    // Check for NaNs in force evaluation
-    // We'd like to know now because a NaN will likely cause a difficult-to-unravel crash downstream.
-    for(int i=0 ; i<externalForce->MyLength() ; ++i)
-      TEUCHOS_TEST_FOR_EXCEPT_MSG(!boost::math::isfinite((*externalForce)[i]), "**** NaN returned by external force evaluation.\n");
-
-    if(analysisHasContact){
-      contactManager->exportData(contactForce);
-      // Check for NaNs in contact force evaluation
-      for(int i=0 ; i<contactForce->MyLength() ; ++i)
-        TEUCHOS_TEST_FOR_EXCEPT_MSG(!boost::math::isfinite((*contactForce)[i]), "**** NaN returned by contact force evaluation.\n");
-      // Add contact forces to forces
-      force->Update(1.0, *contactForce, 1.0);
-    }
+    if(peridigmComm->MyPID() == 0)
+      cout << "  iteration " << solverIteration << ": residual = " << residualNorm << endl;
 
-    // fill the acceleration vector
-    (*a) = (*force);
-    for(int i=0 ; i<a->MyLength() ; ++i){
-      (*a)[i] += (*externalForce)[i];
-      (*a)[i] /= (*density)[i/3];
+    if(residualNorm > tolerance*toleranceMultiplier){
+      if(peridigmComm->MyPID() == 0)
+        cout << "\nWarning:  Dynamic relaxation failed to converge in maximum allowable iterations." << endl;
+      if(residualNorm < 100.0*tolerance*toleranceMultiplier){
+        if(peridigmComm->MyPID() == 0)
+          cout << "\nWarning:  Accepting current solution and progressing to next load step.\n" << endl;
+      }
+      else{
+        if(peridigmComm->MyPID() == 0)
+          cout << "\nError:  Aborting analysis.\n" << endl;
+        break;
+      }
     }
 
-    // V^{n+1}   = V^{n+1/2} + (dt/2)*A^{n+1}
-    //blas.AXPY(const int N, const double ALPHA, const double *X, double *Y, const int INCX=1, const int INCY=1) const
-    blas.AXPY(length, dt2, aPtr, vPtr, 1, 1);
+    // Print load step timing information
+    double CPUTime = loadStepCPUTime.ElapsedTime();
+    cumulativeLoadStepCPUTime += CPUTime;
+    if(peridigmComm->MyPID() == 0)
+      cout << setprecision(2) << "  cpu time for load step = " << CPUTime << " sec., cumulative cpu time = " << cumulativeLoadStepCPUTime << " sec.\n" << endl;
+
+    // Add the converged displacement increment to the displacement
+    for(int i=0 ; i<length ; ++i)
+      uPtr[i] += deltaUPtr[i];
 
+    // Write output for completed load step
     PeridigmNS::Timer::self().startTimer("Output");
     synchDataManagers();
     outputManager->write(blocks, timeCurrent);
@@ -1751,8 +2571,9 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
     for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++)
       blockIt->updateState();
   }
-  displayProgress("Explicit time integration", 100.0);
-  *out << "\n\n";
+
+  if(peridigmComm->MyPID() == 0)
+    cout << endl;
 }
 
 bool PeridigmNS::Peridigm::computeF(const Epetra_Vector& x, Epetra_Vector& FVec, NOX::Epetra::Interface::Required::FillType fillType) {
@@ -1993,7 +2814,7 @@ bool PeridigmNS::Peridigm::evaluateNOX(NOX::Epetra::Interface::Required::FillTyp
   return true;
 }
 
-void PeridigmNS::Peridigm::computeInternalForce()
+void PeridigmNS::Peridigm::computeInternalForce(bool evaluateDamage)
 {
 
    TEUCHOS_TEST_FOR_EXCEPT_MSG(analysisHasMultiphysics, "**** PeridigmNS::Peridigm::computeInternalForce() is not multiphysics compatible.\n");
@@ -2017,7 +2838,10 @@ void PeridigmNS::Peridigm::computeInternalForce()
   }
 
   // Call the model evaluator
-  modelEvaluator->evalModel(workset);
+  if(evaluateDamage)
+    modelEvaluator->evalModel(workset);
+  else
+    modelEvaluator->evalInternalForce(workset);
 
   // Copy force from the data manager to the mothership vector
   force->PutScalar(0.0);
@@ -2041,6 +2865,116 @@ void PeridigmNS::Peridigm::computeInternalForce()
     f[i] *= v[i/3];
 }
 
+void PeridigmNS::Peridigm::initializeExplicitStepping(Teuchos::RCP<Teuchos::ParameterList> solverParams)
+{
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(solverParams.is_null() || !solverParams->isSublist("Verlet"),
+                              "**** Error:  Peridigm::initializeExplicitStepping() requires a solver with a Verlet sublist.\n");
+  Teuchos::RCP<Teuchos::ParameterList> verletParams = sublist(solverParams, "Verlet", true);
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(verletParams->isParameter("Subcycling") && verletParams->get<bool>("Subcycling"),
+                              "**** Error:  Subcycling is not supported by Peridigm::initializeExplicitStepping().\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(verletParams->isSublist("Adaptive Time Step"),
+                              "**** Error:  Adaptive Time Step is not supported by Peridigm::initializeExplicitStepping().\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(verletParams->isSublist("Dynamic Load Balance"),
+                              "**** Error:  Dynamic Load Balance is not supported by Peridigm::initializeExplicitStepping().\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(analysisHasThermal, "**** Error:  Peridigm::initializeExplicitStepping() is not compatible with thermal analyses.\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(analysisHasMultiphysics, "**** Error:  Peridigm::initializeExplicitStepping() is not multiphysics compatible.\n");
+
+  explicitSteppingParams = solverParams;
+
+  // Compute the time step as in executeExplicit()
+  double criticalTimeStep = 1.0e50;
+  for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++)
+    criticalTimeStep = std::min(criticalTimeStep, ComputeCriticalTimeStep(*peridigmComm, *blockIt));
+  double dt;
+  peridigmComm->MinAll(&criticalTimeStep, &dt, 1);
+  string timeStepEstimator = verletParams->get("Time Step Estimator", "Bond Sum");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(timeStepEstimator != "Bond Sum" && timeStepEstimator != "Power Iteration",
+                              "**** Error:  Unknown Time Step Estimator, valid options are \"Bond Sum\" and \"Power Iteration\".\n");
+  if(timeStepEstimator == "Power Iteration" && !verletParams->isParameter("Fixed dt")){
+    PeridigmNS::Timer::self().startTimer("Critical Time Step");
+    workset->timeStep = dt;
+    dt = computePowerIterationCriticalTimeStep(verletParams->sublist("Power Iteration"), dt);
+    PeridigmNS::Timer::self().stopTimer("Critical Time Step");
+  }
+  if(verletParams->isParameter("Fixed dt"))
+    dt = verletParams->get<double>("Fixed dt");
+  if(verletParams->isParameter("Safety Factor"))
+    dt *= verletParams->get<double>("Safety Factor");
+
+  explicitTimeStep = dt;
+  explicitTime = solverParams->get("Initial Time", 0.0);
+  explicitStep = 0;
+  workset->timeStep = dt;
+  blockSubcycleRatio.clear();
+  pointBlockIndex.clear();
+
+  if(peridigmComm->MyPID() == 0)
+    cout << "Explicit stepping, time step " << dt << "\n" << endl;
+
+  // Copy data from mothership vectors to overlap vectors in data manager
+  PeridigmNS::Timer::self().startTimer("Gather/Scatter");
+  for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
+    blockIt->importData(*u, displacementFieldId, PeridigmField::STEP_NP1, Insert);
+    blockIt->importData(*y, coordinatesFieldId, PeridigmField::STEP_NP1, Insert);
+    blockIt->importData(*v, velocityFieldId, PeridigmField::STEP_NP1, Insert);
+  }
+  if(analysisHasContact)
+    contactManager->importData(volume, y, v);
+  PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
+
+  // Evaluate the forces in the current configuration for use in the first step
+  PeridigmNS::Timer::self().startTimer("Internal Force");
+  modelEvaluator->evalModel(workset);
+  PeridigmNS::Timer::self().stopTimer("Internal Force");
+
+  PeridigmNS::Timer::self().startTimer("Gather/Scatter");
+  force->PutScalar(0.0);
+  for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
+    scratch->PutScalar(0.0);
+    blockIt->exportData(*scratch, forceDensityFieldId, PeridigmField::STEP_NP1, Add);
+    force->Update(1.0, *scratch, 1.0);
+  }
+  if(analysisHasContact){
+    contactManager->exportData(contactForce);
+    force->Update(1.0, *contactForce, 1.0);
+  }
+  PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
+
+  PeridigmNS::Timer::self().startTimer("Apply Body Forces");
+  boundaryAndInitialConditionManager->applyForceContributions(explicitTime, 0.0);
+  PeridigmNS::Timer::self().stopTimer("Apply Body Forces");
+
+  // fill the acceleration vector
+  (*a) = (*force);
+  for(int i=0 ; i<a->MyLength() ; ++i){
+    (*a)[i] += (*externalForce)[i];
+    (*a)[i] /= (*density)[i/3];
+  }
+
+  // Write initial configuration to disk
+  PeridigmNS::Timer::self().startTimer("Output");
+  synchDataManagers();
+  outputManager->write(blocks, explicitTime);
+  PeridigmNS::Timer::self().stopTimer("Output");
+}
+
+double PeridigmNS::Peridigm::stepExplicit(int numSteps)
+{
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(explicitSteppingParams.is_null(),
+                              "**** Error:  Peridigm::stepExplicit() called before Peridigm::initializeExplicitStepping().\n");
+
+  const double timeInitial = explicitSteppingParams->get("Initial Time", 0.0);
+
+  for(int i=0 ; i<numSteps ; ++i){
+    explicitStep += 1;
+    double timePrevious = explicitTime;
+    explicitTime = timeInitial + explicitStep*explicitTimeStep;
+    explicitVerletStep(explicitStep, explicitTime, timePrevious, explicitTimeStep);
+  }
+
+  return explicitTime;
+}
+
 void PeridigmNS::Peridigm::jacobianDiagnostics(Teuchos::RCP<NOX::Epetra::Group> noxGroup){
 
   stringstream ss;
@@ -2203,27 +3137,7 @@ void PeridigmNS::Peridigm::executeNOXQuasiStatic(Teuchos::RCP<Teuchos::Parameter
   NOX::Utils noxPrinting(printParams);
 
   // Create list of time steps
-  // Case 1:  User provided initial time, final time, and number of load steps
-  vector<double> timeSteps;
-  if( solverParams->isParameter("Final Time") && noxQuasiStaticParams->isParameter("Number of Load Steps") ){
-    double timeInitial = solverParams->get("Initial Time", 0.0);
-    double timeFinal = solverParams->get<double>("Final Time");
-    int numLoadSteps = noxQuasiStaticParams->get<int>("Number of Load Steps");
-    timeSteps.push_back(timeInitial);
-    for(int i=0 ; i<numLoadSteps ; ++i)
-      timeSteps.push_back(timeInitial + (i+1)*(timeFinal-timeInitial)/numLoadSteps);
-  }
-  // Case 2:  User provided a list of time steps
-  else if( noxQuasiStaticParams->isParameter("Time Steps") ){
-    string timeStepString = noxQuasiStaticParams->get<string>("Time Steps");
-    istringstream iss(timeStepString);
-    copy(istream_iterator<double>(iss),
-         istream_iterator<double>(),
-         back_inserter<vector<double> >(timeSteps));
-  }
-  else{
-    TEUCHOS_TEST_FOR_EXCEPT_MSG(true, "\n****Error: No valid time step data provided.\n");
-  }
+  vector<double> timeSteps = createLoadSteps(solverParams, noxQuasiStaticParams);
   double timeCurrent = timeSteps[0];
   double timePrevious = timeCurrent;
 
@@ -2249,6 +3163,7 @@ void PeridigmNS::Peridigm::executeNOXQuasiStatic(Teuchos::RCP<Teuchos::Parameter
 
     timePrevious = timeCurrent;
     timeCurrent = timeSteps[step];
+    PeridigmNS::BondBreakageLog::self().setStep(step, timeCurrent);
     double timeIncrement = timeCurrent - timePrevious;
     workset->timeStep = timeIncrement;
 
@@ -2393,16 +3308,34 @@ void PeridigmNS::Peridigm::executeNOXQuasiStatic(Teuchos::RCP<Teuchos::Parameter
     }
 
     Material::JacobianType peridigmPreconditioner = Material::FULL_MATRIX;
+    bool useMultigridPreconditioner(false);
     if(solverParams->isParameter("Peridigm Preconditioner")){
       std::string peridigmPreconditionerStr = solverParams->get<std::string>("Peridigm Preconditioner");
       if(peridigmPreconditionerStr == "Full Tangent")
         peridigmPreconditioner = Material::FULL_MATRIX;
+      else if(peridigmPreconditionerStr == "Algebraic Multigrid"){
+        peridigmPreconditioner = Material::FULL_MATRIX;
+        useMultigridPreconditioner = true;
+      }
       else if(peridigmPreconditionerStr == "Block 3x3")
         peridigmPreconditioner = Material::BLOCK_DIAGONAL;
       else if(peridigmPreconditionerStr == "None")
         peridigmPreconditioner = Material::BLOCK_DIAGONAL;
       else
-        TEUCHOS_TEST_FOR_EXCEPT_MSG(true, "\n****Error:  Unrecognized Peridigm Preconditioner, must be \"Full Tangent\", \"Block 3x3\", or \"None\".\n");
+        TEUCHOS_TEST_FOR_EXCEPT_MSG(true, "\n****Error:  Unrecognized Peridigm Preconditioner, must be \"Full Tangent\", \"Algebraic Multigrid\", \"Block 3x3\", or \"None\".\n");
+    }
+
+    // The algebraic multigrid preconditioner is constructed by NOX from the full tangent through ML,
+    // using the rigid body modes as the null space.  Reuse of the hierarchy across nonlinear iterations
+    // is governed by the NOX "Preconditioner Reuse Policy" and "Max Age Of Prec" settings.
+    if(useMultigridPreconditioner){
+      linearSystemParams->set("Preconditioner", "ML");
+      if(!linearSystemParams->isParameter("Preconditioner Reuse Policy")){
+        linearSystemParams->set("Preconditioner Reuse Policy", "Reuse");
+        linearSystemParams->set("Max Age Of Prec", linearSystemParams->get("Max Age Of Prec", 5));
+      }
+      bool isHermitian = (linearSystemParams->get<std::string>("Aztec Solver", "GMRES") == "CG");
+      setMultigridParameters(linearSystemParams->sublist("ML Settings"), isHermitian);
     }
     bool isMatrixFree(false);
     if(linearSystemParams->isParameter("Jacobian Operator")){
@@ -2610,6 +3543,34 @@ void PeridigmNS::Peridigm::executeNOXQuasiStatic(Teuchos::RCP<Teuchos::Parameter
   //   cout << endl;
 }
 
+vector<double> PeridigmNS::Peridigm::createLoadSteps(Teuchos::RCP<Teuchos::ParameterList> solverParams,
+                                                     Teuchos::RCP<Teuchos::ParameterList> loadStepParams) {
+  vector<double> timeSteps;
+
+  // Case 1:  User provided initial time, final time, and number of load steps
+  if( solverParams->isParameter("Final Time") && loadStepParams->isParameter("Number of Load Steps") ){
+    double timeInitial = solverParams->get("Initial Time", 0.0);
+    double timeFinal = solverParams->get<double>("Final Time");
+    int numLoadSteps = loadStepParams->get<int>("Number of Load Steps");
+    timeSteps.push_back(timeInitial);
+    for(int i=0 ; i<numLoadSteps ; ++i)
+      timeSteps.push_back(timeInitial + (i+1)*(timeFinal-timeInitial)/numLoadSteps);
+  }
+  // Case 2:  User provided a list of time steps
+  else if( loadStepParams->isParameter("Time Steps") ){
+    string timeStepString = loadStepParams->get<string>("Time Steps");
+    istringstream iss(timeStepString);
+    copy(istream_iterator<double>(iss),
+         istream_iterator<double>(),
+         back_inserter<vector<double> >(timeSteps));
+  }
+  else{
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(true, "\n****Error: No valid time step data provided.\n");
+  }
+
+  return timeSteps;
+}
+
 void PeridigmNS::Peridigm::executeQuasiStatic(Teuchos::RCP<Teuchos::ParameterList> solverParams) {
 
   // Create vectors that are specific to quasi-statics.
@@ -2642,6 +3603,12 @@ void PeridigmNS::Peridigm::executeQuasiStatic(Teuchos::RCP<Teuchos::ParameterLis
   double dampedNewtonDiagonalScaleFactor = quasiStaticParams->get("Damped Newton Diagonal Scale Factor", 1.0001);
   double dampedNewtonDiagonalShiftFactor = quasiStaticParams->get("Damped Newton Diagonal Shift Factor", 0.00001);
 
+  // Preconditioner for the linear solver:  "None", "Ifpack", or "Algebraic Multigrid"
+  string preconditionerType = quasiStaticParams->get<string>("Preconditioner", "None");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(preconditionerType != "None" && preconditionerType != "Ifpack" && preconditionerType != "Algebraic Multigrid",
+                              "\n****Error:  Unrecognized QuasiStatic Preconditioner, must be \"None\", \"Ifpack\", or \"Algebraic Multigrid\".\n");
+  Teuchos::ParameterList& multigridParams = quasiStaticParams->sublist("Multigrid Settings");
+
   // Determine tolerance
   double tolerance = quasiStaticParams->get("Relative Tolerance", 1.0e-6);
   bool useAbsoluteTolerance = false;
@@ -2672,11 +3639,26 @@ void PeridigmNS::Peridigm::executeQuasiStatic(Teuchos::RCP<Teuchos::ParameterLis
       combinedDeltaU->ExtractView( &combinedDeltaUPtr );
   }
 
-  // Initialize velocity to zero
-  v->PutScalar(0.0);
-  if(analysisHasMultiphysics){
-	  combinedV->PutScalar(0.0);
-	  fluidPressureV->PutScalar(0.0);
+  // Number of load steps already taken by a caller that advances the solution a few load steps at a time;
+  // the load steps of this call are numbered from loadStepOffset+1, and the velocity of the last one is kept as the predictor
+  int loadStepOffset = 0;
+  if(solverParams->isParameter("Load Step Offset"))
+    loadStepOffset = solverParams->get<int>("Load Step Offset");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(loadStepOffset < 0, "\n****Error:  \"Load Step Offset\" must be non-negative.\n");
+
+  if(loadStepOffset == 0){
+    // Initialize velocity to zero
+    v->PutScalar(0.0);
+    if(analysisHasMultiphysics){
+      combinedV->PutScalar(0.0);
+      fluidPressureV->PutScalar(0.0);
+    }
+  }
+  else{
+    if(analysisHasMultiphysics)
+      *predictor = *combinedV;
+    else
+      *predictor = *v;
   }
 
   // Data for Belos linear solver object
@@ -2707,36 +3689,20 @@ void PeridigmNS::Peridigm::executeQuasiStatic(Teuchos::RCP<Teuchos::ParameterLis
   }
 
   // Create list of time steps
-
-  // Case 1:  User provided initial time, final time, and number of load steps
-  vector<double> timeSteps;
-  if( solverParams->isParameter("Final Time") && quasiStaticParams->isParameter("Number of Load Steps") ){
-    double timeInitial = solverParams->get("Initial Time", 0.0);
-    double timeFinal = solverParams->get<double>("Final Time");
-    int numLoadSteps = quasiStaticParams->get<int>("Number of Load Steps");
-    timeSteps.push_back(timeInitial);
-    for(int i=0 ; i<numLoadSteps ; ++i)
-      timeSteps.push_back(timeInitial + (i+1)*(timeFinal-timeInitial)/numLoadSteps);
-  }
-  // Case 2:  User provided a list of time steps
-  else if( quasiStaticParams->isParameter("Time Steps") ){
-    string timeStepString = quasiStaticParams->get<string>("Time Steps");
-    istringstream iss(timeStepString);
-    copy(istream_iterator<double>(iss),
-	 istream_iterator<double>(),
-	 back_inserter<vector<double> >(timeSteps));
-  }
-  else{
-    TEUCHOS_TEST_FOR_EXCEPT_MSG(true, "\n****Error: No valid time step data provided.\n");
-  }
+  vector<double> timeSteps = createLoadSteps(solverParams, quasiStaticParams);
 
   double timeCurrent = timeSteps[0];
 
-  // Write initial configuration to disk
-  PeridigmNS::Timer::self().startTimer("Output");
-  synchDataManagers();
-  outputManager->write(blocks, timeCurrent);
-  PeridigmNS::Timer::self().stopTimer("Output");
+  // Write initial configuration to disk, unless the caller is advancing the solution one load step at a time
+  bool writeInitialConfiguration = true;
+  if(solverParams->isParameter("Write Initial Configuration"))
+    writeInitialConfiguration = solverParams->get<bool>("Write Initial Configuration");
+  if(writeInitialConfiguration){
+    PeridigmNS::Timer::self().startTimer("Output");
+    synchDataManagers();
+    outputManager->write(blocks, timeCurrent);
+    PeridigmNS::Timer::self().stopTimer("Output");
+  }
 
   Epetra_Time loadStepCPUTime(*peridigmComm);
   double cumulativeLoadStepCPUTime = 0.0;
@@ -2747,6 +3713,8 @@ void PeridigmNS::Peridigm::executeQuasiStatic(Teuchos::RCP<Teuchos::ParameterLis
 
     double timePrevious = timeCurrent;
     timeCurrent = timeSteps[step];
+    int loadStep = loadStepOffset + step;
+    PeridigmNS::BondBreakageLog::self().setStep(loadStep, timeCurrent);
     double timeIncrement = timeCurrent - timePrevious;
     workset->timeStep = timeIncrement;
 
@@ -2822,13 +3790,14 @@ void PeridigmNS::Peridigm::executeQuasiStatic(Teuchos::RCP<Teuchos::ParameterLis
     }
 
     if(peridigmComm->MyPID() == 0)
-      cout << "Load step " << step << ", initial time = " << timePrevious << ", final time = " << timeCurrent <<
+      cout << "Load step " << loadStep << ", initial time = " << timePrevious << ", final time = " << timeCurrent <<
         ", convergence criterion = " << tolerance*toleranceMultiplier << endl;
 
     int solverIteration = 1;
     bool dampedNewton = false;
-    bool usePreconditioner = false; // \todo Determine why ifpack preconditioners started exhibiting problems with Trilinos 11.2.5 (Jul-11-2013).
-                                    //       For the record, Trilinos 11.2.4 (Jun-20-2013) works.
+    // \todo Determine why ifpack preconditioners started exhibiting problems with Trilinos 11.2.5 (Jul-11-2013).
+    //       For the record, Trilinos 11.2.4 (Jun-20-2013) works.
+    bool usePreconditioner = (preconditionerType != "None");
     int numPureNewtonSteps = 50;//8;
     int numPreconditionerSteps = 24;
     int dampedNewtonNumStepsBetweenTangentUpdates = 8;
@@ -2851,7 +3820,7 @@ void PeridigmNS::Peridigm::executeQuasiStatic(Teuchos::RCP<Teuchos::ParameterLis
       }
 
       // On the first iteration, use a predictor based on the velocity from the previous load step
-      if(solverIteration == 1 && step > 1 && !disableHeuristics) {
+      if(solverIteration == 1 && loadStep > 1 && !disableHeuristics) {
         for(int i=0 ; i<lhs->MyLength() ; ++i)
           (*lhs)[i] = (*predictor)[i]*timeIncrement;
         boundaryAndInitialConditionManager->applyKinematicBC_InsertZeros(lhs, numMultiphysDoFs);
@@ -2891,12 +3860,18 @@ void PeridigmNS::Peridigm::executeQuasiStatic(Teuchos::RCP<Teuchos::ParameterLis
 
           if(dampedNewton)
             quasiStaticsDampTangent(dampedNewtonDiagonalScaleFactor, dampedNewtonDiagonalShiftFactor);
-          if(usePreconditioner)
-            quasiStaticsSetPreconditioner(linearProblem);
+          if(usePreconditioner){
+            if(preconditionerType == "Algebraic Multigrid")
+              setMultigridPreconditioner(linearProblem, multigridParams);
+            else
+              quasiStaticsSetPreconditioner(linearProblem);
+          }
         }
 
         // Solve linear system
         isConverged = quasiStaticsSolveSystem(residual, lhs, linearProblem, belosSolver);
+        if(usePreconditioner && preconditionerType == "Algebraic Multigrid")
+          checkMultigridPreconditionerReuse(belosSolver->getNumIters());
 
         if(isConverged == Belos::Unconverged && !disableHeuristics){
           // Adjust the tangent and try again
@@ -2906,6 +3881,8 @@ void PeridigmNS::Peridigm::executeQuasiStatic(Teuchos::RCP<Teuchos::ParameterLis
             quasiStaticsDampTangent(dampedNewtonDiagonalScaleFactor, dampedNewtonDiagonalShiftFactor);
           dampedNewton = true;
           linearProblem.setLeftPrec( Teuchos::RCP<Belos::EpetraPrecOp>() );
+          if(preconditionerType == "Algebraic Multigrid")
+            multigridRebuildRequested = true;
           usePreconditioner = false;
           isConverged = quasiStaticsSolveSystem(residual, lhs, linearProblem, belosSolver);
         }
@@ -3088,6 +4065,113 @@ void PeridigmNS::Peridigm::quasiStaticsSetPreconditioner(Belos::LinearProblem<do
   }
 }
 
+void PeridigmNS::Peridigm::setMultigridPreconditioner(Belos::LinearProblem<double,Epetra_MultiVector,Epetra_Operator>& linearProblem,
+                                                      Teuchos::ParameterList& multigridParams) {
+
+  // The multigrid hierarchy is built once and then reused across nonlinear iterations and load steps.
+  // The preconditioner references the tangent directly, so the fine level always sees the current
+  // tangent and only the coarse levels become stale.  The hierarchy is rebuilt when
+  // checkMultigridPreconditionerReuse() detects that the linear solver iteration count has degraded.
+  if(multigridPreconditioner.is_null() || multigridRebuildRequested){
+    PeridigmNS::Timer::self().startTimer("Compute Multigrid Preconditioner");
+    multigridRebuildFactor = multigridParams.get("Rebuild Factor", 2.0);
+    Teuchos::ParameterList mlList(multigridParams);
+    mlList.remove("Rebuild Factor");
+    setMultigridParameters(mlList, linearProblem.isHermitian());
+    multigridPreconditioner = Teuchos::null; // release the old hierarchy before building the new one
+    multigridPreconditioner = Teuchos::rcp( new ML_Epetra::MultiLevelPreconditioner(*tangent, mlList, true) );
+    multigridBaselineIterations = -1;
+    multigridRebuildRequested = false;
+    PeridigmNS::Timer::self().stopTimer("Compute Multigrid Preconditioner");
+  }
+
+  // Create the Belos preconditioned operator from the ML preconditioner.
+  // NOTE:  This is necessary because Belos expects an operator to apply the
+  //        preconditioner with Apply() NOT ApplyInverse().
+  Teuchos::RCP<Belos::EpetraPrecOp> belosPrec = Teuchos::rcp( new Belos::EpetraPrecOp( multigridPreconditioner ) );
+  linearProblem.setLeftPrec( belosPrec );
+}
+
+void PeridigmNS::Peridigm::checkMultigridPreconditionerReuse(int numLinearSolverIterations) {
+
+  // The first solve after the hierarchy is built establishes the baseline iteration count
+  if(multigridBaselineIterations < 0){
+    multigridBaselineIterations = numLinearSolverIterations;
+    return;
+  }
+
+  // Small iteration counts fluctuate, so do not trigger a rebuild below a modest floor
+  int baseline = multigridBaselineIterations > 10 ? multigridBaselineIterations : 10;
+  if(numLinearSolverIterations > multigridRebuildFactor*baseline){
+    multigridRebuildRequested = true;
+    if(peridigmComm->MyPID() == 0)
+      cout << "  --linear solver iterations increased from " << multigridBaselineIterations << " to " << numLinearSolverIterations
+           << ", rebuilding multigrid preconditioner--" << endl;
+  }
+}
+
+void PeridigmNS::Peridigm::setMultigridParameters(Teuchos::ParameterList& mlList, bool isHermitian) {
+
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(analysisHasMultiphysics, "**** PeridigmNS::Peridigm::setMultigridParameters(), the algebraic multigrid preconditioner is not multiphysics compatible.\n");
+
+  if(rigidBodyModes.empty())
+    computeRigidBodyModes();
+
+  // Smoothed aggregation defaults; settings supplied by the user are not overwritten
+  ML_Epetra::SetDefaults(isHermitian ? "SA" : "NSSA", mlList, 0, 0, false);
+  mlList.get("ML output", 0);
+
+  // Three displacement dof per node, with the rigid body modes as the null space
+  mlList.set("PDE equations", 3);
+  mlList.set("null space: type", "pre-computed");
+  mlList.set("null space: dimension", 6);
+  mlList.set("null space: vectors", &rigidBodyModes[0]);
+  mlList.set("null space: add default vectors", false);
+}
+
+void PeridigmNS::Peridigm::computeRigidBodyModes() {
+
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(tangent.is_null(), "**** PeridigmNS::Peridigm::computeRigidBodyModes(), tangent has not been allocated!\n");
+  int numRows = tangent->NumMyRows();
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(numRows != x->MyLength(), "**** PeridigmNS::Peridigm::computeRigidBodyModes(), incompatible vector lengths!\n");
+
+  // Use coordinates relative to the centroid of the model to improve the conditioning of the rotational modes
+  double* xPtr;
+  x->ExtractView(&xPtr);
+  int numOwnedPoints = x->MyLength()/3;
+  double localSum[3] = {0.0, 0.0, 0.0};
+  double centroid[3];
+  for(int i=0 ; i<numOwnedPoints ; ++i){
+    for(int dof=0 ; dof<3 ; ++dof)
+      localSum[dof] += xPtr[3*i+dof];
+  }
+  peridigmComm->SumAll(localSum, centroid, 3);
+  for(int dof=0 ; dof<3 ; ++dof)
+    centroid[dof] /= x->Map().NumGlobalElements();
+
+  // Three translations followed by rotations about the x, y, and z axes,
+  // stored contiguously with one entry per row of the tangent
+  rigidBodyModes.assign(6*numRows, 0.0);
+  double* mode[6];
+  for(int m=0 ; m<6 ; ++m)
+    mode[m] = &rigidBodyModes[m*numRows];
+  for(int i=0 ; i<numOwnedPoints ; ++i){
+    int row = 3*i;
+    double X = xPtr[row]   - centroid[0];
+    double Y = xPtr[row+1] - centroid[1];
+    double Z = xPtr[row+2] - centroid[2];
+    mode[0][row]   = 1.0;
+    mode[1][row+1] = 1.0;
+    mode[2][row+2] = 1.0;
+    mode[3][row+1] = -Z;
+    mode[3][row+2] =  Y;
+    mode[4][row]   =  Z;
+    mode[4][row+2] = -X;
+    mode[5][row]   = -Y;
+    mode[5][row+1] =  X;
+  }
+}
+
 void PeridigmNS::Peridigm::quasiStaticsDampTangent(double dampedNewtonDiagonalScaleFactor,
                                                    double dampedNewtonDiagonalShiftFactor) {
   // Create a vector to store the diagonal
@@ -3436,6 +4520,10 @@ void PeridigmNS::Peridigm::executeImplicit(Teuchos::RCP<Teuchos::ParameterList>
   double dt                      = implicitParams->get<double>("Fixed dt");
   double beta                    = implicitParams->get("Beta", 0.25);
   double gamma                   = implicitParams->get("Gamma", 0.50);
+  string preconditionerType      = implicitParams->get<string>("Preconditioner", "None");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(preconditionerType != "None" && preconditionerType != "Algebraic Multigrid",
+                              "\n****Error:  Unrecognized Implicit Preconditioner, must be \"None\" or \"Algebraic Multigrid\".\n");
+  Teuchos::ParameterList& multigridParams = implicitParams->sublist("Multigrid Settings");
   workset->timeStep = dt;
   double dt2 = dt*dt;
   int nsteps = (int)floor((timeFinal-timeInitial)/dt);
@@ -3496,6 +4584,8 @@ void PeridigmNS::Peridigm::executeImplicit(Teuchos::RCP<Teuchos::ParameterList>
     if(peridigmComm->MyPID() == 0)
       cout << "Load step " << step << ", initial time = " << step*dt << ", final time = " << (step+1)*dt << endl;
 
+    PeridigmNS::BondBreakageLog::self().setStep(step+1, timeInitial + (step+1)*dt);
+
     *un = *u;
     *vn = *v;
     *an = *a;
@@ -3660,6 +4750,8 @@ void PeridigmNS::Peridigm::executeImplicit(Teuchos::RCP<Teuchos::ParameterList>
 	fluidPressureDeltaU->PutScalar(0.0);
       }
       linearProblem.setOperator(tangent);
+      if(preconditionerType == "Algebraic Multigrid")
+        setMultigridPreconditioner(linearProblem, multigridParams);
 
       bool isSet = linearProblem.setProblem(displacementIncrement, residual);
 
@@ -3669,6 +4761,12 @@ void PeridigmNS::Peridigm::executeImplicit(Teuchos::RCP<Teuchos::ParameterList>
       if(isConverged != Belos::Converged && peridigmComm->MyPID() == 0)
         cout << "Warning:  Belos linear solver failed to converge!  Proceeding with nonconverged solution..." << endl;
       PeridigmNS::Timer::self().stopTimer("Solve Linear System");
+      if(preconditionerType == "Algebraic Multigrid"){
+        if(isConverged != Belos::Converged)
+          multigridRebuildRequested = true;
+        else
+          checkMultigridPreconditionerReuse(belosSolver->getNumIters());
+      }
 
      //TODO: Turn all mentions of combinedDeltaU and deltaU to displacementIncrement where appropriate.
       //Update increments from combined vector
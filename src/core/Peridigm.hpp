@@ -83,6 +83,10 @@
 #include "Peridigm_DamageModel.hpp"
 #include "Peridigm_ContactModel.hpp"
 
+namespace ML_Epetra {
+  class MultiLevelPreconditioner;
+}
+
 namespace PeridigmNS {
 
   class UserDefinedTimeDependentCriticalStretchDamageModel;
@@ -183,8 +187,11 @@ namespace PeridigmNS {
       //        but Albany does not.
     }
 
-    //! Evaluate the internal force; assumes x, u, y, and v have been set, fills force (intended for use when calling Peridigm as a library).
-    void computeInternalForce();
+    /** \brief Evaluate the internal force; assumes x, u, y, and v have been set, fills force (intended for use when calling Peridigm as a library).
+     *
+     *  If evaluateDamage is false, the damage models and contact are skipped and only the material models are evaluated.
+     */
+    void computeInternalForce(bool evaluateDamage = true);
 
     // Update the material states (intended for use when calling Peridigm as a library).
     void updateState() {
@@ -269,15 +276,50 @@ namespace PeridigmNS {
 
     void executeExplicit(Teuchos::RCP<Teuchos::ParameterList> solverParams);
 
+    /** \brief Estimate the critical time step for explicit integration by power iteration on M^{-1} K using internal force evaluations.
+     *
+     *  The eigenvalue estimate is bounded above by the bond-sum estimate, so the returned time step (before the margin is applied)
+     *  is never smaller than bondSumCriticalTimeStep.
+     */
+    double computePowerIterationCriticalTimeStep(Teuchos::ParameterList& powerIterationParams, double bondSumCriticalTimeStep);
+
+    /** \brief Repartition the material blocks in the current configuration.
+     *
+     *  Points are weighted by their number of unbroken bonds.  The mothership vectors, the global neighborhood
+     *  list, and all block data (including bond data) are migrated to the new decomposition, and the boundary
+     *  condition, contact, compute, and output managers are updated accordingly.
+     */
+    void rebalanceBlocks();
+
+    //! Main routine to drive problem solution for quasistatics using adaptive dynamic relaxation
+    void executeDynamicRelaxation(Teuchos::RCP<Teuchos::ParameterList> solverParams);
+
     //! Main routine to drive problem solution for quasistatics
     void executeQuasiStatic(Teuchos::RCP<Teuchos::ParameterList> solverParams);
 
     //! Main routine to drive problem solution for quasistatics using NOX
     void executeNOXQuasiStatic(Teuchos::RCP<Teuchos::ParameterList> solverParams);
 
+    //! Create the list of load step times from "Number of Load Steps" or "Time Steps"
+    std::vector<double> createLoadSteps(Teuchos::RCP<Teuchos::ParameterList> solverParams,
+                                        Teuchos::RCP<Teuchos::ParameterList> loadStepParams);
+
     //! Set the preconditioner for the global linear system
     void quasiStaticsSetPreconditioner(Belos::LinearProblem<double,Epetra_MultiVector,Epetra_Operator>& linearProblem);
 
+    //! Set the algebraic multigrid preconditioner for the global linear system, reusing the existing hierarchy when possible
+    void setMultigridPreconditioner(Belos::LinearProblem<double,Epetra_MultiVector,Epetra_Operator>& linearProblem,
+                                    Teuchos::ParameterList& multigridParams);
+
+    //! Flag the multigrid hierarchy for rebuild if the linear solver iteration count has degraded
+    void checkMultigridPreconditionerReuse(int numLinearSolverIterations);
+
+    //! Fill an ML parameter list with defaults and the rigid body mode null space
+    void setMultigridParameters(Teuchos::ParameterList& mlList, bool isHermitian);
+
+    //! Compute the rigid body modes (null space of the tangent) from the model coordinates
+    void computeRigidBodyModes();
+
     //! Damp the tangent matrix by scaling the diagonal and adding a small value to each entry in the diagonal
     void quasiStaticsDampTangent(double dampedNewtonDiagonalScaleFactor,
                                  double dampedNewtonDiagonalShiftFactor);
@@ -371,6 +413,39 @@ namespace PeridigmNS {
     //! Set the time step (for use when calling Peridigm as a library).
     void setTimeStep(double timeStep) { workset->timeStep = timeStep; }
 
+    //! @name Explicit stepping (for use when calling Peridigm as a library)
+    //@{
+    /** \brief Prepare for stepping with the Verlet solver in solverParams.
+     *
+     *  Computes the time step, evaluates the forces in the current configuration, and writes the initial
+     *  configuration.  Subcycling, adaptive time stepping, dynamic load balancing, and thermal analyses are
+     *  not supported.
+     */
+    void initializeExplicitStepping(Teuchos::RCP<Teuchos::ParameterList> solverParams);
+
+    //! Advance the explicit time integration by numSteps velocity-Verlet steps; returns the current time.
+    double stepExplicit(int numSteps);
+
+    //! Time step used by stepExplicit().
+    double getExplicitTimeStep() { return explicitTimeStep; }
+
+    //! Current time of the explicit stepping.
+    double getExplicitTime() { return explicitTime; }
+
+    //! Number of steps taken by stepExplicit().
+    int getExplicitStep() { return explicitStep; }
+
+    //! Flush buffered output; called at the end of execute() and by library users that drive the solver themselves.
+    void flushOutput();
+    //@}
+
+    //! @name Applied external force
+    //@{
+    //! Externally applied force density (e.g., from a coupled code), added to the body forces each time they are applied; null if unused.
+    Teuchos::RCP<Epetra_Vector> getAppliedExternalForce() { return appliedExternalForce; }
+    void setAppliedExternalForce(Teuchos::RCP<Epetra_Vector> appliedExternalForce_) { appliedExternalForce = appliedExternalForce_; }
+    //@}
+
     //! Display a progress bar
     void displayProgress(std::string title, double percentComplete);
 
@@ -382,8 +457,16 @@ namespace PeridigmNS {
     //! @name Friend classes
     //@{
     friend class OutputManager_ExodusII;
+    friend class OutputManager_Probe;
     //@}
 
+    /** \brief Advance the Verlet solver by one step, from timePrevious to timeCurrent, and write output.
+     *
+     *  Shared by executeExplicit() and stepExplicit(); the caller chooses the time step and handles dynamic load
+     *  balancing.  Returns the wall time spent in the internal force evaluation on this processor.
+     */
+    double explicitVerletStep(int step, double timeCurrent, double timePrevious, double dt);
+
     //! Parameterlist of entire input deck
     Teuchos::RCP<Teuchos::ParameterList> peridigmParams;
 
@@ -594,6 +677,50 @@ namespace PeridigmNS {
     //! Block diagonal of global tangent matrix
     Teuchos::RCP<Epetra_FECrsMatrix> blockDiagonalTangent;
 
+    //! Algebraic multigrid preconditioner, reused across nonlinear iterations
+    Teuchos::RCP<ML_Epetra::MultiLevelPreconditioner> multigridPreconditioner;
+
+    //! Rigid body modes used as the null space for the multigrid preconditioner
+    std::vector<double> rigidBodyModes;
+
+    //! Number of linear solver iterations taken with a freshly-built multigrid hierarchy (-1 if not yet known)
+    int multigridBaselineIterations;
+
+    //! Flag indicating that the multigrid hierarchy must be rebuilt before the next linear solve
+    bool multigridRebuildRequested;
+
+    //! Allowable growth in linear solver iterations before the multigrid hierarchy is rebuilt
+    double multigridRebuildFactor;
+
+    //! Time step, current time, and step count of the explicit stepping interface
+    double explicitTimeStep;
+    double explicitTime;
+    int explicitStep;
+
+    //! Solver parameters given to initializeExplicitStepping()
+    Teuchos::RCP<Teuchos::ParameterList> explicitSteppingParams;
+
+    //! Subcycle ratio of each block and block index of each owned point; empty when the Verlet solver is not subcycling
+    std::vector<int> blockSubcycleRatio;
+    std::vector<int> pointBlockIndex;
+
+    //! Last step of a subcycled run, at which the final macro step of each block is truncated
+    int subcyclingFinalStep;
+
+    //! Thermal time step and number of mechanical steps per thermal step of the Verlet solver
+    double explicitThermalTimeStep;
+    int explicitThermalStepInterval;
+
+    //! Local ids of the thermal shock nodes
+    std::vector<int> localThermalShockNodeList;
+
+    //! Values of the time-dependent critical stretch and friction expressions, carried between Verlet steps
+    double currentValue;
+    double previousValue;
+
+    //! Externally applied force density, added to externalForce by the boundary and initial condition manager
+    Teuchos::RCP<Epetra_Vector> appliedExternalForce;
+
     //! Tracker for total number of iterations taken by the nonlinear solver for implicit time integration
     Teuchos::RCP<int> nonlinearSolverIterations;
 
@@ -88,6 +88,35 @@ void PeridigmNS::Block::initialize(Teuchos::RCP<const Epetra_BlockMap> globalOwn
   BlockBase::initializeDataManager(fieldIds);
 }
 
+void PeridigmNS::Block::rebalance(Teuchos::RCP<const Epetra_BlockMap> rebalancedGlobalOwnedScalarPointMap,
+                                  Teuchos::RCP<const Epetra_BlockMap> rebalancedGlobalOverlapScalarPointMap,
+                                  Teuchos::RCP<const Epetra_BlockMap> rebalancedGlobalOwnedVectorPointMap,
+                                  Teuchos::RCP<const Epetra_BlockMap> rebalancedGlobalOverlapVectorPointMap,
+                                  Teuchos::RCP<const Epetra_BlockMap> rebalancedGlobalOwnedScalarBondMap,
+                                  Teuchos::RCP<const Epetra_Vector> rebalancedGlobalBlockIds,
+                                  Teuchos::RCP<const PeridigmNS::NeighborhoodData> rebalancedGlobalNeighborhoodData)
+{
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(dataManager.is_null(),
+                              "\n**** DataManager must be initialized via Block::initialize() prior to calling Block::rebalance()\n");
+
+  createMapsFromGlobalMaps(rebalancedGlobalOwnedScalarPointMap,
+                           rebalancedGlobalOverlapScalarPointMap,
+                           rebalancedGlobalOwnedVectorPointMap,
+                           rebalancedGlobalOverlapVectorPointMap,
+                           rebalancedGlobalOwnedScalarBondMap,
+                           rebalancedGlobalBlockIds,
+                           rebalancedGlobalNeighborhoodData);
+
+  neighborhoodData = createNeighborhoodDataFromGlobalNeighborhoodData(rebalancedGlobalOverlapScalarPointMap,
+                                                                      rebalancedGlobalNeighborhoodData);
+
+  dataManager->rebalance(ownedScalarPointMap,
+                         overlapScalarPointMap,
+                         ownedVectorPointMap,
+                         overlapVectorPointMap,
+                         ownedScalarBondMap);
+}
+
 void PeridigmNS::Block::initializeMaterialModel(double timeStep)
 {
   TEUCHOS_TEST_FOR_EXCEPT_MSG(materialModel.is_null(),
@@ -79,6 +79,20 @@ namespace PeridigmNS {
                     Teuchos::RCP<const Epetra_Vector> globalBlockIds,
                     Teuchos::RCP<const PeridigmNS::NeighborhoodData> globalNeighborhoodData);
 
+    /*! \brief Rebalance the block based on rebalanced global maps and neighborhood information.
+     *
+     *  The block-specific maps and neighborhood list are rebuilt and all the data in the DataManager,
+     *  including bond data, is migrated to the new decomposition.  The rebalanced global neighborhood
+     *  list must preserve the order of the neighbors of each point.
+     */
+    void rebalance(Teuchos::RCP<const Epetra_BlockMap> rebalancedGlobalOwnedScalarPointMap,
+                   Teuchos::RCP<const Epetra_BlockMap> rebalancedGlobalOverlapScalarPointMap,
+                   Teuchos::RCP<const Epetra_BlockMap> rebalancedGlobalOwnedVectorPointMap,
+                   Teuchos::RCP<const Epetra_BlockMap> rebalancedGlobalOverlapVectorPointMap,
+                   Teuchos::RCP<const Epetra_BlockMap> rebalancedGlobalOwnedScalarBondMap,
+                   Teuchos::RCP<const Epetra_Vector> rebalancedGlobalBlockIds,
+                   Teuchos::RCP<const PeridigmNS::NeighborhoodData> rebalancedGlobalNeighborhoodData);
+
     //! Get the material model
     Teuchos::RCP<const PeridigmNS::Material> getMaterialModel(){
       return materialModel;
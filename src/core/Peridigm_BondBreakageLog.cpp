@@ -0,0 +1,146 @@
+/*! \file Peridigm_BondBreakageLog.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+
+#include "Peridigm_BondBreakageLog.hpp"
+#include <Teuchos_Assert.hpp>
+#include <sstream>
+#include <cstring>
+
+using namespace std;
+
+PeridigmNS::BondBreakageLog::BondBreakageLog()
+  : enabled(false), bufferSize(65536), numBufferedRecords(0), step(0), time(0.0) {}
+
+PeridigmNS::BondBreakageLog::~BondBreakageLog() {
+  finalize();
+}
+
+PeridigmNS::BondBreakageLog& PeridigmNS::BondBreakageLog::self() {
+  static BondBreakageLog bondBreakageLog;
+  return bondBreakageLog;
+}
+
+void PeridigmNS::BondBreakageLog::initialize(const Teuchos::ParameterList& params, int myPID, int numProc) {
+
+  finalize();
+
+  string fileName("BondBreakage");
+  if(params.isParameter("File Name"))
+    fileName = params.get<string>("File Name");
+  if(params.isParameter("Buffer Size"))
+    bufferSize = params.get<int>("Buffer Size");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(bufferSize < 1, "\n**** Error:  Bond Breakage Log \"Buffer Size\" must be a positive number of records.\n");
+
+  // Follow the Exodus convention for naming per-processor files
+  stringstream ss;
+  ss << fileName << ".bbl";
+  if(numProc > 1)
+    ss << "." << numProc << "." << myPID;
+
+  file.open(ss.str().c_str(), ios::out | ios::binary | ios::trunc);
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(!file.is_open(), "\n**** Error:  Unable to open bond breakage log file " + ss.str() + "\n");
+
+  const int version = 1;
+  file.write("PDBB", 4);
+  file.write(reinterpret_cast<const char*>(&version), sizeof(int));
+  file.write(reinterpret_cast<const char*>(&myPID), sizeof(int));
+  file.write(reinterpret_cast<const char*>(&numProc), sizeof(int));
+
+  buffer.clear();
+  buffer.reserve(static_cast<size_t>(bufferSize)*recordSize);
+  numBufferedRecords = 0;
+  currentStepBonds.clear();
+  step = 0;
+  time = 0.0;
+  enabled = true;
+}
+
+template<class T>
+void PeridigmNS::BondBreakageLog::pack(const T& value) {
+  size_t offset = buffer.size();
+  buffer.resize(offset + sizeof(T));
+  memcpy(&buffer[offset], &value, sizeof(T));
+}
+
+void PeridigmNS::BondBreakageLog::setStep(int step_, double time_) {
+  if(step_ != step)
+    currentStepBonds.clear();
+  step = step_;
+  time = time_;
+}
+
+void PeridigmNS::BondBreakageLog::recordBrokenBond(int pointGlobalID, int neighborGlobalID) {
+  if(!enabled)
+    return;
+  if(!currentStepBonds.insert(make_pair(pointGlobalID, neighborGlobalID)).second)
+    return;
+  pack(step);
+  pack(time);
+  pack(pointGlobalID);
+  pack(neighborGlobalID);
+  if(++numBufferedRecords >= bufferSize)
+    flush();
+}
+
+void PeridigmNS::BondBreakageLog::flush() {
+  if(!enabled || numBufferedRecords == 0)
+    return;
+  file.write(&buffer[0], buffer.size());
+  file.flush();
+  buffer.clear();
+  numBufferedRecords = 0;
+}
+
+void PeridigmNS::BondBreakageLog::finalize() {
+  if(!enabled)
+    return;
+  flush();
+  file.close();
+  currentStepBonds.clear();
+  enabled = false;
+}
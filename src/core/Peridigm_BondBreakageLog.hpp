@@ -0,0 +1,143 @@
+/*! \file Peridigm_BondBreakageLog.hpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+
+#ifndef PERIDIGM_BONDBREAKAGELOG_HPP
+#define PERIDIGM_BONDBREAKAGELOG_HPP
+
+#include <Teuchos_ParameterList.hpp>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <set>
+
+namespace PeridigmNS {
+
+/** \brief Optional log of bond-breaking events.
+ *
+ *  When enabled, damage models record a (step, time, point global id, neighbor global id) entry
+ *  the first time a bond breaks.  Each processor buffers its records and appends them to its own
+ *  binary file, named <File Name>.bbl in serial and <File Name>.bbl.<NumProc>.<MyPID> in parallel.
+ *  The file starts with the characters "PDBB" followed by the int32 values version, MyPID, and NumProc;
+ *  each record is packed as int32 step, float64 time, int32 point id, int32 neighbor id.
+ *  A broken bond is recorded once by each processor that owns one of its end points.
+ *  See scripts/read_bond_breakage_log.py for a reader.
+ */
+class BondBreakageLog {
+
+public:
+
+  //! Singleton.
+  static BondBreakageLog & self();
+
+  //! Destructor, flushes and closes the log file.
+  ~BondBreakageLog();
+
+  //! Open the log file; params is the "Bond Breakage Log" parameter list.
+  void initialize(const Teuchos::ParameterList& params, int myPID, int numProc);
+
+  //! Returns true if bond-breaking events are being recorded.
+  bool isEnabled() const { return enabled; }
+
+  //! Set the step number and time assigned to subsequent records.
+  void setStep(int step, double time);
+
+  //! Step number assigned to subsequent records.
+  int getStep() const { return step; }
+
+  //! Record that the bond between the given points broke during the current step.
+  void recordBrokenBond(int pointGlobalID, int neighborGlobalID);
+
+  //! Write the buffered records to disk.
+  void flush();
+
+  //! Flush and close the log file.
+  void finalize();
+
+  //! Size in bytes of a single record in the log file.
+  static const int recordSize = 3*sizeof(int) + sizeof(double);
+
+private:
+
+  //! Constructor, private to prohibit use.
+  BondBreakageLog();
+
+  // Private to prohibit use.
+  BondBreakageLog(const BondBreakageLog&);
+
+  // Private to prohibit use.
+  BondBreakageLog& operator=(const BondBreakageLog&);
+
+  //! Append a value to the buffer in native byte order.
+  template<class T> void pack(const T& value);
+
+  //! Flag indicating that the log is active.
+  bool enabled;
+
+  //! Output stream for this processor's log file.
+  std::ofstream file;
+
+  //! Number of records held in memory before they are written to disk.
+  int bufferSize;
+
+  //! Packed records waiting to be written.
+  std::vector<char> buffer;
+
+  //! Number of records in the buffer.
+  int numBufferedRecords;
+
+  //! Current step number and time.
+  int step;
+  double time;
+
+  //! Bonds recorded during the current step, used to discard duplicates from repeated evaluations within a step (e.g., nonlinear solver iterations).
+  std::set< std::pair<int,int> > currentStepBonds;
+};
+
+}
+
+#endif // PERIDIGM_BONDBREAKAGELOG_HPP
@@ -53,6 +53,8 @@
 #include "Peridigm_Timer.hpp"
 #include "Peridigm_Enums.hpp"
 #include "Peridigm.hpp"
+#include <Epetra_MultiVector.h>
+#include <Epetra_Import.h>
 
 using namespace std;
 
@@ -68,6 +70,17 @@ PeridigmNS::BoundaryAndInitialConditionManager::BoundaryAndInitialConditionManag
 
 void PeridigmNS::BoundaryAndInitialConditionManager::initialize(Teuchos::RCP<Discretization> discretization)
 {
+  createBoundaryConditions();
+
+  initializeNodeSets(discretization);
+}
+
+void PeridigmNS::BoundaryAndInitialConditionManager::createBoundaryConditions()
+{
+  boundaryConditions.clear();
+  initialConditions.clear();
+  forceContributions.clear();
+
   bool hasPrescDisp = false;
   bool hasPrescVel = false;
 
@@ -198,8 +211,6 @@ void PeridigmNS::BoundaryAndInitialConditionManager::initialize(Teuchos::RCP<Dis
 
   if(createRankDeficientNodesNodeSet)
     createRankDeficientBC();
-
-  initializeNodeSets(discretization);
 }
 
 void PeridigmNS::BoundaryAndInitialConditionManager::createRankDeficientBC()
@@ -303,6 +314,54 @@ void PeridigmNS::BoundaryAndInitialConditionManager::initializeNodeSets(Teuchos:
         ++nIt;
     }
   }
+
+  invalidateNodeSetCaches();
+}
+
+void PeridigmNS::BoundaryAndInitialConditionManager::rebalance(Teuchos::RCP<const Epetra_BlockMap> currentOneDimensionalMap,
+                                                               Teuchos::RCP<const Epetra_BlockMap> rebalancedOneDimensionalMap)
+{
+  // The boundary conditions hold views into the mothership vectors, so they are recreated against the new vectors
+  createBoundaryConditions();
+
+  if(nodeSets->size() == 0)
+    return;
+
+  // Migrate the node sets by flagging their members, one column per node set, and importing the flags
+  int numNodeSets = static_cast<int>(nodeSets->size());
+  Epetra_MultiVector currentFlags(*currentOneDimensionalMap, numNodeSets);
+  Epetra_MultiVector rebalancedFlags(*rebalancedOneDimensionalMap, numNodeSets);
+  int nodeSetIndex = 0;
+  for(map< string, vector<int> >::iterator it = nodeSets->begin() ; it != nodeSets->end() ; it++, nodeSetIndex++){
+    const vector<int>& nodeSet = it->second;
+    for(unsigned int i=0 ; i<nodeSet.size() ; ++i)
+      currentFlags[nodeSetIndex][currentOneDimensionalMap->LID(nodeSet[i])] = 1.0;
+  }
+
+  Epetra_Import importer(*rebalancedOneDimensionalMap, *currentOneDimensionalMap);
+  rebalancedFlags.Import(currentFlags, importer, Insert);
+
+  nodeSetIndex = 0;
+  for(map< string, vector<int> >::iterator it = nodeSets->begin() ; it != nodeSets->end() ; it++, nodeSetIndex++){
+    vector<int>& nodeSet = it->second;
+    nodeSet.clear();
+    for(int i=0 ; i<rebalancedOneDimensionalMap->NumMyElements() ; ++i){
+      if(rebalancedFlags[nodeSetIndex][i] != 0.0)
+        nodeSet.push_back(rebalancedOneDimensionalMap->GID(i));
+    }
+  }
+
+  invalidateNodeSetCaches();
+}
+
+void PeridigmNS::BoundaryAndInitialConditionManager::invalidateNodeSetCaches()
+{
+  for(unsigned i=0;i<boundaryConditions.size();++i)
+    boundaryConditions[i]->invalidateLocalNodeIDs();
+  for(unsigned i=0;i<initialConditions.size();++i)
+    initialConditions[i]->invalidateLocalNodeIDs();
+  for(unsigned i=0;i<forceContributions.size();++i)
+    forceContributions[i]->invalidateLocalNodeIDs();
 }
 
 void PeridigmNS::BoundaryAndInitialConditionManager::applyInitialConditions(){
@@ -327,6 +386,10 @@ void PeridigmNS::BoundaryAndInitialConditionManager::applyForceContributions(con
   for(unsigned i=0;i<forceContributions.size();++i){
     forceContributions[i]->apply(nodeSets,timeCurrent,timePrevious);
   }
+  // add the force density applied by the calling application, if any
+  Teuchos::RCP<Epetra_Vector> appliedExternalForce = peridigm->getAppliedExternalForce();
+  if(!appliedExternalForce.is_null())
+    peridigm->getExternalForce()->Update(1.0, *appliedExternalForce, 1.0);
 }
 
 void PeridigmNS::BoundaryAndInitialConditionManager::clearForceContributions(){
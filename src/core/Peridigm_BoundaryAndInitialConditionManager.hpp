@@ -77,14 +77,24 @@ namespace PeridigmNS {
     //! Initialize boundary conditions, etc.
     void initialize(Teuchos::RCP<Discretization> discretization);
 
+    //! Create the boundary conditions, initial conditions, and force contributions
+    void createBoundaryConditions();
+
     //! Initialize the node sets on the bc manager
     void initializeNodeSets(Teuchos::RCP<Discretization> discretization);
 
+    //! Recreate the boundary conditions and migrate the node sets after the mothership vectors have been rebalanced
+    void rebalance(Teuchos::RCP<const Epetra_BlockMap> currentOneDimensionalMap,
+                   Teuchos::RCP<const Epetra_BlockMap> rebalancedOneDimensionalMap);
+
     //! Get node sets.
     Teuchos::RCP< std::map< std::string, std::vector<int> > > getNodeSets() {
       return nodeSets;
     }
 
+    //! Notify the boundary conditions, initial conditions, and force contributions that the node sets have changed
+    void invalidateNodeSetCaches();
+
     //! Create a placeholder boundary condition to take nodes that become rank deficient
     void createRankDeficientBC();
 
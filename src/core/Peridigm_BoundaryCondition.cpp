@@ -48,6 +48,7 @@
 #include "Peridigm_BoundaryCondition.hpp"
 #include "Peridigm.hpp"
 #include <boost/math/special_functions/fpclassify.hpp>
+#include <iterator>
 
 
 using namespace std;
@@ -58,7 +59,9 @@ PeridigmNS::BoundaryCondition::BoundaryCondition(const string & name_,const Teuc
   toVector(toVector_),
   coord(0),
   tensorOrder(SCALAR),
-  isCumulative(isCumulative_)
+  isCumulative(isCumulative_),
+  isSpatiallyVarying(true),
+  cacheIsValid(false)
 {
   bcType = to_boundary_condition_type(bcParams_);
   string nodeSet = bcParams_.get<string>("Node Set");
@@ -66,13 +69,14 @@ PeridigmNS::BoundaryCondition::BoundaryCondition(const string & name_,const Teuc
   nodeSetName = nodeSet;
   coord = to_index(to_spatial_coordinate(bcParams_));
   function = bcParams_.get<string>("Value");
-  // set up RTCompiler
-  rtcFunction = Teuchos::rcp<PG_RuntimeCompiler::Function>(new PG_RuntimeCompiler::Function(5, "rtcBoundaryConditionFunction"));
-  rtcFunction->addVar("double", "x");
-  rtcFunction->addVar("double", "y");
-  rtcFunction->addVar("double", "z");
-  rtcFunction->addVar("double", "t");
-  rtcFunction->addVar("double", "value");
+  // compile the function once
+  vector<string> variableNames;
+  variableNames.push_back("x");
+  variableNames.push_back("y");
+  variableNames.push_back("z");
+  variableNames.push_back("t");
+  expression = Teuchos::rcp(new Expression(function, variableNames, "rtcBoundaryConditionFunction"));
+  isSpatiallyVarying = expression->dependsOn(0) || expression->dependsOn(1) || expression->dependsOn(2);
 
   if(toVector->Map().ElementSize()==1)
   {
@@ -85,56 +89,80 @@ PeridigmNS::BoundaryCondition::BoundaryCondition(const string & name_,const Teuc
     TEUCHOS_TEST_FOR_EXCEPTION(true,std::invalid_argument,"ERROR: Boundary conditions have not been implemented for fields of tensor order.");
 }
 
-void PeridigmNS::BoundaryCondition::evaluateParser(const int & localNodeID, double & currentValue, double & previousValue, const double & timeCurrent, const double & timePrevious){
-  Teuchos::RCP<Epetra_Vector> x = peridigm->getX();
-  const Epetra_BlockMap& threeDimensionalMap = x->Map();
-  TEUCHOS_TEST_FOR_EXCEPT_MSG(threeDimensionalMap.ElementSize() != 3, "**** setVectorValues() must be called with map having element size = 3.\n");
+const std::vector<int> & PeridigmNS::BoundaryCondition::getLocalNodeIDs(Teuchos::RCP< std::map< std::string, std::vector<int> > > nodeSets){
+
+  const Epetra_BlockMap& map = toVector->Map();
+
+  if(cacheIsValid)
+    return cachedLocalNodeIDs;
 
-  bool success(true);
-  // set the coordinates and set the return value to 0.0
-  if(success)
-    rtcFunction->varValueFill(0, (*x)[localNodeID*3]);
-  if(success)
-    success = rtcFunction->varValueFill(1, (*x)[localNodeID*3 + 1]);
-  if(success)
-    success = rtcFunction->varValueFill(2, (*x)[localNodeID*3 + 2]);
-  if(success)
-    success = rtcFunction->varValueFill(4, 0.0);
-  // evaluate at previous time
-  if(success)
-    success = rtcFunction->varValueFill(3, timePrevious);
-  if(success)
-    success = rtcFunction->execute();
-  if(success)
-    previousValue = rtcFunction->getValueOfVar("value");
-  // evaluate at current time
-  if(success)
-    success = rtcFunction->varValueFill(3, timeCurrent);
-  if(success)
-    success = rtcFunction->execute();
-  if(success)
-    currentValue = rtcFunction->getValueOfVar("value");
-  if(!success){
-    string msg = "\n**** Error in BoundaryCondition::evaluateParser().\n";
-    msg += "**** " + rtcFunction->getErrors() + "\n";
-    TEUCHOS_TEST_FOR_EXCEPT_MSG(!success, msg);
+  cachedLocalNodeIDs.clear();
+
+  // apply the bc to every element in the entire domain
+  if(to_set_definition(nodeSetName)==FULL_DOMAIN){
+    cachedLocalNodeIDs.resize(map.NumMyElements());
+    for(int localNodeID = 0; localNodeID < map.NumMyElements(); localNodeID++)
+      cachedLocalNodeIDs[localNodeID] = localNodeID;
+    cacheIsValid = true;
+    return cachedLocalNodeIDs;
   }
 
-  // if this is any other boundary condition besides prescribed displacement
-  // get the previous value from evaluating the string function as above
-  // if it is a perscribed displacement bc, check to see if the increment is
-  // zero. This could happen if the user specifies a constant prescribed displacement.
-  // If so, the increment should be the current prescribed value
-  // minus the existing field value instead of the parser evaluation
-  if(bcType==PRESCRIBED_DISPLACEMENT && currentValue - previousValue == 0.0)
-  {
-    Teuchos::RCP<Epetra_Vector> previousDisplacement = peridigm->getU();
-    previousValue = (*previousDisplacement)[localNodeID*3 + coord];
+  // apply the bc only to specific node sets
+  std::map< std::string, std::vector<int> >::iterator itBegin;
+  std::map< std::string, std::vector<int> >::iterator itEnd;
+  if (to_set_definition(nodeSetName) == ALL_SETS){
+    itBegin = nodeSets->begin();
+    itEnd = nodeSets->end();
+  }
+  else{
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(nodeSets->find(nodeSetName) == nodeSets->end(),
+                                "**** Error in BoundaryCondition::getLocalNodeIDs(), node set not found: " + nodeSetName + "\n");
+    itBegin = nodeSets->find(nodeSetName);
+    itEnd = itBegin; itEnd++;
   }
 
-  // TODO: we should revisit how prescribed boundary conditions interact with initial conditions
-  // in the case that the prescribed boundary condition at time zero doesn't match the inital condition
-  // who wins?
+  for(std::map<std::string,std::vector<int> > ::iterator setIt=itBegin;setIt!=itEnd;++setIt){
+    const vector<int> & nodeList = setIt->second;
+    for(unsigned int i=0 ; i<nodeList.size() ; i++){
+      int localNodeID = map.LID(nodeList[i]);
+      if(localNodeID != -1)
+        cachedLocalNodeIDs.push_back(localNodeID);
+    }
+  }
+  cacheIsValid = true;
+
+  return cachedLocalNodeIDs;
+}
+
+void PeridigmNS::BoundaryCondition::evaluateFunction(const std::vector<int> & localNodeIDs, const double & time, std::vector<double> & values){
+
+  const int numNodes = static_cast<int>(localNodeIDs.size());
+  values.resize(numNodes);
+  if(numNodes == 0)
+    return;
+
+  if(!isSpatiallyVarying){
+    // the function depends only on t, evaluate once for the whole set
+    const double variables[4] = {0.0, 0.0, 0.0, time};
+    const double value = expression->evaluate(variables);
+    for(int i=0 ; i<numNodes ; i++)
+      values[i] = value;
+    return;
+  }
+
+  Teuchos::RCP<Epetra_Vector> x = peridigm->getX();
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(x->Map().ElementSize() != 3, "**** evaluateFunction() must be called with map having element size = 3.\n");
+  const double* xPtr = x->Values();
+  coordinates.resize(3*numNodes);
+  for(int i=0 ; i<numNodes ; i++){
+    const int localNodeID = localNodeIDs[i];
+    coordinates[3*i]     = xPtr[localNodeID*3];
+    coordinates[3*i + 1] = xPtr[localNodeID*3 + 1];
+    coordinates[3*i + 2] = xPtr[localNodeID*3 + 2];
+  }
+  const double* variables[4] = {&coordinates[0], &coordinates[1], &coordinates[2], &time};
+  const int strides[4] = {3, 3, 3, 0};
+  expression->evaluate(numNodes, variables, strides, &values[0]);
 }
 
 PeridigmNS::DirichletBC::DirichletBC(const string & name_,const Teuchos::ParameterList& bcParams_,Teuchos::RCP<Epetra_Vector> toVector_,Peridigm * peridigm_,const bool isCumulative_)
@@ -145,60 +173,17 @@ void PeridigmNS::DirichletBC::apply(Teuchos::RCP< std::map< std::string, std::ve
   // get the tensor order of the bc field:
   const int fieldDimension = to_dimension_size(tensorOrder);
 
-  string rtcFunctionString = function;
-  if(rtcFunctionString.find("value") == string::npos)
-    rtcFunctionString = "value = " + rtcFunctionString;
-  bool success = rtcFunction->addBody(rtcFunctionString);
-  if(!success){
-    string msg = "\n**** Error:  rtcFunction->addBody(function) returned error code in PeridigmNS::DirichletBC::apply().\n";
-    msg += "**** " + rtcFunction->getErrors() + "\n";
-    TEUCHOS_TEST_FOR_EXCEPT_MSG(!success, msg);
-  }
-
-  // apply the bc to every element in the entire domain
-  if(to_set_definition(nodeSetName)==FULL_DOMAIN)
-  {
-    for(int localNodeID = 0; localNodeID < toVector->Map().NumMyElements(); localNodeID++) {
-      double currentValue = 0.0;
-      double previousValue = 0.0;
-      evaluateParser(localNodeID,currentValue,previousValue,timeCurrent);
-      TEUCHOS_TEST_FOR_EXCEPT_MSG(!boost::math::isfinite(currentValue), "**** NaN returned by dirichlet BC evaluation.\n");
-      if(isCumulative)
-        (*toVector)[localNodeID*fieldDimension + coord] += currentValue;
-      else
-        (*toVector)[localNodeID*fieldDimension + coord] = currentValue;
-    }
-  }
-  // apply the bc only to specific node sets
-  else{
-    std::map< std::string, std::vector<int> >::iterator itBegin;
-    std::map< std::string, std::vector<int> >::iterator itEnd;
-    if (to_set_definition(nodeSetName) == ALL_SETS){
-      itBegin = nodeSets->begin();
-      itEnd = nodeSets->end();
-    }
-    else{
-      TEUCHOS_TEST_FOR_EXCEPT_MSG(nodeSets->find(nodeSetName) == nodeSets->end(),
-                                  "**** Error in DirichletBC::apply(), node set not found: " + nodeSetName + "\n");
-      itBegin = nodeSets->find(nodeSetName);
-      itEnd = itBegin; itEnd++;
-    }
-    for(std::map<std::string,std::vector<int> > ::iterator setIt=itBegin;setIt!=itEnd;++setIt){
-      vector<int> & nodeList = setIt->second;
-      for(unsigned int i=0 ; i<nodeList.size() ; i++){
-        int localNodeID = toVector->Map().LID(nodeList[i]);
-        if(localNodeID != -1) {
-          double currentValue = 0.0;
-          double previousValue = 0.0;
-          evaluateParser(localNodeID,currentValue,previousValue,timeCurrent);
-          TEUCHOS_TEST_FOR_EXCEPT_MSG(!boost::math::isfinite(currentValue), "**** NaN returned by dirichlet BC evaluation.\n");
-          if(isCumulative)
-            (*toVector)[localNodeID*fieldDimension + coord] += currentValue;
-          else
-            (*toVector)[localNodeID*fieldDimension + coord] = currentValue;
-        }
-      }
-    }
+  const std::vector<int> & localNodeIDs = getLocalNodeIDs(nodeSets);
+  evaluateFunction(localNodeIDs, timeCurrent, currentValues);
+
+  double* toVectorPtr = toVector->Values();
+  for(unsigned int i=0 ; i<localNodeIDs.size() ; i++){
+    const double currentValue = currentValues[i];
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(!boost::math::isfinite(currentValue), "**** NaN returned by dirichlet BC evaluation.\n");
+    if(isCumulative)
+      toVectorPtr[localNodeIDs[i]*fieldDimension + coord] += currentValue;
+    else
+      toVectorPtr[localNodeIDs[i]*fieldDimension + coord] = currentValue;
   }
 }
 
@@ -215,68 +200,37 @@ PeridigmNS::DirichletIncrementBC::DirichletIncrementBC(const string & name_,
 
 void PeridigmNS::DirichletIncrementBC::apply(Teuchos::RCP< std::map< std::string, std::vector<int> > > nodeSets, const double & timeCurrent, const double & timePrevious){
   // for temperature bcs, the previous time should always be zero
-	const double timePrevious_ = (bcType==PRESCRIBED_TEMPERATURE || bcType==PRESCRIBED_INTERNAL_HEAT_SOURCE) ? 0.0 : timePrevious;;
+  const double timePrevious_ = (bcType==PRESCRIBED_TEMPERATURE || bcType==PRESCRIBED_INTERNAL_HEAT_SOURCE) ? 0.0 : timePrevious;
 
   // get the tensor order of the bc field:
   const int fieldDimension = to_dimension_size(tensorOrder);
 
-  string rtcFunctionString = function;
-  if(rtcFunctionString.find("value") == string::npos)
-    rtcFunctionString = "value = " + rtcFunctionString;
-  bool success = rtcFunction->addBody(rtcFunctionString);
-  if(!success){
-    string msg = "\n**** Error:  rtcFunction->addBody(function) returned nonzero error code in PeridigmNS::DirichletBC::apply().\n";
-    msg += "**** " + rtcFunction->getErrors() + "\n";
-    TEUCHOS_TEST_FOR_EXCEPT_MSG(!success, msg);
-  }
+  const std::vector<int> & localNodeIDs = getLocalNodeIDs(nodeSets);
+  evaluateFunction(localNodeIDs, timePrevious_, previousValues);
+  evaluateFunction(localNodeIDs, timeCurrent, currentValues);
 
-  // apply the bc to every element in the entire domain
-  if(to_set_definition(nodeSetName)==FULL_DOMAIN)
-  {
-    for(int localNodeID = 0; localNodeID < toVector->Map().NumMyElements(); localNodeID++) {
-      double currentValue = 0.0;
-      double previousValue = 0.0;
-      evaluateParser(localNodeID,currentValue,previousValue,timeCurrent,timePrevious_);
-      const double value = coeff * (currentValue - previousValue)
-                 + deltaTCoeff * (currentValue - previousValue) * (1.0 / (timeCurrent - timePrevious_));
-      TEUCHOS_TEST_FOR_EXCEPT_MSG(!boost::math::isfinite(value), "**** NaN returned by dirichlet increment BC evaluation.\n");
-      if(isCumulative)
-        (*toVector)[localNodeID*fieldDimension + coord] += value;
-      else
-        (*toVector)[localNodeID*fieldDimension + coord] = value;
-    }
-  }
-  else
-  {
-    std::map< std::string, std::vector<int> >::iterator itBegin;
-    std::map< std::string, std::vector<int> >::iterator itEnd;
-    if (to_set_definition(nodeSetName) == ALL_SETS){
-      itBegin = nodeSets->begin();
-      itEnd = nodeSets->end();
-    }
-    else{
-      TEUCHOS_TEST_FOR_EXCEPT_MSG(nodeSets->find(nodeSetName) == nodeSets->end(),
-                                  "**** Error in DirichletIncrementBC::apply(), node set not found: " + nodeSetName + "\n");
-      itBegin = nodeSets->find(nodeSetName);
-      itEnd = itBegin; itEnd++;
-    }
-    for(std::map<std::string,std::vector<int> > ::iterator setIt=itBegin;setIt!=itEnd;++setIt){
-      vector<int> & nodeList = setIt->second;
-      for(unsigned int i=0 ; i<nodeList.size() ; i++){
-        int localNodeID = toVector->Map().LID(nodeList[i]);
-        if(localNodeID != -1) {
-          double currentValue = 0.0;
-          double previousValue = 0.0;
-          evaluateParser(localNodeID,currentValue,previousValue,timeCurrent,timePrevious_);
-          const double value = coeff * (currentValue - previousValue)
-                         + deltaTCoeff * (currentValue - previousValue) * (1.0 / (timeCurrent - timePrevious_));
-          TEUCHOS_TEST_FOR_EXCEPT_MSG(!boost::math::isfinite(value), "**** NaN returned by dirichlet increment BC evaluation.\n");
-          if(isCumulative)
-            (*toVector)[localNodeID*fieldDimension + coord] += value;
-          else
-            (*toVector)[localNodeID*fieldDimension + coord] = value;
-        }
-      }
-    }
+  // For a prescribed displacement, a zero increment can occur if the user specifies a constant prescribed
+  // displacement.  In that case the increment is the current prescribed value minus the existing displacement.
+  // TODO: we should revisit how prescribed boundary conditions interact with initial conditions
+  // in the case that the prescribed boundary condition at time zero doesn't match the inital condition
+  // who wins?
+  const double* uPtr = 0;
+  if(bcType==PRESCRIBED_DISPLACEMENT)
+    uPtr = peridigm->getU()->Values();
+
+  double* toVectorPtr = toVector->Values();
+  for(unsigned int i=0 ; i<localNodeIDs.size() ; i++){
+    const int localNodeID = localNodeIDs[i];
+    const double currentValue = currentValues[i];
+    double previousValue = previousValues[i];
+    if(uPtr != 0 && currentValue - previousValue == 0.0)
+      previousValue = uPtr[localNodeID*3 + coord];
+    const double value = coeff * (currentValue - previousValue)
+                   + deltaTCoeff * (currentValue - previousValue) * (1.0 / (timeCurrent - timePrevious_));
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(!boost::math::isfinite(value), "**** NaN returned by dirichlet increment BC evaluation.\n");
+    if(isCumulative)
+      toVectorPtr[localNodeID*fieldDimension + coord] += value;
+    else
+      toVectorPtr[localNodeID*fieldDimension + coord] = value;
   }
 }
@@ -49,15 +49,9 @@
 #define PERIDIGM_BOUNARYCONDITION_HPP
 
 #include "Peridigm_Enums.hpp"
+#include "Peridigm_Expression.hpp"
 #include <Epetra_Vector.h>
 
-#include <Trilinos_version.h>
-#if TRILINOS_MAJOR_MINOR_VERSION >= 111100
-#include "RTC_FunctionRTC.hh"
-#else
-#include "FunctionRTC.hh"
-#endif
-
 using namespace std;
 
 namespace PeridigmNS {
@@ -93,11 +87,19 @@ public:
   //! apply the boundary condition
   virtual void apply(Teuchos::RCP< std::map< std::string, std::vector<int> > > nodeSets, const double & timeCurrent=0.0, const double & timePrevious=0.0)=0;
 
-  //! evaluate function parser
-  void evaluateParser(const int & localNodeID, double & currentValue, double & previousValue, const double & timeCurrent=0.0, const double & timePrevious=0.0);
+  //! discard the cached local node ids; must be called whenever the node sets or the map of the bc vector change
+  void invalidateLocalNodeIDs(){cacheIsValid = false;}
 
 protected:
 
+  //! local ids of the nodes the bc applies to, rebuilt only after invalidateLocalNodeIDs()
+  const std::vector<int> & getLocalNodeIDs(Teuchos::RCP< std::map< std::string, std::vector<int> > > nodeSets);
+
+  /** \brief Evaluate the function at the given time for each of the given local ids.
+   *  The coordinates are gathered and the function is evaluated in a single batch; functions that do not
+   *  depend on x, y, or z are evaluated once and the result is broadcast to all nodes. */
+  void evaluateFunction(const std::vector<int> & localNodeIDs, const double & time, std::vector<double> & values);
+
   //! Ref your parent instantiator
   Peridigm  * peridigm;
 
@@ -119,13 +121,29 @@ protected:
   //! string defined funciton
   string function;
 
-  //! Run-time compiler, used as function parser
-  Teuchos::RCP<PG_RuntimeCompiler::Function> rtcFunction;
+  //! Compiled function, with variables x, y, z, and t
+  Teuchos::RCP<Expression> expression;
 
   Tensor_Order tensorOrder;
 
   bool isCumulative;
 
+  //! true if the function references x, y, or z
+  bool isSpatiallyVarying;
+
+  //! true if cachedLocalNodeIDs reflects the current node sets
+  bool cacheIsValid;
+
+  //! cached local ids of the nodes the bc applies to
+  std::vector<int> cachedLocalNodeIDs;
+
+  //! scratch space for the gathered coordinates
+  std::vector<double> coordinates;
+
+  //! scratch space for function values at the current and previous time
+  std::vector<double> currentValues;
+  std::vector<double> previousValues;
+
 private:
 
   // Private to prohibit use.
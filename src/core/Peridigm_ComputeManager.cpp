@@ -55,7 +55,8 @@
 
 using namespace std;
 
-PeridigmNS::ComputeManager::ComputeManager( Teuchos::RCP<Teuchos::ParameterList> params, Teuchos::RCP<const Epetra_Comm> epetraComm, Teuchos::RCP<const Teuchos::ParameterList> computeClassGlobalParams ) {
+PeridigmNS::ComputeManager::ComputeManager( Teuchos::RCP<Teuchos::ParameterList> params, Teuchos::RCP<const Epetra_Comm> epetraComm_, Teuchos::RCP<const Teuchos::ParameterList> computeClassGlobalParams )
+  : epetraComm(epetraComm_) {
 
   Teuchos::RCP<Compute> compute;
 
@@ -129,6 +130,8 @@ PeridigmNS::ComputeManager::ComputeManager( Teuchos::RCP<Teuchos::ParameterList>
       #include "compute_includes.hpp"
     #undef  COMPUTE_CLASS
   }
+
+  isCurrent.resize(computeObjects.size(), false);
 }
 
 Teuchos::ParameterList PeridigmNS::ComputeManager::getValidParameterList() {
@@ -182,6 +185,26 @@ void PeridigmNS::ComputeManager::initialize(Teuchos::RCP< vector<PeridigmNS::Blo
      computeObjects[i]->initialize(blocks);
   }
 
+  invalidate(Compute::REFERENCE_CONFIGURATION);
+}
+
+void PeridigmNS::ComputeManager::rebalance(Teuchos::RCP< vector<PeridigmNS::Block> > blocks) {
+
+  for(unsigned int i=0 ; i<computeObjects.size() ; ++i){
+     computeObjects[i]->rebalance(blocks);
+  }
+
+  // The owned points and their neighborhoods have been redistributed, so nothing computed previously is current
+  invalidate(Compute::REFERENCE_CONFIGURATION);
+}
+
+void PeridigmNS::ComputeManager::invalidate(PeridigmNS::Compute::Dependency changedInput) {
+
+  // A change in an input also invalidates the compute objects that depend on more frequently changing inputs
+  for(unsigned int i=0 ; i<computeObjects.size() ; ++i){
+    if(computeObjects[i]->getDependency() >= changedInput)
+      isCurrent[i] = false;
+  }
 }
 
 void PeridigmNS::ComputeManager::pre_compute(Teuchos::RCP< vector<PeridigmNS::Block> > blocks) {
@@ -198,8 +221,23 @@ void PeridigmNS::ComputeManager::compute(Teuchos::RCP< vector<PeridigmNS::Block>
 
   // \todo Identify what the desired behavior is for compute classes and multiple blocks!
 
+  if(computeObjects.size() == 0)
+    return;
+
+  // Gather the local contributions of all compute objects, reduce them together, then let each compute object finish.
+  // Compute objects whose inputs have not changed since they were last run are skipped; isCurrent is identical on all
+  // processors, so the number of reduced values still matches.
+  reduction.clear();
+  for(unsigned int i=0 ; i<computeObjects.size() ; ++i){
+    if(!isCurrent[i])
+      computeObjects[i]->computeLocal(blocks, reduction);
+  }
+  reduction.reduce(*epetraComm);
   for(unsigned int i=0 ; i<computeObjects.size() ; ++i){
-     computeObjects[i]->compute(blocks);
+    if(!isCurrent[i]){
+      computeObjects[i]->finishCompute(blocks, reduction);
+      isCurrent[i] = (computeObjects[i]->getDependency() != Compute::EVERY_STEP);
+    }
   }
 
 }
@@ -76,12 +76,18 @@ namespace PeridigmNS {
     //! Initialize the compute classes
     virtual void initialize(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks);
 
-    //! Fire the individual compute objects
+    //! Notify the compute classes that the blocks have been rebalanced
+    virtual void rebalance(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks);
+
+    //! Fire the individual compute objects, combining their global reductions into one collective call per reduction operation
     virtual void compute(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks);
 
     //! Pre-compute initialization of the compute objects
     virtual void pre_compute(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks);
 
+    //! Flag the compute objects that depend on the given input for recomputation on the next call to compute()
+    virtual void invalidate(PeridigmNS::Compute::Dependency changedInput);
+
 
   private:
     
@@ -96,6 +102,15 @@ namespace PeridigmNS {
     
     //! Individual compute objects
     std::vector< Teuchos::RCP<PeridigmNS::Compute> > computeObjects;
+
+    //! Communicator used for the combined global reductions
+    Teuchos::RCP<const Epetra_Comm> epetraComm;
+
+    //! Buffer collecting the global reductions of all compute objects
+    ComputeReduction reduction;
+
+    //! Flags marking the compute objects whose results are current and need not be recomputed
+    std::vector<bool> isCurrent;
   };  
 }
  
@@ -83,6 +83,10 @@ void PeridigmNS::ContactBlock::initialize(Teuchos::RCP<const Epetra_BlockMap> gl
   fieldIds.insert(fieldIds.end(), contactModelFieldIds.begin(), contactModelFieldIds.end());
 
   BlockBase::initializeDataManager(fieldIds);
+
+  contactPairList.initialize(neighborhoodData->NumOwnedPoints(),
+                             neighborhoodData->OwnedIDs(),
+                             neighborhoodData->NeighborhoodList());
 }
 
 void PeridigmNS::ContactBlock::rebalance(Teuchos::RCP<const Epetra_BlockMap> rebalancedGlobalOwnedScalarPointMap,
@@ -104,6 +108,10 @@ void PeridigmNS::ContactBlock::rebalance(Teuchos::RCP<const Epetra_BlockMap> reb
   neighborhoodData = createNeighborhoodDataFromGlobalNeighborhoodData(rebalancedGlobalOverlapScalarPointMap,
                                                                       rebalancedGlobalNeighborhoodData);
 
+  contactPairList.initialize(neighborhoodData->NumOwnedPoints(),
+                             neighborhoodData->OwnedIDs(),
+                             neighborhoodData->NeighborhoodList());
+
   dataManager->rebalance(ownedScalarPointMap,
                          overlapScalarPointMap,
                          ownedVectorPointMap,
@@ -88,6 +88,11 @@ class ContactBlock : public BlockBase {
       contactModel = contactModel_;
     }
 
+    //! Get the list of contact pairs, built from the block's contact neighborhood data
+    const PeridigmNS::ContactPairList& getContactPairList() const {
+      return contactPairList;
+    }
+
     //! Rebalance the block based on rebalanced global maps and neighborhood information.
     void rebalance(Teuchos::RCP<const Epetra_BlockMap> rebalancedGlobalOwnedScalarPointMap,
                    Teuchos::RCP<const Epetra_BlockMap> rebalancedGlobalOverlapScalarPointMap,
@@ -101,6 +106,9 @@ class ContactBlock : public BlockBase {
 
     //! The contact model
     Teuchos::RCP<const PeridigmNS::ContactModel> contactModel;
+
+    //! Contact pairs in structure-of-arrays form, rebuilt whenever the neighborhood data changes
+    PeridigmNS::ContactPairList contactPairList;
   };
 }
 
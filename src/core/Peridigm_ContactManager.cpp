@@ -54,6 +54,7 @@
 
 #include "PdZoltan.h"
 #include "NeighborhoodList.h"
+#include <cmath>
 
 using namespace std;
 
@@ -62,7 +63,8 @@ using namespace std;
 PeridigmNS::ContactManager::ContactManager(const Teuchos::ParameterList& contactParams,
                                            Teuchos::RCP<Discretization> disc,
                                            Teuchos::RCP<Teuchos::ParameterList> peridigmParams)
-  : verbose(false), myPID(-1), params(contactParams), contactRebalanceFrequency(0), contactSearchRadius(0.0),
+  : verbose(false), myPID(-1), params(contactParams), contactRebalanceFrequency(0), contactSearchRadius(0.0), contactSkinDistance(0.0),
+    surfacePointsOnly(false), surfaceBondFraction(0.9),
     blockIdFieldId(-1), volumeFieldId(-1), coordinatesFieldId(-1), velocityFieldId(-1), contactForceDensityFieldId(-1)
 {
   if(contactParams.isParameter("Verbose"))
@@ -82,6 +84,17 @@ PeridigmNS::ContactManager::ContactManager(const Teuchos::ParameterList& contact
   if(!contactParams.isParameter("Search Frequency"))
     TEUCHOS_TEST_FOR_EXCEPTION(true, Teuchos::Exceptions::InvalidParameter, "Contact parameter \"Search Frequency\" not specified.");
   contactRebalanceFrequency = contactParams.get<int>("Search Frequency");
+  // Optional skin distance; when positive, the search radius is padded by the skin and a new search
+  // is performed only when points have moved far enough to invalidate the current contact neighbor list
+  if(contactParams.isParameter("Skin Distance"))
+    contactSkinDistance = contactParams.get<double>("Skin Distance");
+  TEUCHOS_TEST_FOR_EXCEPTION(contactSkinDistance < 0.0, Teuchos::Exceptions::InvalidParameter, "Contact parameter \"Skin Distance\" must be non-negative.");
+  // Optional restriction of the contact search to surface points and damaged points
+  if(contactParams.isParameter("Surface Points Only"))
+    surfacePointsOnly = contactParams.get<bool>("Surface Points Only");
+  if(contactParams.isParameter("Surface Bond Fraction"))
+    surfaceBondFraction = contactParams.get<double>("Surface Bond Fraction");
+  TEUCHOS_TEST_FOR_EXCEPTION(surfaceBondFraction <= 0.0 || surfaceBondFraction > 1.0, Teuchos::Exceptions::InvalidParameter, "Contact parameter \"Surface Bond Fraction\" must be in (0, 1].");
 
   createContactInteractionsList(contactParams, disc);
 
@@ -493,17 +506,53 @@ void PeridigmNS::ContactManager::rebalance(int step)
 
   const Epetra_Comm& comm = oneDimensionalMap->Comm();
 
+  // With a skin distance, the existing contact neighbor list remains valid until two points
+  // could have closed the skin, that is, until twice the maximum displacement exceeds the skin
+  if(contactSkinDistance > 0.0 && !contactYAtLastSearch.is_null()){
+    double localMaxDisplacementSquared = 0.0;
+    double globalMaxDisplacementSquared = 0.0;
+    for(int i=0 ; i<contactY->MyLength() ; i+=3){
+      double dx = (*contactY)[i]   - (*contactYAtLastSearch)[i];
+      double dy = (*contactY)[i+1] - (*contactYAtLastSearch)[i+1];
+      double dz = (*contactY)[i+2] - (*contactYAtLastSearch)[i+2];
+      double displacementSquared = dx*dx + dy*dy + dz*dz;
+      if(displacementSquared > localMaxDisplacementSquared)
+        localMaxDisplacementSquared = displacementSquared;
+    }
+    comm.MaxAll(&localMaxDisplacementSquared, &globalMaxDisplacementSquared, 1);
+    if(2.0*std::sqrt(globalMaxDisplacementSquared) <= contactSkinDistance)
+      return;
+  }
+
   // \todo Handle serial case.  We don't need to rebalance, but we still want to update the contact search.
   QUICKGRID::Data rebalancedDecomp = currentConfigurationDecomp();
 
-  Teuchos::RCP<Epetra_BlockMap> rebalancedOneDimensionalMap = Teuchos::rcp(new Epetra_BlockMap(PdQuickGridDiscretization::getOwnedMap(comm, rebalancedDecomp, 1)));
-  Teuchos::RCP<const Epetra_Import> oneDimensionalMapImporter = Teuchos::rcp(new Epetra_Import(*rebalancedOneDimensionalMap, *oneDimensionalContactMap));
+  // if every point remains on the same processor, in the same order, the owned maps, importers,
+  // and contact mothership vectors are kept, and only the overlap maps and neighbor lists are rebuilt
+  bool partitionUnchanged = ownedPartitionUnchanged(rebalancedDecomp);
+
+  Teuchos::RCP<const Epetra_BlockMap> rebalancedOneDimensionalMap;
+  Teuchos::RCP<const Epetra_BlockMap> rebalancedThreeDimensionalMap;
+  Teuchos::RCP<const Epetra_BlockMap> rebalancedBondMap;
+  Teuchos::RCP<const Epetra_Import> oneDimensionalMapImporter;
+  Teuchos::RCP<const Epetra_Import> threeDimensionalMapImporter;
+  Teuchos::RCP<const Epetra_Import> bondMapImporter;
+
+  if(partitionUnchanged){
+    rebalancedOneDimensionalMap = oneDimensionalContactMap;
+    rebalancedThreeDimensionalMap = threeDimensionalContactMap;
+    rebalancedBondMap = bondContactMap;
+  }
+  else{
+    rebalancedOneDimensionalMap = Teuchos::rcp(new Epetra_BlockMap(PdQuickGridDiscretization::getOwnedMap(comm, rebalancedDecomp, 1)));
+    oneDimensionalMapImporter = Teuchos::rcp(new Epetra_Import(*rebalancedOneDimensionalMap, *oneDimensionalContactMap));
 
-  Teuchos::RCP<Epetra_BlockMap> rebalancedThreeDimensionalMap = Teuchos::rcp(new Epetra_BlockMap(PdQuickGridDiscretization::getOwnedMap(comm, rebalancedDecomp, 3)));
-  Teuchos::RCP<const Epetra_Import> threeDimensionalMapImporter = Teuchos::rcp(new Epetra_Import(*rebalancedThreeDimensionalMap, *threeDimensionalContactMap));
+    rebalancedThreeDimensionalMap = Teuchos::rcp(new Epetra_BlockMap(PdQuickGridDiscretization::getOwnedMap(comm, rebalancedDecomp, 3)));
+    threeDimensionalMapImporter = Teuchos::rcp(new Epetra_Import(*rebalancedThreeDimensionalMap, *threeDimensionalContactMap));
 
-  Teuchos::RCP<Epetra_BlockMap> rebalancedBondMap = createRebalancedBondMap(rebalancedOneDimensionalMap, oneDimensionalMapImporter);
-  Teuchos::RCP<const Epetra_Import> bondMapImporter = Teuchos::rcp(new Epetra_Import(*rebalancedBondMap, *bondContactMap));
+    rebalancedBondMap = createRebalancedBondMap(rebalancedOneDimensionalMap, oneDimensionalMapImporter);
+    bondMapImporter = Teuchos::rcp(new Epetra_Import(*rebalancedBondMap, *bondContactMap));
+  }
 
   // create a list of neighbors in the rebalanced configuration
   // this list has the global ID for each neighbor of each on-processor point (that is, on processor in the rebalanced configuration)
@@ -523,7 +572,10 @@ void PeridigmNS::ContactManager::rebalance(int step)
   // 3) keeps track of the additional off-processor IDs that need to be ghosted as a result of the contact search (offProcessorContactIDs)
   Teuchos::RCP< map<int, vector<int> > > contactNeighborGlobalIDs = Teuchos::rcp(new map<int, vector<int> >());
   Teuchos::RCP< set<int> > offProcessorContactIDs = Teuchos::rcp(new set<int>());
-  contactSearch(rebalancedOneDimensionalMap, rebalancedBondMap, rebalancedNeighborGlobalIDs, rebalancedDecomp, contactNeighborGlobalIDs, offProcessorContactIDs);
+  Teuchos::RCP<Epetra_Vector> rebalancedContactCandidates;
+  if(surfacePointsOnly)
+    rebalancedContactCandidates = createRebalancedContactCandidates(rebalancedOneDimensionalMap, rebalancedBondMap, oneDimensionalMapImporter);
+  contactSearch(rebalancedOneDimensionalMap, rebalancedBondMap, rebalancedNeighborGlobalIDs, rebalancedDecomp, contactNeighborGlobalIDs, offProcessorContactIDs, rebalancedContactCandidates);
 
   // add the off-processor IDs required for contact to the list of points that will be ghosted
   for(set<int>::const_iterator it=offProcessorContactIDs->begin() ; it!=offProcessorContactIDs->end() ; it++){
@@ -560,19 +612,21 @@ void PeridigmNS::ContactManager::rebalance(int step)
                                                                     rebalancedOneDimensionalOverlapMap);
   
   // rebalance the mothership (global) contact vectors
-  Teuchos::RCP<Epetra_MultiVector> rebalancedOneDimensionalMothership = Teuchos::rcp(new Epetra_MultiVector(*rebalancedOneDimensionalMap, oneDimensionalContactMothership->NumVectors()));
-  rebalancedOneDimensionalMothership->Import(*oneDimensionalContactMothership, *oneDimensionalMapImporter, Insert);
-  oneDimensionalContactMothership = rebalancedOneDimensionalMothership;
-  contactBlockIDs = Teuchos::rcp((*oneDimensionalContactMothership)(0), false);         // block ID
-  contactVolume = Teuchos::rcp((*oneDimensionalContactMothership)(1), false);           // cell volume
-
-  Teuchos::RCP<Epetra_MultiVector> rebalancedThreeDimensionalMothership = Teuchos::rcp(new Epetra_MultiVector(*rebalancedThreeDimensionalMap, threeDimensionalContactMothership->NumVectors()));
-  rebalancedThreeDimensionalMothership->Import(*threeDimensionalContactMothership, *threeDimensionalMapImporter, Insert);
-  threeDimensionalContactMothership = rebalancedThreeDimensionalMothership;
-  contactY = Teuchos::rcp((*threeDimensionalContactMothership)(0), false);             // current positions
-  contactV = Teuchos::rcp((*threeDimensionalContactMothership)(1), false);             // velocities
-  contactContactForce = Teuchos::rcp((*threeDimensionalContactMothership)(2), false);  // contact force
-  contactScratch = Teuchos::rcp((*threeDimensionalContactMothership)(3), false);       // scratch
+  if(!partitionUnchanged){
+    Teuchos::RCP<Epetra_MultiVector> rebalancedOneDimensionalMothership = Teuchos::rcp(new Epetra_MultiVector(*rebalancedOneDimensionalMap, oneDimensionalContactMothership->NumVectors()));
+    rebalancedOneDimensionalMothership->Import(*oneDimensionalContactMothership, *oneDimensionalMapImporter, Insert);
+    oneDimensionalContactMothership = rebalancedOneDimensionalMothership;
+    contactBlockIDs = Teuchos::rcp((*oneDimensionalContactMothership)(0), false);         // block ID
+    contactVolume = Teuchos::rcp((*oneDimensionalContactMothership)(1), false);           // cell volume
+
+    Teuchos::RCP<Epetra_MultiVector> rebalancedThreeDimensionalMothership = Teuchos::rcp(new Epetra_MultiVector(*rebalancedThreeDimensionalMap, threeDimensionalContactMothership->NumVectors()));
+    rebalancedThreeDimensionalMothership->Import(*threeDimensionalContactMothership, *threeDimensionalMapImporter, Insert);
+    threeDimensionalContactMothership = rebalancedThreeDimensionalMothership;
+    contactY = Teuchos::rcp((*threeDimensionalContactMothership)(0), false);             // current positions
+    contactV = Teuchos::rcp((*threeDimensionalContactMothership)(1), false);             // velocities
+    contactContactForce = Teuchos::rcp((*threeDimensionalContactMothership)(2), false);  // contact force
+    contactScratch = Teuchos::rcp((*threeDimensionalContactMothership)(3), false);       // scratch
+  }
 
   // rebalance the contact blocks
   for(contactBlockIt = contactBlocks->begin() ; contactBlockIt != contactBlocks->end() ; contactBlockIt++)
@@ -601,10 +655,49 @@ void PeridigmNS::ContactManager::rebalance(int step)
   bondContactMap = rebalancedBondMap;
 
   // Reset the importers for passing data between the mothership and contact mothership vectors
+  if(!partitionUnchanged){
+    oneDimensionalMothershipToContactMothershipImporter = Teuchos::rcp(new Epetra_Import(*oneDimensionalContactMap, *oneDimensionalMap));
+    threeDimensionalMothershipToContactMothershipImporter = Teuchos::rcp(new Epetra_Import(*threeDimensionalContactMap, *threeDimensionalMap));
+  }
+
+  // Record the positions at which the contact search was performed
+  if(contactSkinDistance > 0.0)
+    contactYAtLastSearch = Teuchos::rcp(new Epetra_Vector(*contactY));
+}
+
+void PeridigmNS::ContactManager::setMothershipMaps(Teuchos::RCP<const Epetra_BlockMap> oneDimensionalMap_,
+                                                   Teuchos::RCP<const Epetra_BlockMap> threeDimensionalMap_)
+{
+  oneDimensionalMap = Teuchos::rcp(new Epetra_BlockMap(*oneDimensionalMap_));
+  threeDimensionalMap = Teuchos::rcp(new Epetra_BlockMap(*threeDimensionalMap_));
+
   oneDimensionalMothershipToContactMothershipImporter = Teuchos::rcp(new Epetra_Import(*oneDimensionalContactMap, *oneDimensionalMap));
   threeDimensionalMothershipToContactMothershipImporter = Teuchos::rcp(new Epetra_Import(*threeDimensionalContactMap, *threeDimensionalMap));
 }
 
+bool PeridigmNS::ContactManager::ownedPartitionUnchanged(const QUICKGRID::Data& rebalancedDecomp) const {
+
+  int localUnchanged = 1;
+  int myNumElements = oneDimensionalContactMap->NumMyElements();
+  if(static_cast<int>(rebalancedDecomp.numPoints) != myNumElements)
+    localUnchanged = 0;
+  else{
+    const int* rebalancedGlobalIDs = rebalancedDecomp.myGlobalIDs.get();
+    const int* globalIDs = oneDimensionalContactMap->MyGlobalElements();
+    for(int i=0 ; i<myNumElements ; ++i){
+      if(rebalancedGlobalIDs[i] != globalIDs[i]){
+        localUnchanged = 0;
+        break;
+      }
+    }
+  }
+
+  int globalUnchanged = 0;
+  oneDimensionalContactMap->Comm().MinAll(&localUnchanged, &globalUnchanged, 1);
+
+  return (globalUnchanged == 1);
+}
+
 QUICKGRID::Data PeridigmNS::ContactManager::currentConfigurationDecomp() {
 
   // Create a decomp object and fill necessary data for rebalance
@@ -644,7 +737,7 @@ QUICKGRID::Data PeridigmNS::ContactManager::currentConfigurationDecomp() {
   return decomp;
 }
 
-Teuchos::RCP<Epetra_BlockMap> PeridigmNS::ContactManager::createRebalancedBondMap(Teuchos::RCP<Epetra_BlockMap> rebalancedOneDimensionalMap,
+Teuchos::RCP<Epetra_BlockMap> PeridigmNS::ContactManager::createRebalancedBondMap(Teuchos::RCP<const Epetra_BlockMap> rebalancedOneDimensionalMap,
                                                                                   Teuchos::RCP<const Epetra_Import> oneDimensionalMapToRebalancedOneDimensionalMapImporter) {
 
   const Epetra_Comm& comm = oneDimensionalContactMap->Comm();
@@ -691,6 +784,74 @@ Teuchos::RCP<Epetra_BlockMap> PeridigmNS::ContactManager::createRebalancedBondMa
   return rebalancedBondMap;
 }
 
+Teuchos::RCP<Epetra_Vector> PeridigmNS::ContactManager::createRebalancedContactCandidates(Teuchos::RCP<const Epetra_BlockMap> rebalancedOneDimensionalMap,
+                                                                                         Teuchos::RCP<const Epetra_BlockMap> rebalancedBondMap,
+                                                                                         Teuchos::RCP<const Epetra_Import> oneDimensionalMapToRebalancedOneDimensionalMapImporter)
+{
+  const Epetra_Comm& comm = oneDimensionalMap->Comm();
+
+  // gather the damage from the material blocks and move it to the rebalanced partitioning
+  // ghosted damage values are not computed by the material models, so summing over the overlap maps recovers the owned values
+  Epetra_Vector damage(*oneDimensionalMap);
+  PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
+  if(!materialBlocks.is_null() && fieldManager.hasField("Damage")){
+    int damageFieldId = fieldManager.getFieldId("Damage");
+    for(vector<PeridigmNS::Block>::iterator blockIt = materialBlocks->begin() ; blockIt != materialBlocks->end() ; blockIt++)
+      blockIt->exportData(damage, damageFieldId, PeridigmField::STEP_NP1, Add);
+  }
+  Epetra_Vector contactDamage(*oneDimensionalContactMap);
+  contactDamage.Import(damage, *oneDimensionalMothershipToContactMothershipImporter, Insert);
+  Teuchos::RCP<Epetra_Vector> rebalancedDamage;
+  Teuchos::RCP<Epetra_Vector> rebalancedBlockIDs;
+  if(oneDimensionalMapToRebalancedOneDimensionalMapImporter.is_null()){
+    // the partition is unchanged
+    rebalancedDamage = Teuchos::rcp(new Epetra_Vector(contactDamage));
+    rebalancedBlockIDs = Teuchos::rcp(new Epetra_Vector(*contactBlockIDs));
+  }
+  else{
+    rebalancedDamage = Teuchos::rcp(new Epetra_Vector(*rebalancedOneDimensionalMap));
+    rebalancedDamage->Import(contactDamage, *oneDimensionalMapToRebalancedOneDimensionalMapImporter, Insert);
+    rebalancedBlockIDs = Teuchos::rcp(new Epetra_Vector(*rebalancedOneDimensionalMap));
+    rebalancedBlockIDs->Import(*contactBlockIDs, *oneDimensionalMapToRebalancedOneDimensionalMapImporter, Insert);
+  }
+
+  // number of bonds for each point, and the maximum number of bonds within each contact block
+  int numMyElements = rebalancedOneDimensionalMap->NumMyElements();
+  vector<int> numberOfBonds(numMyElements, 0);
+  vector<int> blockIndex(numMyElements, -1);
+  int numContactBlocks = static_cast<int>(contactBlocks->size());
+  vector<int> localMaxNumberOfBonds(numContactBlocks, 0);
+  vector<int> globalMaxNumberOfBonds(numContactBlocks, 0);
+  for(int i=0 ; i<numMyElements ; ++i){
+    int bondMapLocalID = rebalancedBondMap->LID(rebalancedOneDimensionalMap->GID(i));
+    if(bondMapLocalID != -1)
+      numberOfBonds[i] = rebalancedBondMap->ElementSize(bondMapLocalID);
+    int blockID = static_cast<int>((*rebalancedBlockIDs)[i]);
+    for(int b=0 ; b<numContactBlocks ; ++b){
+      if((*contactBlocks)[b].getID() == blockID){
+        blockIndex[i] = b;
+        if(numberOfBonds[i] > localMaxNumberOfBonds[b])
+          localMaxNumberOfBonds[b] = numberOfBonds[i];
+        break;
+      }
+    }
+  }
+  if(numContactBlocks > 0)
+    comm.MaxAll(&localMaxNumberOfBonds[0], &globalMaxNumberOfBonds[0], numContactBlocks);
+
+  // a point is a contact candidate if it is on a free surface (it is missing bonds) or if it has been damaged
+  Teuchos::RCP<Epetra_Vector> rebalancedContactCandidates = Teuchos::rcp(new Epetra_Vector(*rebalancedOneDimensionalMap));
+  for(int i=0 ; i<numMyElements ; ++i){
+    bool isSurfacePoint = true;
+    if(blockIndex[i] != -1)
+      isSurfacePoint = numberOfBonds[i] < surfaceBondFraction*globalMaxNumberOfBonds[blockIndex[i]];
+    if(isSurfacePoint || (*rebalancedDamage)[i] > 0.0)
+      (*rebalancedContactCandidates)[i] = 1.0;
+  }
+
+  return rebalancedContactCandidates;
+}
+
 template<class T>
 struct NonDeleter{
 	void operator()(T* d) {}
@@ -701,24 +862,54 @@ void PeridigmNS::ContactManager::contactSearch(Teuchos::RCP<const Epetra_BlockMa
                                                Teuchos::RCP<const Epetra_Vector> rebalancedNeighborGlobalIDs,
                                                QUICKGRID::Data& rebalancedDecomp,
                                                Teuchos::RCP< map<int, vector<int> > > contactNeighborGlobalIDs,
-                                               Teuchos::RCP< set<int> > offProcessorContactIDs)
+                                               Teuchos::RCP< set<int> > offProcessorContactIDs,
+                                               Teuchos::RCP<const Epetra_Vector> rebalancedContactCandidates)
 {
   const Epetra_Comm& comm = oneDimensionalMap->Comm();
 
   std::tr1::shared_ptr<const Epetra_Comm> comm_shared_ptr(&comm,NonDeleter<const Epetra_Comm>());
   QUICKGRID::Data d = rebalancedDecomp;
 
+  // every locally-owned point has an entry in the contact neighbor list, even if it is not searched
+  for(size_t iPt=0 ; iPt<rebalancedDecomp.numPoints ; ++iPt)
+    (*contactNeighborGlobalIDs)[d.myGlobalIDs.get()[iPt]];
+
+  // if candidates are flagged, only the candidate points take part in the search
+  int numSearchPoints = d.numPoints;
+  std::tr1::shared_ptr<int> searchPointGlobalIDs = d.myGlobalIDs;
+  std::tr1::shared_ptr<double> searchPointX = d.myX;
+  Teuchos::RCP<const Epetra_BlockMap> searchMap = rebalancedOneDimensionalMap;
+  if(!rebalancedContactCandidates.is_null()){
+    vector<int> candidateGlobalIDs;
+    for(size_t iPt=0 ; iPt<rebalancedDecomp.numPoints ; ++iPt){
+      if((*rebalancedContactCandidates)[iPt] > 0.0)
+        candidateGlobalIDs.push_back(d.myGlobalIDs.get()[iPt]);
+    }
+    numSearchPoints = static_cast<int>(candidateGlobalIDs.size());
+    UTILITIES::Array<int> candidateGlobalIDsArray(numSearchPoints);
+    UTILITIES::Array<double> candidateXArray(3*numSearchPoints);
+    for(int i=0 ; i<numSearchPoints ; ++i){
+      int localID = rebalancedOneDimensionalMap->LID(candidateGlobalIDs[i]);
+      candidateGlobalIDsArray[i] = candidateGlobalIDs[i];
+      for(int dof=0 ; dof<3 ; ++dof)
+        candidateXArray[3*i+dof] = d.myX.get()[3*localID+dof];
+    }
+    searchPointGlobalIDs = candidateGlobalIDsArray.get_shared_ptr();
+    searchPointX = candidateXArray.get_shared_ptr();
+    searchMap = Teuchos::rcp(new Epetra_BlockMap(-1, numSearchPoints, numSearchPoints > 0 ? &candidateGlobalIDs[0] : 0, 1, 0, comm));
+  }
+
   // TEMPORARY PLACEHOLDER FOR PER-NODE SEARCH RADII
-  Teuchos::RCP<Epetra_Vector> contactSearchRadii = Teuchos::rcp(new Epetra_Vector(*rebalancedOneDimensionalMap));
-  contactSearchRadii->PutScalar(contactSearchRadius);
+  Teuchos::RCP<Epetra_Vector> contactSearchRadii = Teuchos::rcp(new Epetra_Vector(*searchMap));
+  contactSearchRadii->PutScalar(contactSearchRadius + contactSkinDistance);
 
-  PDNEIGH::NeighborhoodList neighList(comm_shared_ptr,d.zoltanPtr.get(),d.numPoints,d.myGlobalIDs,d.myX,contactSearchRadii);
+  PDNEIGH::NeighborhoodList neighList(comm_shared_ptr,d.zoltanPtr.get(),numSearchPoints,searchPointGlobalIDs,searchPointX,contactSearchRadii);
 
   int* searchNeighborhood = neighList.get_neighborhood().get();
 
   int* searchGlobalIDs = neighList.get_owned_gids().get();
   int searchListIndex = 0;
-  for(size_t iPt=0 ; iPt<rebalancedDecomp.numPoints ; ++iPt){
+  for(int iPt=0 ; iPt<numSearchPoints ; ++iPt){
 
     int globalID = searchGlobalIDs[iPt];
     vector<int>& contactNeighborGlobalIDList = (*contactNeighborGlobalIDs)[globalID];
@@ -751,7 +942,7 @@ void PeridigmNS::ContactManager::contactSearch(Teuchos::RCP<const Epetra_BlockMa
   }
 }
 
-Teuchos::RCP<Epetra_Vector> PeridigmNS::ContactManager::createRebalancedNeighborGlobalIDList(Teuchos::RCP<Epetra_BlockMap> rebalancedBondMap,
+Teuchos::RCP<Epetra_Vector> PeridigmNS::ContactManager::createRebalancedNeighborGlobalIDList(Teuchos::RCP<const Epetra_BlockMap> rebalancedBondMap,
                                                                                              Teuchos::RCP<const Epetra_Import> bondMapToRebalancedBondMapImporter) {
   // construct a globalID neighbor list in the static global decomposition
   Teuchos::RCP<Epetra_Vector> neighborGlobalIDs = Teuchos::rcp(new Epetra_Vector(*bondContactMap));
@@ -767,6 +958,10 @@ Teuchos::RCP<Epetra_Vector> PeridigmNS::ContactManager::createRebalancedNeighbor
     }
   }
 
+  // if the partition is unchanged there is no importer, and the list is already in the rebalanced configuration
+  if(bondMapToRebalancedBondMapImporter.is_null())
+    return neighborGlobalIDs;
+
   // redistribute the globalID neighbor list to the rebalanced configuration
   Teuchos::RCP<Epetra_Vector> rebalancedNeighborGlobalIDs = Teuchos::rcp(new Epetra_Vector(*rebalancedBondMap));
   rebalancedNeighborGlobalIDs->Import(*neighborGlobalIDs, *bondMapToRebalancedBondMapImporter, Insert);
@@ -774,9 +969,9 @@ Teuchos::RCP<Epetra_Vector> PeridigmNS::ContactManager::createRebalancedNeighbor
   return rebalancedNeighborGlobalIDs;
 }
 
-Teuchos::RCP<PeridigmNS::NeighborhoodData> PeridigmNS::ContactManager::createRebalancedNeighborhoodData(Teuchos::RCP<Epetra_BlockMap> rebalancedOneDimensionalMap,
-                                                                                                        Teuchos::RCP<Epetra_BlockMap> rebalancedOneDimensionalOverlapMap,
-                                                                                                        Teuchos::RCP<Epetra_BlockMap> rebalancedBondMap,
+Teuchos::RCP<PeridigmNS::NeighborhoodData> PeridigmNS::ContactManager::createRebalancedNeighborhoodData(Teuchos::RCP<const Epetra_BlockMap> rebalancedOneDimensionalMap,
+                                                                                                        Teuchos::RCP<const Epetra_BlockMap> rebalancedOneDimensionalOverlapMap,
+                                                                                                        Teuchos::RCP<const Epetra_BlockMap> rebalancedBondMap,
                                                                                                         Teuchos::RCP<Epetra_Vector> rebalancedNeighborGlobalIDs) {
 
   Teuchos::RCP<PeridigmNS::NeighborhoodData> rebalancedNeighborhoodData = Teuchos::rcp(new PeridigmNS::NeighborhoodData);
@@ -872,18 +1067,12 @@ void PeridigmNS::ContactManager::evaluateContactForce(double dt)
 {
   for(contactBlockIt = contactBlocks->begin() ; contactBlockIt != contactBlocks->end() ; contactBlockIt++){
 
-    Teuchos::RCP<PeridigmNS::NeighborhoodData> nData = contactBlockIt->getNeighborhoodData();
-    const int numOwnedPoints = nData->NumOwnedPoints();
-    const int* ownedIDs = nData->OwnedIDs();
-    const int* neighborhoodList = nData->NeighborhoodList();
     Teuchos::RCP<PeridigmNS::DataManager> dataManager = contactBlockIt->getDataManager();
     Teuchos::RCP<const PeridigmNS::ContactModel> contactModel = contactBlockIt->getContactModel();
 
     if(!contactModel.is_null())
-      contactModel->computeForce(dt, 
-                                 numOwnedPoints,
-                                 ownedIDs,
-                                 neighborhoodList,
+      contactModel->computeForce(dt,
+                                 contactBlockIt->getContactPairList(),
                                  *dataManager);
   }
 }
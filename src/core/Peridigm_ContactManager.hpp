@@ -56,6 +56,7 @@
 #include <Epetra_Vector.h>
 #include <Epetra_Import.h>
 #include "Peridigm_ContactBlock.hpp"
+#include "Peridigm_Block.hpp"
 #include "Peridigm_ContactModel.hpp"
 #include "QuickGridData.h"
 
@@ -116,8 +117,15 @@ namespace PeridigmNS {
 
     Teuchos::RCP< std::vector<PeridigmNS::ContactBlock> > getContactBlocks(){ return contactBlocks; };
 
+    //! Set the material blocks, used to gather damage when contact is restricted to surface points
+    void setMaterialBlocks(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks_){ materialBlocks = blocks_; }
+
     void rebalance(int step);
 
+    //! Reset the mothership maps, and the importers between the mothership and contact mothership vectors, after the material blocks are rebalanced
+    void setMothershipMaps(Teuchos::RCP<const Epetra_BlockMap> oneDimensionalMap_,
+                           Teuchos::RCP<const Epetra_BlockMap> threeDimensionalMap_);
+
     void evaluateContactForce(double dt);
 
     //! Destructor.
@@ -139,27 +147,36 @@ namespace PeridigmNS {
     //! Compute a parallel decomposion based on the current configuration
     QUICKGRID::Data currentConfigurationDecomp();
 
+    //! Determine whether a rebalanced decomposition leaves every point on the same processor, in the same order
+    bool ownedPartitionUnchanged(const QUICKGRID::Data& rebalancedDecomp) const;
+
     //! Create a rebalanced bond map
-    Teuchos::RCP<Epetra_BlockMap> createRebalancedBondMap(Teuchos::RCP<Epetra_BlockMap> rebalancedOneDimensionalMap,
+    Teuchos::RCP<Epetra_BlockMap> createRebalancedBondMap(Teuchos::RCP<const Epetra_BlockMap> rebalancedOneDimensionalMap,
                                                           Teuchos::RCP<const Epetra_Import> oneDimensionalMapToRebalancedOneDimensionalMapImporter);
 
     //! Create a global ID neighbor list in a rebalanced partitioning
-    Teuchos::RCP<Epetra_Vector> createRebalancedNeighborGlobalIDList(Teuchos::RCP<Epetra_BlockMap> rebalancedBondMap,
+    Teuchos::RCP<Epetra_Vector> createRebalancedNeighborGlobalIDList(Teuchos::RCP<const Epetra_BlockMap> rebalancedBondMap,
                                                                      Teuchos::RCP<const Epetra_Import> bondMapToRebalancedBondMapImporter);
 
     //! Create a rebalanced NeighborhoodData object
-    Teuchos::RCP<PeridigmNS::NeighborhoodData> createRebalancedNeighborhoodData(Teuchos::RCP<Epetra_BlockMap> rebalancedOneDimensionalMap,
-                                                                                Teuchos::RCP<Epetra_BlockMap> rebalancedOneDimensionalOverlapMap,
-                                                                                Teuchos::RCP<Epetra_BlockMap> rebalancedBondMap,
+    Teuchos::RCP<PeridigmNS::NeighborhoodData> createRebalancedNeighborhoodData(Teuchos::RCP<const Epetra_BlockMap> rebalancedOneDimensionalMap,
+                                                                                Teuchos::RCP<const Epetra_BlockMap> rebalancedOneDimensionalOverlapMap,
+                                                                                Teuchos::RCP<const Epetra_BlockMap> rebalancedBondMap,
                                                                                 Teuchos::RCP<Epetra_Vector> rebalancedNeighborGlobalIDs);
 
+    //! Flag the points that may come into contact (1.0) in a rebalanced partitioning: surface points and damaged points
+    Teuchos::RCP<Epetra_Vector> createRebalancedContactCandidates(Teuchos::RCP<const Epetra_BlockMap> rebalancedOneDimensionalMap,
+                                                                  Teuchos::RCP<const Epetra_BlockMap> rebalancedBondMap,
+                                                                  Teuchos::RCP<const Epetra_Import> oneDimensionalMapToRebalancedOneDimensionalMapImporter);
+
     //! Fill the contact neighbor information in rebalancedDecomp and populate contactNeighborsGlobalIDs and offProcesorContactIDs
     void contactSearch(Teuchos::RCP<const Epetra_BlockMap> rebalancedOneDimensionalMap,
                        Teuchos::RCP<const Epetra_BlockMap> rebalancedBondMap,
                        Teuchos::RCP<const Epetra_Vector> rebalancedNeighborGlobalIDs,
                        QUICKGRID::Data& rebalancedDecomp,
                        Teuchos::RCP< std::map<int, std::vector<int> > > contactNeighborGlobalIDs,
-                       Teuchos::RCP< std::set<int> > offProcessorContactIDs);
+                       Teuchos::RCP< std::set<int> > offProcessorContactIDs,
+                       Teuchos::RCP<const Epetra_Vector> rebalancedContactCandidates = Teuchos::null);
 
     //! Create a rebalanced NeighborhoodData object for contact
     Teuchos::RCP<PeridigmNS::NeighborhoodData> createRebalancedContactNeighborhoodData(Teuchos::RCP<std::map<int, std::vector<int> > > contactNeighborGlobalIDs,
@@ -198,6 +215,21 @@ namespace PeridigmNS {
     //! Contact search radius
     double contactSearchRadius;
 
+    //! Skin distance added to the contact search radius; a new search is performed only when 2*(max displacement) exceeds it
+    double contactSkinDistance;
+
+    //! Current positions at the time of the last contact search (used only with a skin distance)
+    Teuchos::RCP<Epetra_Vector> contactYAtLastSearch;
+
+    //! Flag for restricting the contact search to surface points and damaged points
+    bool surfacePointsOnly;
+
+    //! Points with fewer bonds than this fraction of the block's maximum bond count are treated as surface points
+    double surfaceBondFraction;
+
+    //! Material blocks, used to gather damage when contact is restricted to surface points
+    Teuchos::RCP< std::vector<PeridigmNS::Block> > materialBlocks;
+
     //! Contact models
     std::map< std::string, Teuchos::RCP<const PeridigmNS::ContactModel> > contactModels;
 
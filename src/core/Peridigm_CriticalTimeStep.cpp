@@ -52,7 +52,11 @@
 
 using namespace std;
 
-double PeridigmNS::ComputeCriticalTimeStep(const Epetra_Comm& comm, PeridigmNS::Block& block){
+namespace {
+
+//! Computes the bond-sum stiffness estimate, sum_j c V_j / |xi_j|, for each owned point in the block.
+//! If useCurrentConfiguration is true, the current bond lengths are used and broken bonds are excluded.
+void computeBondSumStiffness(PeridigmNS::Block& block, std::vector<double>& stiffness, bool useCurrentConfiguration = false){
 
   Teuchos::RCP<PeridigmNS::NeighborhoodData> neighborhoodData = block.getNeighborhoodData();
   const int numOwnedPoints = neighborhoodData->NumOwnedPoints();
@@ -60,7 +64,6 @@ double PeridigmNS::ComputeCriticalTimeStep(const Epetra_Comm& comm, PeridigmNS::
   const int* neighborhoodList = neighborhoodData->NeighborhoodList();
   Teuchos::RCP<const PeridigmNS::Material> materialModel = block.getMaterialModel();
 
-  double density = materialModel()->Density();
   double bulkModulus = materialModel()->BulkModulus();
 
   double horizon(0.0);
@@ -70,25 +73,36 @@ double PeridigmNS::ComputeCriticalTimeStep(const Epetra_Comm& comm, PeridigmNS::
   if(blockHasConstantHorizon)
     horizon = horizonManager.getBlockConstantHorizonValue(blockName);
 
-  double *cellVolume, *x;
+  double *cellVolume, *x, *y, *bondDamage(0);
   PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
-  block.getData(fieldManager.getFieldId("Volume"), PeridigmField::STEP_NONE)->ExtractView(&cellVolume);
-  block.getData(fieldManager.getFieldId("Model_Coordinates"), PeridigmField::STEP_NONE)->ExtractView(&x);
+  block.getData(fieldManager.getFieldId("Volume"), PeridigmNS::PeridigmField::STEP_NONE)->ExtractView(&cellVolume);
+  block.getData(fieldManager.getFieldId("Model_Coordinates"), PeridigmNS::PeridigmField::STEP_NONE)->ExtractView(&x);
+  y = x;
+  if(useCurrentConfiguration){
+    block.getData(fieldManager.getFieldId("Coordinates"), PeridigmNS::PeridigmField::STEP_NP1)->ExtractView(&y);
+    if(fieldManager.hasField("Bond_Damage")){
+      int bondDamageFieldId = fieldManager.getFieldId("Bond_Damage");
+      if(block.hasData(bondDamageFieldId, PeridigmNS::PeridigmField::STEP_NP1))
+        block.getData(bondDamageFieldId, PeridigmNS::PeridigmField::STEP_NP1)->ExtractView(&bondDamage);
+    }
+  }
 
   const double pi = boost::math::constants::pi<double>();
   double springConstant(0.0);
   if(blockHasConstantHorizon)
     springConstant = 18.0*bulkModulus/(pi*horizon*horizon*horizon*horizon);
 
-  double minCriticalTimeStep = 1.0e50;
+  stiffness.assign(numOwnedPoints, 0.0);
 
   int neighborhoodListIndex = 0;
+  int bondIndex = 0;
   for(int iID=0 ; iID<numOwnedPoints ; ++iID){
 
-    double timestepDenominator = 0.0;
+    double bondSum = 0.0;
     int nodeID = ownedIDs[iID];
     double X[3] = { x[nodeID*3], x[nodeID*3+1], x[nodeID*3+2] };
-	int numNeighbors = neighborhoodList[neighborhoodListIndex++];
+    double Y[3] = { y[nodeID*3], y[nodeID*3+1], y[nodeID*3+2] };
+    int numNeighbors = neighborhoodList[neighborhoodListIndex++];
 
     if(!blockHasConstantHorizon){
       double delta = horizonManager.evaluateHorizon(blockName, X[0], X[1], X[2]);
@@ -98,31 +112,90 @@ double PeridigmNS::ComputeCriticalTimeStep(const Epetra_Comm& comm, PeridigmNS::
     for(int iNID=0 ; iNID<numNeighbors ; ++iNID){
       int neighborID = neighborhoodList[neighborhoodListIndex++];
       double neighborVolume = cellVolume[neighborID];
-      double initialDistance = sqrt( (X[0] - x[neighborID*3  ])*(X[0] - x[neighborID*3  ]) +
-                                     (X[1] - x[neighborID*3+1])*(X[1] - x[neighborID*3+1]) +
-                                     (X[2] - x[neighborID*3+2])*(X[2] - x[neighborID*3+2]) );
+      double bondLength = sqrt( (Y[0] - y[neighborID*3  ])*(Y[0] - y[neighborID*3  ]) +
+                                (Y[1] - y[neighborID*3+1])*(Y[1] - y[neighborID*3+1]) +
+                                (Y[2] - y[neighborID*3+2])*(Y[2] - y[neighborID*3+2]) );
+      double bondIntact = 1.0;
+      if(bondDamage != 0)
+        bondIntact = 1.0 - bondDamage[bondIndex];
+      bondIndex++;
 
       // Issue a warning if the bond length is very very small (as in zero)
       static bool warningGiven = false;
-      if(!warningGiven && initialDistance < 1.0e-50){
-        cout << "\nWarning:  Possible zero length bond detected (length = " << initialDistance << ")." << endl;
+      if(!warningGiven && bondLength < 1.0e-50){
+        cout << "\nWarning:  Possible zero length bond detected (length = " << bondLength << ")." << endl;
         cout << "            Bonds of length zero are not valid, the input mesh may contain coincident nodes.\n" << endl;
         warningGiven = true;
       }
 
-      timestepDenominator += neighborVolume*springConstant/initialDistance;
+      if(bondIntact > 0.0)
+        bondSum += bondIntact*neighborVolume*springConstant/bondLength;
     }
 
+    stiffness[iID] = bondSum;
+  }
+}
+
+//! Computes the critical time step over the owned points of the block on this processor.
+double computeLocalCriticalTimeStep(PeridigmNS::Block& block, bool useCurrentConfiguration){
+
+  double density = block.getMaterialModel()->Density();
+
+  std::vector<double> stiffness;
+  computeBondSumStiffness(block, stiffness, useCurrentConfiguration);
+
+  double minCriticalTimeStep = 1.0e50;
+  for(unsigned int iID=0 ; iID<stiffness.size() ; ++iID){
     double criticalTimeStep = 1.0e50;
-    if(numNeighbors > 0)
-      criticalTimeStep = sqrt(2.0*density/timestepDenominator);
+    if(stiffness[iID] > 0.0)
+      criticalTimeStep = sqrt(2.0*density/stiffness[iID]);
     if(criticalTimeStep < minCriticalTimeStep)
       minCriticalTimeStep = criticalTimeStep;
   }
 
+  return minCriticalTimeStep;
+}
+
+}
+
+double PeridigmNS::ComputeCriticalTimeStep(const Epetra_Comm& comm, PeridigmNS::Block& block){
+
+  double minCriticalTimeStep = computeLocalCriticalTimeStep(block, false);
+
   // Find the minimum time step for this block across all processors
   double globalMinCriticalTimeStep;
   comm.MinAll(&minCriticalTimeStep, &globalMinCriticalTimeStep, 1);
 
   return globalMinCriticalTimeStep;
 }
+
+void PeridigmNS::ComputeBondSumStiffness(PeridigmNS::Block& block, Epetra_Vector& stiffness){
+
+  std::vector<double> blockStiffness;
+  computeBondSumStiffness(block, blockStiffness);
+
+  Teuchos::RCP<PeridigmNS::NeighborhoodData> neighborhoodData = block.getNeighborhoodData();
+  const int* ownedIDs = neighborhoodData->OwnedIDs();
+  Teuchos::RCP<const Epetra_BlockMap> overlapMap = block.getOverlapScalarPointMap();
+  for(unsigned int iID=0 ; iID<blockStiffness.size() ; ++iID){
+    int localID = stiffness.Map().LID( overlapMap->GID(ownedIDs[iID]) );
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(localID == -1, "**** Error in ComputeBondSumStiffness(), point not found in target map.\n");
+    stiffness[localID] = blockStiffness[iID];
+  }
+}
+
+double PeridigmNS::ComputeCurrentCriticalTimeStep(const Epetra_Comm& comm, std::vector<PeridigmNS::Block>& blocks){
+
+  double minCriticalTimeStep = 1.0e50;
+  for(std::vector<PeridigmNS::Block>::iterator blockIt = blocks.begin() ; blockIt != blocks.end() ; blockIt++){
+    double blockCriticalTimeStep = computeLocalCriticalTimeStep(*blockIt, true);
+    if(blockCriticalTimeStep < minCriticalTimeStep)
+      minCriticalTimeStep = blockCriticalTimeStep;
+  }
+
+  // A single reduction over all blocks
+  double globalMinCriticalTimeStep;
+  comm.MinAll(&minCriticalTimeStep, &globalMinCriticalTimeStep, 1);
+
+  return globalMinCriticalTimeStep;
+}
@@ -50,11 +50,18 @@
 
 #include "Peridigm_Block.hpp"
 #include <Epetra_Comm.h>
+#include <Epetra_Vector.h>
 
 namespace PeridigmNS {
 
 double ComputeCriticalTimeStep(const Epetra_Comm& comm, PeridigmNS::Block& block);
 
+//! Computes the critical time step over all blocks from the current configuration, excluding broken bonds.
+double ComputeCurrentCriticalTimeStep(const Epetra_Comm& comm, std::vector<PeridigmNS::Block>& blocks);
+
+//! Fills the given non-overlap scalar vector with the bond-sum stiffness estimate used by ComputeCriticalTimeStep() for each point in the block.
+void ComputeBondSumStiffness(PeridigmNS::Block& block, Epetra_Vector& stiffness);
+
 }
 
 #endif // PERIDIGM_CRITICALTIMESTEP_HPP
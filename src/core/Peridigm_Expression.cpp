@@ -0,0 +1,667 @@
+/*! \file Peridigm_Expression.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+
+#include "Peridigm_Expression.hpp"
+#include <Teuchos_Assert.hpp>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+
+using namespace std;
+
+namespace {
+
+//! Number of points evaluated together in a batch; bounds the scratch memory and keeps it in cache.
+const int chunkSize = 256;
+
+//! Stack depth covered by the fixed-size scratch stack of the scalar evaluation.
+const int localStackDepth = 32;
+
+}
+
+struct PeridigmNS::Expression::Node {
+  bool isConstant;
+  bool isVariable;
+  double value;
+  int variableIndex;
+  OpCode op;
+  Teuchos::RCP<Node> a;
+  Teuchos::RCP<Node> b;
+  Node() : isConstant(false), isVariable(false), value(0.0), variableIndex(-1), op(PUSH_CONSTANT) {}
+};
+
+PeridigmNS::Expression::Expression(const string& expression, const vector<string>& variableNames, const string& name)
+  : m_isCompiled(false), m_variableNames(variableNames), m_dependsOn(variableNames.size(), false), m_maxStackDepth(0), m_position(0)
+{
+  m_isCompiled = compile(expression);
+  m_tokens.clear();
+  if(!m_isCompiled){
+    m_program.clear();
+    setUpRuntimeCompiler(expression, name);
+  }
+}
+
+bool PeridigmNS::Expression::isConstant() const {
+  for(unsigned int i=0 ; i<m_dependsOn.size() ; ++i){
+    if(m_dependsOn[i])
+      return false;
+  }
+  return true;
+}
+
+void PeridigmNS::Expression::setUpRuntimeCompiler(const string& expression, const string& name){
+
+  m_rtcFunction = Teuchos::rcp<PG_RuntimeCompiler::Function>(new PG_RuntimeCompiler::Function(m_variableNames.size() + 1, name));
+  for(unsigned int i=0 ; i<m_variableNames.size() ; ++i)
+    m_rtcFunction->addVar("double", m_variableNames[i]);
+  m_rtcFunction->addVar("double", "value");
+
+  string rtcFunctionString = expression;
+  if(rtcFunctionString.find("value") == string::npos)
+    rtcFunctionString = "value = " + rtcFunctionString;
+  bool success = m_rtcFunction->addBody(rtcFunctionString);
+  if(!success){
+    string msg = "\n**** Error:  rtcFunction->addBody(" + expression + ") returned error code in PeridigmNS::Expression::Expression().\n";
+    msg += "**** " + m_rtcFunction->getErrors() + "\n";
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(!success, msg);
+  }
+
+  // the run-time compiler does not report which variables are used, so scan the
+  // expression for standalone identifiers that match the variable names
+  const size_t n = expression.size();
+  size_t i = 0;
+  while(i < n){
+    const char c = expression[i];
+    if(isalpha(c) || c == '_'){
+      size_t j = i;
+      while(j < n && (isalnum(expression[j]) || expression[j] == '_'))
+        j++;
+      const string identifier = expression.substr(i, j-i);
+      for(unsigned int v=0 ; v<m_variableNames.size() ; ++v){
+        if(identifier == m_variableNames[v])
+          m_dependsOn[v] = true;
+      }
+      i = j;
+    }
+    else if(isdigit(c) || c == '.'){
+      // skip numeric literals, including exponents such as 1.0e-3
+      while(i < n && (isalnum(expression[i]) || expression[i] == '.'))
+        i++;
+    }
+    else
+      i++;
+  }
+}
+
+bool PeridigmNS::Expression::tokenize(const string& expression){
+
+  m_tokens.clear();
+  const size_t n = expression.size();
+  size_t i = 0;
+  while(i < n){
+    const char c = expression[i];
+    Token token;
+    token.value = 0.0;
+    if(isspace(c)){
+      i++;
+      continue;
+    }
+    else if(isdigit(c) || (c == '.' && i+1 < n && isdigit(expression[i+1]))){
+      const char* begin = expression.c_str() + i;
+      char* end;
+      token.type = NUMBER;
+      token.value = strtod(begin, &end);
+      token.text = expression.substr(i, end - begin);
+      i += end - begin;
+    }
+    else if(isalpha(c) || c == '_'){
+      size_t j = i;
+      while(j < n && (isalnum(expression[j]) || expression[j] == '_'))
+        j++;
+      token.type = IDENTIFIER;
+      token.text = expression.substr(i, j-i);
+      i = j;
+    }
+    else{
+      token.type = OPERATOR;
+      const string twoCharacters = expression.substr(i, 2);
+      if(twoCharacters == "<=" || twoCharacters == ">=" || twoCharacters == "==" ||
+         twoCharacters == "!=" || twoCharacters == "&&" || twoCharacters == "||"){
+        token.text = twoCharacters;
+        i += 2;
+      }
+      else if(string("+-*/^<>!(),=;").find(c) != string::npos){
+        token.text = string(1, c);
+        i += 1;
+      }
+      else
+        return false;
+    }
+    m_tokens.push_back(token);
+  }
+  Token end;
+  end.type = END;
+  end.value = 0.0;
+  m_tokens.push_back(end);
+  return true;
+}
+
+bool PeridigmNS::Expression::compile(const string& expression){
+
+  if(!tokenize(expression))
+    return false;
+
+  // accept an optional "value =" prefix and a single trailing semicolon
+  m_position = 0;
+  if(m_tokens.size() > 2 && m_tokens[0].type == IDENTIFIER && m_tokens[0].text == "value" &&
+     m_tokens[1].type == OPERATOR && m_tokens[1].text == "=")
+    m_position = 2;
+  if(m_tokens.size() > 1 && m_tokens[m_tokens.size()-2].type == OPERATOR && m_tokens[m_tokens.size()-2].text == ";")
+    m_tokens.erase(m_tokens.end()-2);
+
+  Teuchos::RCP<Node> root = parseOr();
+  if(root.is_null() || m_tokens[m_position].type != END)
+    return false;
+
+  m_program.clear();
+  m_maxStackDepth = 0;
+  emit(root, 0);
+  return true;
+}
+
+Teuchos::RCP<PeridigmNS::Expression::Node> PeridigmNS::Expression::parseOr(){
+  Teuchos::RCP<Node> node = parseAnd();
+  while(!node.is_null() && m_tokens[m_position].type == OPERATOR && m_tokens[m_position].text == "||"){
+    m_position++;
+    Teuchos::RCP<Node> rhs = parseAnd();
+    if(rhs.is_null())
+      return Teuchos::null;
+    node = makeNode(OR, node, rhs);
+  }
+  return node;
+}
+
+Teuchos::RCP<PeridigmNS::Expression::Node> PeridigmNS::Expression::parseAnd(){
+  Teuchos::RCP<Node> node = parseEquality();
+  while(!node.is_null() && m_tokens[m_position].type == OPERATOR && m_tokens[m_position].text == "&&"){
+    m_position++;
+    Teuchos::RCP<Node> rhs = parseEquality();
+    if(rhs.is_null())
+      return Teuchos::null;
+    node = makeNode(AND, node, rhs);
+  }
+  return node;
+}
+
+Teuchos::RCP<PeridigmNS::Expression::Node> PeridigmNS::Expression::parseEquality(){
+  Teuchos::RCP<Node> node = parseRelational();
+  while(!node.is_null() && m_tokens[m_position].type == OPERATOR &&
+        (m_tokens[m_position].text == "==" || m_tokens[m_position].text == "!=")){
+    OpCode op = m_tokens[m_position].text == "==" ? EQUAL : NOT_EQUAL;
+    m_position++;
+    Teuchos::RCP<Node> rhs = parseRelational();
+    if(rhs.is_null())
+      return Teuchos::null;
+    node = makeNode(op, node, rhs);
+  }
+  return node;
+}
+
+Teuchos::RCP<PeridigmNS::Expression::Node> PeridigmNS::Expression::parseRelational(){
+  Teuchos::RCP<Node> node = parseAdditive();
+  while(!node.is_null() && m_tokens[m_position].type == OPERATOR){
+    const string& text = m_tokens[m_position].text;
+    OpCode op;
+    if(text == "<") op = LESS;
+    else if(text == ">") op = GREATER;
+    else if(text == "<=") op = LESS_EQUAL;
+    else if(text == ">=") op = GREATER_EQUAL;
+    else break;
+    m_position++;
+    Teuchos::RCP<Node> rhs = parseAdditive();
+    if(rhs.is_null())
+      return Teuchos::null;
+    node = makeNode(op, node, rhs);
+  }
+  return node;
+}
+
+Teuchos::RCP<PeridigmNS::Expression::Node> PeridigmNS::Expression::parseAdditive(){
+  Teuchos::RCP<Node> node = parseMultiplicative();
+  while(!node.is_null() && m_tokens[m_position].type == OPERATOR &&
+        (m_tokens[m_position].text == "+" || m_tokens[m_position].text == "-")){
+    OpCode op = m_tokens[m_position].text == "+" ? ADD : SUBTRACT;
+    m_position++;
+    Teuchos::RCP<Node> rhs = parseMultiplicative();
+    if(rhs.is_null())
+      return Teuchos::null;
+    node = makeNode(op, node, rhs);
+  }
+  return node;
+}
+
+Teuchos::RCP<PeridigmNS::Expression::Node> PeridigmNS::Expression::parseMultiplicative(){
+  Teuchos::RCP<Node> node = parseUnary();
+  while(!node.is_null() && m_tokens[m_position].type == OPERATOR &&
+        (m_tokens[m_position].text == "*" || m_tokens[m_position].text == "/")){
+    OpCode op = m_tokens[m_position].text == "*" ? MULTIPLY : DIVIDE;
+    m_position++;
+    Teuchos::RCP<Node> rhs = parseUnary();
+    if(rhs.is_null())
+      return Teuchos::null;
+    node = makeNode(op, node, rhs);
+  }
+  return node;
+}
+
+Teuchos::RCP<PeridigmNS::Expression::Node> PeridigmNS::Expression::parseUnary(){
+  if(m_tokens[m_position].type == OPERATOR){
+    const string& text = m_tokens[m_position].text;
+    if(text == "-" || text == "+" || text == "!"){
+      m_position++;
+      Teuchos::RCP<Node> operand = parseUnary();
+      if(operand.is_null() || text == "+")
+        return operand;
+      return makeNode(text == "-" ? NEGATE : NOT, operand);
+    }
+  }
+  return parsePower();
+}
+
+Teuchos::RCP<PeridigmNS::Expression::Node> PeridigmNS::Expression::parsePower(){
+  // exponentiation binds tighter than unary minus and is right associative, so -a^b^c = -(a^(b^c))
+  Teuchos::RCP<Node> node = parsePrimary();
+  if(!node.is_null() && m_tokens[m_position].type == OPERATOR && m_tokens[m_position].text == "^"){
+    m_position++;
+    Teuchos::RCP<Node> exponent = parseUnary();
+    if(exponent.is_null())
+      return Teuchos::null;
+    node = makeNode(POWER, node, exponent);
+  }
+  return node;
+}
+
+Teuchos::RCP<PeridigmNS::Expression::Node> PeridigmNS::Expression::parsePrimary(){
+
+  const Token token = m_tokens[m_position];
+
+  if(token.type == NUMBER){
+    m_position++;
+    Teuchos::RCP<Node> node = Teuchos::rcp(new Node);
+    node->isConstant = true;
+    node->value = token.value;
+    return node;
+  }
+
+  if(token.type == OPERATOR && token.text == "("){
+    m_position++;
+    Teuchos::RCP<Node> node = parseOr();
+    if(node.is_null() || m_tokens[m_position].type != OPERATOR || m_tokens[m_position].text != ")")
+      return Teuchos::null;
+    m_position++;
+    return node;
+  }
+
+  if(token.type != IDENTIFIER)
+    return Teuchos::null;
+  m_position++;
+
+  // function call
+  if(m_tokens[m_position].type == OPERATOR && m_tokens[m_position].text == "("){
+    OpCode op;
+    const string& f = token.text;
+    if(f == "sin") op = SIN;
+    else if(f == "cos") op = COS;
+    else if(f == "tan") op = TAN;
+    else if(f == "asin") op = ASIN;
+    else if(f == "acos") op = ACOS;
+    else if(f == "atan") op = ATAN;
+    else if(f == "sinh") op = SINH;
+    else if(f == "cosh") op = COSH;
+    else if(f == "tanh") op = TANH;
+    else if(f == "sqrt") op = SQRT;
+    else if(f == "exp") op = EXP;
+    else if(f == "log") op = LOG;
+    else if(f == "log10") op = LOG10;
+    else if(f == "fabs" || f == "abs") op = FABS;
+    else if(f == "floor") op = FLOOR;
+    else if(f == "ceil") op = CEIL;
+    else if(f == "atan2") op = ATAN2;
+    else if(f == "pow") op = POW;
+    else if(f == "fmod") op = FMOD;
+    else return Teuchos::null;
+
+    m_position++;
+    vector< Teuchos::RCP<Node> > arguments;
+    while(true){
+      Teuchos::RCP<Node> argument = parseOr();
+      if(argument.is_null())
+        return Teuchos::null;
+      arguments.push_back(argument);
+      if(m_tokens[m_position].type == OPERATOR && m_tokens[m_position].text == ","){
+        m_position++;
+        continue;
+      }
+      if(m_tokens[m_position].type == OPERATOR && m_tokens[m_position].text == ")"){
+        m_position++;
+        break;
+      }
+      return Teuchos::null;
+    }
+    if(static_cast<int>(arguments.size()) != numArguments(op))
+      return Teuchos::null;
+    return arguments.size() == 1 ? makeNode(op, arguments[0]) : makeNode(op, arguments[0], arguments[1]);
+  }
+
+  // variable
+  for(unsigned int v=0 ; v<m_variableNames.size() ; ++v){
+    if(token.text == m_variableNames[v]){
+      Teuchos::RCP<Node> node = Teuchos::rcp(new Node);
+      node->isVariable = true;
+      node->variableIndex = v;
+      return node;
+    }
+  }
+
+  return Teuchos::null;
+}
+
+Teuchos::RCP<PeridigmNS::Expression::Node> PeridigmNS::Expression::makeNode(OpCode op, Teuchos::RCP<Node> a, Teuchos::RCP<Node> b){
+  Teuchos::RCP<Node> node = Teuchos::rcp(new Node);
+  if(a->isConstant && (b.is_null() || b->isConstant)){
+    node->isConstant = true;
+    node->value = b.is_null() ? apply(op, a->value) : apply(op, a->value, b->value);
+  }
+  else{
+    node->op = op;
+    node->a = a;
+    node->b = b;
+  }
+  return node;
+}
+
+void PeridigmNS::Expression::emit(const Teuchos::RCP<Node>& node, int depth){
+  Instruction instruction;
+  instruction.variableIndex = -1;
+  instruction.value = 0.0;
+  if(node->isConstant || node->isVariable){
+    if(node->isConstant){
+      instruction.op = PUSH_CONSTANT;
+      instruction.value = node->value;
+    }
+    else{
+      instruction.op = PUSH_VARIABLE;
+      instruction.variableIndex = node->variableIndex;
+      m_dependsOn[node->variableIndex] = true;
+    }
+    if(depth + 1 > m_maxStackDepth)
+      m_maxStackDepth = depth + 1;
+  }
+  else{
+    emit(node->a, depth);
+    if(!node->b.is_null())
+      emit(node->b, depth + 1);
+    instruction.op = node->op;
+  }
+  m_program.push_back(instruction);
+}
+
+int PeridigmNS::Expression::numArguments(OpCode op){
+  if(op == PUSH_CONSTANT || op == PUSH_VARIABLE)
+    return 0;
+  if(op < ADD)
+    return 1;
+  return 2;
+}
+
+double PeridigmNS::Expression::apply(OpCode op, double a){
+  switch(op){
+  case NEGATE: return -a;
+  case NOT:    return a == 0.0 ? 1.0 : 0.0;
+  case SIN:    return std::sin(a);
+  case COS:    return std::cos(a);
+  case TAN:    return std::tan(a);
+  case ASIN:   return std::asin(a);
+  case ACOS:   return std::acos(a);
+  case ATAN:   return std::atan(a);
+  case SINH:   return std::sinh(a);
+  case COSH:   return std::cosh(a);
+  case TANH:   return std::tanh(a);
+  case SQRT:   return std::sqrt(a);
+  case EXP:    return std::exp(a);
+  case LOG:    return std::log(a);
+  case LOG10:  return std::log10(a);
+  case FABS:   return std::fabs(a);
+  case FLOOR:  return std::floor(a);
+  case CEIL:   return std::ceil(a);
+  default:
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(true, "**** Error in Expression::apply(), invalid unary operation.\n");
+  }
+  return 0.0;
+}
+
+double PeridigmNS::Expression::apply(OpCode op, double a, double b){
+  switch(op){
+  case ADD:           return a + b;
+  case SUBTRACT:      return a - b;
+  case MULTIPLY:      return a * b;
+  case DIVIDE:        return a / b;
+  case POWER:         return std::pow(a, b);
+  case POW:           return std::pow(a, b);
+  case LESS:          return a < b ? 1.0 : 0.0;
+  case GREATER:       return a > b ? 1.0 : 0.0;
+  case LESS_EQUAL:    return a <= b ? 1.0 : 0.0;
+  case GREATER_EQUAL: return a >= b ? 1.0 : 0.0;
+  case EQUAL:         return a == b ? 1.0 : 0.0;
+  case NOT_EQUAL:     return a != b ? 1.0 : 0.0;
+  case AND:           return (a != 0.0 && b != 0.0) ? 1.0 : 0.0;
+  case OR:            return (a != 0.0 || b != 0.0) ? 1.0 : 0.0;
+  case ATAN2:         return std::atan2(a, b);
+  case FMOD:          return std::fmod(a, b);
+  default:
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(true, "**** Error in Expression::apply(), invalid binary operation.\n");
+  }
+  return 0.0;
+}
+
+double PeridigmNS::Expression::evaluate(const double* variableValues) const {
+
+  if(!m_isCompiled){
+    // The run-time compiler holds the variable values and the result, so calls are serialized
+    // (the error is raised outside the critical section, which must not be left by an exception)
+    double value(0.0);
+    bool success = true;
+    string errors;
+#ifdef PERIDIGM_OPENMP
+    #pragma omp critical(PeridigmExpressionRuntimeCompiler)
+#endif
+    {
+      for(unsigned int v=0 ; v<m_variableNames.size() && success ; ++v)
+        success = m_rtcFunction->varValueFill(v, variableValues[v]);
+      if(success)
+        success = m_rtcFunction->varValueFill(m_variableNames.size(), 0.0);
+      if(success)
+        success = m_rtcFunction->execute();
+      if(success)
+        value = m_rtcFunction->getValueOfVar("value");
+      else
+        errors = m_rtcFunction->getErrors();
+    }
+    if(!success){
+      string msg = "\n**** Error in Expression::evaluate().\n";
+      msg += "**** " + errors + "\n";
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(!success, msg);
+    }
+    return value;
+  }
+
+  // Scratch space is local to the call so that concurrent evaluations do not interfere
+  double localStack[localStackDepth];
+  vector<double> heapStack;
+  double* stack = localStack;
+  if(m_maxStackDepth > localStackDepth){
+    heapStack.resize(m_maxStackDepth);
+    stack = &heapStack[0];
+  }
+  int top = -1;
+  for(vector<Instruction>::const_iterator it = m_program.begin() ; it != m_program.end() ; ++it){
+    switch(it->op){
+    case PUSH_CONSTANT:
+      stack[++top] = it->value;
+      break;
+    case PUSH_VARIABLE:
+      stack[++top] = variableValues[it->variableIndex];
+      break;
+    default:
+      if(numArguments(it->op) == 1)
+        stack[top] = apply(it->op, stack[top]);
+      else{
+        stack[top-1] = apply(it->op, stack[top-1], stack[top]);
+        top--;
+      }
+    }
+  }
+  return stack[0];
+}
+
+void PeridigmNS::Expression::evaluate(int numPoints, const double* const* variables, const int* strides, double* result) const {
+
+  if(!m_isCompiled){
+    vector<double> variableValues(m_variableNames.size());
+    for(int i=0 ; i<numPoints ; ++i){
+      for(unsigned int v=0 ; v<m_variableNames.size() ; ++v)
+        variableValues[v] = variables[v][i*strides[v]];
+      result[i] = evaluate(variableValues.empty() ? 0 : &variableValues[0]);
+    }
+    return;
+  }
+
+  // Each stack entry is either a scalar (stride zero) or a chunk of values.  Operations on
+  // scalar entries are performed once, so subexpressions that depend only on uniform inputs
+  // are effectively constant-folded for the call.
+  // The scratch stack is local to the call so that concurrent evaluations do not interfere.
+  vector<double> chunkStack(m_maxStackDepth*chunkSize);
+  vector<const double*> stackPointers(m_maxStackDepth);
+  vector<int> stackStrides(m_maxStackDepth);
+  vector<double> stackScalars(m_maxStackDepth);
+  for(int start=0 ; start<numPoints ; start+=chunkSize){
+    const int n = (numPoints - start < chunkSize) ? numPoints - start : chunkSize;
+    int top = -1;
+    for(vector<Instruction>::const_iterator it = m_program.begin() ; it != m_program.end() ; ++it){
+      const OpCode op = it->op;
+      if(op == PUSH_CONSTANT){
+        ++top;
+        stackScalars[top] = it->value;
+        stackPointers[top] = &stackScalars[top];
+        stackStrides[top] = 0;
+      }
+      else if(op == PUSH_VARIABLE){
+        ++top;
+        const int v = it->variableIndex;
+        if(strides[v] == 0){
+          stackScalars[top] = variables[v][0];
+          stackPointers[top] = &stackScalars[top];
+        }
+        else
+          stackPointers[top] = variables[v] + start*strides[v];
+        stackStrides[top] = strides[v];
+      }
+      else if(numArguments(op) == 1){
+        const double* a = stackPointers[top];
+        const int sa = stackStrides[top];
+        if(sa == 0){
+          stackScalars[top] = apply(op, *a);
+          stackPointers[top] = &stackScalars[top];
+        }
+        else{
+          double* out = &chunkStack[top*chunkSize];
+          for(int i=0 ; i<n ; ++i)
+            out[i] = apply(op, a[i*sa]);
+          stackPointers[top] = out;
+          stackStrides[top] = 1;
+        }
+      }
+      else{
+        top--;
+        const double* a = stackPointers[top];
+        const double* b = stackPointers[top+1];
+        const int sa = stackStrides[top];
+        const int sb = stackStrides[top+1];
+        if(sa == 0 && sb == 0){
+          stackScalars[top] = apply(op, *a, *b);
+          stackPointers[top] = &stackScalars[top];
+        }
+        else{
+          double* out = &chunkStack[top*chunkSize];
+          switch(op){
+          case ADD:
+            for(int i=0 ; i<n ; ++i) out[i] = a[i*sa] + b[i*sb];
+            break;
+          case SUBTRACT:
+            for(int i=0 ; i<n ; ++i) out[i] = a[i*sa] - b[i*sb];
+            break;
+          case MULTIPLY:
+            for(int i=0 ; i<n ; ++i) out[i] = a[i*sa] * b[i*sb];
+            break;
+          case DIVIDE:
+            for(int i=0 ; i<n ; ++i) out[i] = a[i*sa] / b[i*sb];
+            break;
+          default:
+            for(int i=0 ; i<n ; ++i) out[i] = apply(op, a[i*sa], b[i*sb]);
+          }
+          stackPointers[top] = out;
+          stackStrides[top] = 1;
+        }
+      }
+    }
+    const double* values = stackPointers[0];
+    const int stride = stackStrides[0];
+    for(int i=0 ; i<n ; ++i)
+      result[start+i] = values[i*stride];
+  }
+}
@@ -0,0 +1,214 @@
+/*! \file Peridigm_Expression.hpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+
+#ifndef PERIDIGM_EXPRESSION_HPP
+#define PERIDIGM_EXPRESSION_HPP
+
+#include <Teuchos_RCP.hpp>
+#include <string>
+#include <vector>
+
+#include <Trilinos_version.h>
+#if TRILINOS_MAJOR_MINOR_VERSION >= 111100
+#include "RTC_FunctionRTC.hh"
+#else
+#include "FunctionRTC.hh"
+#endif
+
+namespace PeridigmNS {
+
+/*! \brief Compiled form of a user-defined function string (boundary conditions, horizons, influence functions, etc.).
+ *
+ *  The string is parsed once into a constant-folded postfix program that can be evaluated at a single point
+ *  or over arrays of inputs in one call.  Inputs that are the same for every point (stride zero) are
+ *  propagated as scalars, so subexpressions that depend only on them are computed once per call.
+ *
+ *  Plain expressions, optionally written as "value = expression", are compiled.  Anything else the parser
+ *  does not recognize (e.g., if/else statements) is handed to the run-time compiler, so existing input
+ *  decks keep working, at the cost of one interpreted call per point.
+ */
+class Expression {
+
+public:
+
+  //! Constructor; the variable names define the order of the values passed to evaluate().
+  Expression(const std::string& expression, const std::vector<std::string>& variableNames, const std::string& name = "rtcExpression");
+
+  //! Destructor.
+  ~Expression(){}
+
+  //! Returns true if the expression was compiled, false if it is evaluated by the run-time compiler.
+  bool isCompiled() const { return m_isCompiled; }
+
+  //! Returns true if the expression references the given variable.
+  bool dependsOn(int variableIndex) const { return m_dependsOn[variableIndex]; }
+
+  //! Returns true if the expression does not reference any variable.
+  bool isConstant() const;
+
+  /** \brief Evaluate the expression for a single set of variable values.
+   *
+   *  Compiled expressions use scratch space local to the call and may be evaluated concurrently from
+   *  multiple threads; expressions handed to the run-time compiler are evaluated one call at a time.
+   */
+  double evaluate(const double* variableValues) const;
+
+  /** \brief Evaluate the expression at numPoints points.
+   *
+   *  The values of variable v at point i are read from variables[v][i*strides[v]]; a stride of zero
+   *  marks a variable that has the same value at every point.  Results are written to result[0..numPoints-1].
+   */
+  void evaluate(int numPoints, const double* const* variables, const int* strides, double* result) const;
+
+protected:
+
+  //! Operations of the postfix program.
+  enum OpCode {
+    PUSH_CONSTANT,
+    PUSH_VARIABLE,
+    NEGATE, NOT,
+    SIN, COS, TAN, ASIN, ACOS, ATAN, SINH, COSH, TANH, SQRT, EXP, LOG, LOG10, FABS, FLOOR, CEIL,
+    ADD, SUBTRACT, MULTIPLY, DIVIDE, POWER,
+    LESS, GREATER, LESS_EQUAL, GREATER_EQUAL, EQUAL, NOT_EQUAL, AND, OR,
+    ATAN2, POW, FMOD
+  };
+
+  //! Single instruction of the postfix program.
+  struct Instruction {
+    OpCode op;
+    int variableIndex;
+    double value;
+  };
+
+  //! Node of the parse tree, folded and flattened into the program after parsing.
+  struct Node;
+
+  //! Token types produced by the tokenizer.
+  enum TokenType { NUMBER, IDENTIFIER, OPERATOR, END };
+
+  //! Token produced by the tokenizer.
+  struct Token {
+    TokenType type;
+    std::string text;
+    double value;
+  };
+
+  //! Parse the expression into a program; returns false if the expression is not supported.
+  bool compile(const std::string& expression);
+
+  //! Split the expression into tokens; returns false on unrecognized characters.
+  bool tokenize(const std::string& expression);
+
+  //! Recursive descent parser, one function per precedence level.
+  Teuchos::RCP<Node> parseOr();
+  Teuchos::RCP<Node> parseAnd();
+  Teuchos::RCP<Node> parseEquality();
+  Teuchos::RCP<Node> parseRelational();
+  Teuchos::RCP<Node> parseAdditive();
+  Teuchos::RCP<Node> parseMultiplicative();
+  Teuchos::RCP<Node> parseUnary();
+  Teuchos::RCP<Node> parsePower();
+  Teuchos::RCP<Node> parsePrimary();
+
+  //! Create an operation node, folding it into a constant if all of its arguments are constant.
+  Teuchos::RCP<Node> makeNode(OpCode op, Teuchos::RCP<Node> a, Teuchos::RCP<Node> b = Teuchos::null);
+
+  //! Append the postfix code for a node to the program.
+  void emit(const Teuchos::RCP<Node>& node, int depth);
+
+  //! Set up the run-time compiler for expressions the parser does not support.
+  void setUpRuntimeCompiler(const std::string& expression, const std::string& name);
+
+  //! Apply a unary operation.
+  static double apply(OpCode op, double a);
+
+  //! Apply a binary operation.
+  static double apply(OpCode op, double a, double b);
+
+  //! Number of arguments taken by an operation.
+  static int numArguments(OpCode op);
+
+  //! True if the expression was compiled.
+  bool m_isCompiled;
+
+  //! Names of the variables.
+  std::vector<std::string> m_variableNames;
+
+  //! Flags indicating which variables are referenced.
+  std::vector<bool> m_dependsOn;
+
+  //! Postfix program.
+  std::vector<Instruction> m_program;
+
+  //! Maximum stack depth required by the program.
+  int m_maxStackDepth;
+
+  //! Tokens, used only while parsing.
+  std::vector<Token> m_tokens;
+
+  //! Position in the token list, used only while parsing.
+  unsigned int m_position;
+
+  //! Run-time compiler, used for expressions the parser does not support.
+  Teuchos::RCP<PG_RuntimeCompiler::Function> m_rtcFunction;
+
+private:
+
+  // Private to prohibit use.
+  Expression();
+
+  // Private to prohibit use.
+  Expression(const Expression&);
+
+  // Private to prohibit use.
+  Expression& operator=(const Expression&);
+};
+
+}
+
+#endif // PERIDIGM_EXPRESSION_HPP
@@ -52,14 +52,7 @@
 
 using namespace std;
 
-PeridigmNS::HorizonManager::HorizonManager() {
-  // set up RTCompiler
-  rtcFunction = Teuchos::rcp<PG_RuntimeCompiler::Function>(new PG_RuntimeCompiler::Function(4, "rtcHorizonFunction"));
-  rtcFunction->addVar("double", "x");
-  rtcFunction->addVar("double", "y");
-  rtcFunction->addVar("double", "z");
-  rtcFunction->addVar("double", "value");
-}
+PeridigmNS::HorizonManager::HorizonManager() {}
 
 PeridigmNS::HorizonManager& PeridigmNS::HorizonManager::self() {
   static HorizonManager horizonManager;
@@ -68,6 +61,8 @@ PeridigmNS::HorizonManager& PeridigmNS::HorizonManager::self() {
 
 void PeridigmNS::HorizonManager::loadHorizonInformationFromBlockParameters(Teuchos::ParameterList& blockParams) {
 
+  horizonExpressions.clear();
+
   // Find the horizon value for each block and record the default horizon value (if any)
   for(Teuchos::ParameterList::ConstIterator it = blockParams.begin() ; it != blockParams.end() ; it++){
     Teuchos::ParameterList& params = blockParams.sublist(it->first);
@@ -138,7 +133,7 @@ double PeridigmNS::HorizonManager::getBlockConstantHorizonValue(string blockName
   return horizon;
 }
 
-double PeridigmNS::HorizonManager::evaluateHorizon(string blockName, double x, double y, double z){
+Teuchos::RCP<PeridigmNS::Expression> PeridigmNS::HorizonManager::getHorizonExpression(const string& blockName){
   string name;
   if(horizonStrings.find(blockName) != horizonStrings.end())
     name = blockName;
@@ -148,32 +143,41 @@ double PeridigmNS::HorizonManager::evaluateHorizon(string blockName, double x, d
     string msg = "\n**** Error, no Horizon parameter found for block " + blockName + " and no default block parameter list provided.\n";
     TEUCHOS_TEST_FOR_EXCEPT_MSG(true, msg);
   }
-  string horizonFunction = horizonStrings[name];
-  double horizonValue(0.0);
-
-  string rtcFunctionString = horizonFunction;
-  if(rtcFunctionString.find("value") == string::npos)
-    rtcFunctionString = "value = " + rtcFunctionString;
-  bool success = rtcFunction->addBody(rtcFunctionString);
-  if(success)
-    rtcFunction->varValueFill(0, x);
-  if(success)
-    success = rtcFunction->varValueFill(1, y);
-  if(success)
-    success = rtcFunction->varValueFill(2, z);
-  if(success)
-    success = rtcFunction->varValueFill(3, 0.0);
-  if(success)
-    success = rtcFunction->execute();
-  if(success)
-    horizonValue = rtcFunction->getValueOfVar("value");
-  if(!success){
-    string msg = "\n**** Error in HorizonManager::evaluateHorizon().\n";
-    msg += "**** " + rtcFunction->getErrors() + "\n";
-    TEUCHOS_TEST_FOR_EXCEPT_MSG(!success, msg);
+
+  Teuchos::RCP<Expression>& expression = horizonExpressions[name];
+  if(expression.is_null()){
+    vector<string> variableNames;
+    variableNames.push_back("x");
+    variableNames.push_back("y");
+    variableNames.push_back("z");
+    expression = Teuchos::rcp(new Expression(horizonStrings[name], variableNames, "rtcHorizonFunction"));
   }
+  return expression;
+}
 
-  return horizonValue;
+double PeridigmNS::HorizonManager::evaluateHorizon(string blockName, double x, double y, double z){
+  const double coordinates[3] = {x, y, z};
+  return getHorizonExpression(blockName)->evaluate(coordinates);
+}
+
+void PeridigmNS::HorizonManager::evaluateHorizon(string blockName, const vector<int>& localIds, const double* x, double* horizon){
+  const int numPoints = static_cast<int>(localIds.size());
+  if(numPoints == 0)
+    return;
+
+  // gather the coordinates, evaluate in a single batch, and scatter the results
+  vector<double> coordinates(3*numPoints);
+  vector<double> values(numPoints);
+  for(int i=0 ; i<numPoints ; ++i){
+    coordinates[3*i]   = x[3*localIds[i]];
+    coordinates[3*i+1] = x[3*localIds[i]+1];
+    coordinates[3*i+2] = x[3*localIds[i]+2];
+  }
+  const double* variables[3] = {&coordinates[0], &coordinates[1], &coordinates[2]};
+  const int strides[3] = {3, 3, 3};
+  getHorizonExpression(blockName)->evaluate(numPoints, variables, strides, &values[0]);
+  for(int i=0 ; i<numPoints ; ++i)
+    horizon[localIds[i]] = values[i];
 }
 
 
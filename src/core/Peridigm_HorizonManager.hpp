@@ -48,17 +48,12 @@
 #ifndef PERIDIGM_HORIZONMANAGER_HPP
 #define PERIDIGM_HORIZONMANAGER_HPP
 
+#include "Peridigm_Expression.hpp"
 #include <Teuchos_ParameterList.hpp>
 #include <string>
+#include <vector>
 #include <map>
 
-#include <Trilinos_version.h>
-#if TRILINOS_MAJOR_MINOR_VERSION >= 111100
-#include "RTC_FunctionRTC.hh"
-#else
-#include "FunctionRTC.hh"
-#endif
-
 namespace PeridigmNS{
 
 class HorizonManager {
@@ -80,13 +75,19 @@ public:
   //! Evaluates the horizon for a given block at the given coordinates (x, y, z).
   double evaluateHorizon(std::string blockName, double x, double y, double z);
 
+  //! Evaluates the horizon for a given block at the points (x[3*localIds[i]], x[3*localIds[i]+1], x[3*localIds[i]+2]), storing the result in horizon[localIds[i]].
+  void evaluateHorizon(std::string blockName, const std::vector<int>& localIds, const double* x, double* horizon);
+
   //! Throws a warning if it seems like the horizon is too big
   // void checkHorizon(Teuchos::RCP<Discretization> peridigmDisc, std::map<std::string, double> & blockHorizonValues);
 
 protected:
 
-  //! Run-time compiler, used as function parser
-  Teuchos::RCP<PG_RuntimeCompiler::Function> rtcFunction;
+  //! Returns the compiled horizon function for the given block, falling back to the default block.
+  Teuchos::RCP<Expression> getHorizonExpression(const std::string& blockName);
+
+  //! Compiled horizon functions, created on first use.
+  std::map<std::string, Teuchos::RCP<Expression> > horizonExpressions;
 
   //! Container for strings defining horizon for each block.
   std::map<std::string, std::string> horizonStrings;
@@ -49,7 +49,7 @@
 
 using namespace std;
 
-PG_RuntimeCompiler::Function PeridigmNS::InfluenceFunction::rtcFunction(3, "rtcInfluenceFunctionUserDefinedFunction");
+Teuchos::RCP<PeridigmNS::Expression> PeridigmNS::InfluenceFunction::expression;
 
 PeridigmNS::InfluenceFunction& PeridigmNS::InfluenceFunction::self() {
   static InfluenceFunction influenceFunction;
@@ -60,21 +60,21 @@ PeridigmNS::InfluenceFunction::InfluenceFunction() : m_influenceFunction(NULL) {
 
   // Set the influence function to One by default
   setInfluenceFunction("One");
-
-  // set up RTCompiler
-  rtcFunction.addVar("double", "zeta");
-  rtcFunction.addVar("double", "horizon");
-  rtcFunction.addVar("double", "value");
 }
 
 double PeridigmNS::InfluenceFunction::userDefinedInfluenceFunction(double zeta, double horizon){
-  double value(0.0);
-  bool success = rtcFunction.varValueFill(0, zeta);
-  if(success)
-    success = rtcFunction.varValueFill(1, horizon);
-  if(success)
-    success = rtcFunction.execute();
-  if(success)
-    value = rtcFunction.getValueOfVar("value");
-  return value;
+  const double variables[2] = {zeta, horizon};
+  return expression->evaluate(variables);
+}
+
+void PeridigmNS::InfluenceFunction::evaluate(functionPointer influenceFunction, int numBonds, const double* zeta, double horizon, double* omega){
+  if(influenceFunction == &userDefinedInfluenceFunction){
+    const double* variables[2] = {zeta, &horizon};
+    const int strides[2] = {1, 0};
+    expression->evaluate(numBonds, variables, strides, omega);
+  }
+  else{
+    for(int i=0 ; i<numBonds ; ++i)
+      omega[i] = influenceFunction(zeta[i], horizon);
+  }
 }
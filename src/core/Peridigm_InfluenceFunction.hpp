@@ -48,16 +48,11 @@
 #ifndef PERIDIGM_INFLUENCEFUNCTION_HPP
 #define PERIDIGM_INFLUENCEFUNCTION_HPP
 
+#include "Peridigm_Expression.hpp"
 #include <Teuchos_RCP.hpp>
 #include <Teuchos_Assert.hpp>
 #include <string>
-
-#include <Trilinos_version.h>
-#if TRILINOS_MAJOR_MINOR_VERSION >= 111100
-#include "RTC_FunctionRTC.hh"
-#else
-#include "FunctionRTC.hh"
-#endif
+#include <vector>
 
 namespace PeridigmNS {
 
@@ -131,17 +126,10 @@ public:
     }
     else{
       // Assume that unrecognized strings are user-defined influence functions.
-      std::string rtcFunctionString = influenceFunctionString;
-      if(rtcFunctionString.find("value") == std::string::npos)
-        rtcFunctionString = "value = " + rtcFunctionString;
-      bool success = rtcFunction.addBody(rtcFunctionString);
-      if(success)
-        success = rtcFunction.varValueFill(2, 0.0); // The variable that represents the return value must be set to something
-      if(!success){
-        std::string msg = "\n**** Error in InfluenceFunction::setInfluenceFunction().\n";
-        msg += "**** " + rtcFunction.getErrors() + "\n";
-        TEUCHOS_TEST_FOR_EXCEPT_MSG(!success, msg);
-      }    
+      std::vector<std::string> variableNames;
+      variableNames.push_back("zeta");
+      variableNames.push_back("horizon");
+      expression = Teuchos::rcp(new Expression(influenceFunctionString, variableNames, "rtcInfluenceFunctionUserDefinedFunction"));
       m_influenceFunction = &userDefinedInfluenceFunction;
     }
   }
@@ -156,6 +144,9 @@ public:
   //! Function for evaluating user-defined influence functions
   static double userDefinedInfluenceFunction(double zeta, double horizon);
 
+  //! Evaluates the influence function at numBonds bond lengths with a common horizon; user-defined functions are evaluated in a single batch.
+  static void evaluate(functionPointer influenceFunction, int numBonds, const double* zeta, double horizon, double* omega);
+
 private:
 
   //! Constructor, private to prevent use (singleton class).
@@ -167,8 +158,8 @@ private:
   //! Private and unimplemented to prevent use
   InfluenceFunction & operator= ( const InfluenceFunction & );
 
-  //! Run-time compiler, used as function parser
-  static PG_RuntimeCompiler::Function rtcFunction;
+  //! Compiled user-defined influence function
+  static Teuchos::RCP<Expression> expression;
 
   //! Function pointer to the influence function with the signature:  double function(double zeta, double horizon).
   functionPointer m_influenceFunction;
@@ -47,9 +47,23 @@
 
 #include "Peridigm_ModelEvaluator.hpp"
 #include "Peridigm_ThermalMaterial.hpp"
+#include <Teuchos_Assert.hpp>
 
 using namespace std;
 
+namespace {
+
+//! Returns true if the block's damage and material models are evaluated in a single pass over the bonds, in which case the criterion is filled in.
+bool hasFusedDamage(PeridigmNS::Block& block, PeridigmNS::InlineDamageCriterion& criterion)
+{
+  Teuchos::RCP<const PeridigmNS::DamageModel> damageModel = block.getDamageModel();
+  if(damageModel.is_null() || !damageModel->getInlineDamageCriterion(criterion))
+    return false;
+  return block.getMaterialModel()->supportsInlineDamage(criterion);
+}
+
+}
+
 PeridigmNS::ModelEvaluator::ModelEvaluator(){
 }
 
@@ -61,10 +75,94 @@ PeridigmNS::ModelEvaluator::evalModel(Teuchos::RCP<Workset> workset) const
 {
   const double dt = workset->timeStep;
   std::vector<PeridigmNS::Block>::iterator blockIt;
+  int blockIndex;
+
+  // Determine once per block whether damage is fused with the internal force evaluation
+  std::vector<PeridigmNS::InlineDamageCriterion> criteria(workset->blocks->size());
+  std::vector<bool> fusedDamage(workset->blocks->size());
+  for(blockIt = workset->blocks->begin(), blockIndex = 0 ; blockIt != workset->blocks->end() ; blockIt++, blockIndex++)
+    fusedDamage[blockIndex] = hasFusedDamage(*blockIt, criteria[blockIndex]);
 
   // ---- Evaluate Damage ---
 
-  for(blockIt = workset->blocks->begin() ; blockIt != workset->blocks->end() ; blockIt++){
+  for(blockIt = workset->blocks->begin(), blockIndex = 0 ; blockIt != workset->blocks->end() ; blockIt++, blockIndex++){
+
+    // Damage for fused blocks is evaluated along with the internal force
+    if(fusedDamage[blockIndex])
+      continue;
+
+    Teuchos::RCP<const PeridigmNS::DamageModel> damageModel = blockIt->getDamageModel();
+    if(!damageModel.is_null()){
+      Teuchos::RCP<PeridigmNS::NeighborhoodData> neighborhoodData = blockIt->getNeighborhoodData();
+      const int numOwnedPoints = neighborhoodData->NumOwnedPoints();
+      const int* ownedIDs = neighborhoodData->OwnedIDs();
+      const int* neighborhoodList = neighborhoodData->NeighborhoodList();
+      Teuchos::RCP<PeridigmNS::DataManager> dataManager = blockIt->getDataManager();
+      damageModel->computeDamage(dt,
+                                 numOwnedPoints,
+                                 ownedIDs,
+                                 neighborhoodList,
+                                 *dataManager);
+    }
+  }
+
+  // ---- Evaluate Internal Force ----
+
+  for(blockIt = workset->blocks->begin(), blockIndex = 0 ; blockIt != workset->blocks->end() ; blockIt++, blockIndex++){
+
+    Teuchos::RCP<PeridigmNS::NeighborhoodData> neighborhoodData = blockIt->getNeighborhoodData();
+    const int numOwnedPoints = neighborhoodData->NumOwnedPoints();
+    const int* ownedIDs = neighborhoodData->OwnedIDs();
+    const int* neighborhoodList = neighborhoodData->NeighborhoodList();
+    Teuchos::RCP<PeridigmNS::DataManager> dataManager = blockIt->getDataManager();
+    Teuchos::RCP<const PeridigmNS::Material> materialModel = blockIt->getMaterialModel();
+
+    if(fusedDamage[blockIndex])
+      materialModel->computeForceAndDamage(dt,
+                                           numOwnedPoints,
+                                           ownedIDs,
+                                           neighborhoodList,
+                                           *dataManager,
+                                           criteria[blockIndex]);
+    else
+      materialModel->computeForce(dt,
+                                  numOwnedPoints,
+                                  ownedIDs,
+                                  neighborhoodList,
+                                  *dataManager);
+  }
+
+  // ---- Evaluate Contact ----
+  if(!workset->contactManager.is_null())
+    workset->contactManager->evaluateContactForce(dt);
+}
+
+void
+PeridigmNS::ModelEvaluator::evalModel(Teuchos::RCP<Workset> workset, const std::vector<double>& blockTimeSteps) const
+{
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(blockTimeSteps.size() != workset->blocks->size(),
+                              "**** Error:  ModelEvaluator::evalModel(), number of block time steps does not match number of blocks.\n");
+
+  std::vector<PeridigmNS::Block>::iterator blockIt;
+  int blockIndex;
+
+  // Determine once per block whether damage is fused with the internal force evaluation
+  std::vector<PeridigmNS::InlineDamageCriterion> criteria(workset->blocks->size());
+  std::vector<bool> fusedDamage(workset->blocks->size());
+  for(blockIt = workset->blocks->begin(), blockIndex = 0 ; blockIt != workset->blocks->end() ; blockIt++, blockIndex++)
+    fusedDamage[blockIndex] = hasFusedDamage(*blockIt, criteria[blockIndex]);
+
+  // ---- Evaluate Damage ---
+
+  for(blockIt = workset->blocks->begin(), blockIndex = 0 ; blockIt != workset->blocks->end() ; blockIt++, blockIndex++){
+
+    const double dt = blockTimeSteps[blockIndex];
+    if(dt <= 0.0)
+      continue;
+
+    // Damage for fused blocks is evaluated along with the internal force
+    if(fusedDamage[blockIndex])
+      continue;
 
     Teuchos::RCP<const PeridigmNS::DamageModel> damageModel = blockIt->getDamageModel();
     if(!damageModel.is_null()){
@@ -83,6 +181,46 @@ PeridigmNS::ModelEvaluator::evalModel(Teuchos::RCP<Workset> workset) const
 
   // ---- Evaluate Internal Force ----
 
+  for(blockIt = workset->blocks->begin(), blockIndex = 0 ; blockIt != workset->blocks->end() ; blockIt++, blockIndex++){
+
+    const double dt = blockTimeSteps[blockIndex];
+    if(dt <= 0.0)
+      continue;
+
+    Teuchos::RCP<PeridigmNS::NeighborhoodData> neighborhoodData = blockIt->getNeighborhoodData();
+    const int numOwnedPoints = neighborhoodData->NumOwnedPoints();
+    const int* ownedIDs = neighborhoodData->OwnedIDs();
+    const int* neighborhoodList = neighborhoodData->NeighborhoodList();
+    Teuchos::RCP<PeridigmNS::DataManager> dataManager = blockIt->getDataManager();
+    Teuchos::RCP<const PeridigmNS::Material> materialModel = blockIt->getMaterialModel();
+
+    if(fusedDamage[blockIndex])
+      materialModel->computeForceAndDamage(dt,
+                                           numOwnedPoints,
+                                           ownedIDs,
+                                           neighborhoodList,
+                                           *dataManager,
+                                           criteria[blockIndex]);
+    else
+      materialModel->computeForce(dt,
+                                  numOwnedPoints,
+                                  ownedIDs,
+                                  neighborhoodList,
+                                  *dataManager);
+  }
+
+  // ---- Evaluate Contact ----
+  // Contact is evaluated at the global (finest) time step
+  if(!workset->contactManager.is_null())
+    workset->contactManager->evaluateContactForce(workset->timeStep);
+}
+
+void
+PeridigmNS::ModelEvaluator::evalInternalForce(Teuchos::RCP<Workset> workset) const
+{
+  const double dt = workset->timeStep;
+  std::vector<PeridigmNS::Block>::iterator blockIt;
+
   for(blockIt = workset->blocks->begin() ; blockIt != workset->blocks->end() ; blockIt++){
 
     Teuchos::RCP<PeridigmNS::NeighborhoodData> neighborhoodData = blockIt->getNeighborhoodData();
@@ -98,10 +236,6 @@ PeridigmNS::ModelEvaluator::evalModel(Teuchos::RCP<Workset> workset) const
                                 neighborhoodList,
                                 *dataManager);
   }
-
-  // ---- Evaluate Contact ----
-  if(!workset->contactManager.is_null())
-    workset->contactManager->evaluateContactForce(dt);
 }
 
 void
@@ -77,6 +77,12 @@ namespace PeridigmNS {
     //! Model evaluation that acts directly on the workset
     void evalModel(Teuchos::RCP<Workset> workset) const;
 
+    //! Model evaluation for multi-rate subcycling; each block uses its own time step, blocks with a nonpositive time step are skipped
+    void evalModel(Teuchos::RCP<Workset> workset, const std::vector<double>& blockTimeSteps) const;
+
+    //! Internal force evaluation only; damage and contact are not evaluated and fused blocks use the plain force kernel
+    void evalInternalForce(Teuchos::RCP<Workset> workset) const;
+
     //! Model evaluation that acts directly on the workset
     void evalHeatFlow(Teuchos::RCP<Workset> workset) const;
 
@@ -0,0 +1,102 @@
+/*! \file utPeridigm_Expression.cpp  with Teuchos Unit test Library*/
+
+//@HEADER
+// ************************************************************************
+//
+// ************************************************************************
+//@HEADER 
+
+#include "Peridigm_Expression.hpp"
+#include <vector>
+#include <cmath>
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "Teuchos_GlobalMPISession.hpp"
+
+using namespace Teuchos;
+using namespace PeridigmNS;
+using namespace std;
+
+vector<string> coordinatesAndTime()
+{
+  vector<string> variableNames;
+  variableNames.push_back("x");
+  variableNames.push_back("y");
+  variableNames.push_back("z");
+  variableNames.push_back("t");
+  return variableNames;
+}
+
+//! Check that plain expressions are compiled, constant folded, and evaluated correctly.
+
+TEUCHOS_UNIT_TEST(Expression, ScalarEvaluationTest) {
+
+  double tolerance = 1.0e-14;
+  double variables[4] = {1.0, 2.0, 3.0, 0.5};
+
+  Expression constant("value = 1E-5 * 94.25^2", coordinatesAndTime());
+  TEST_ASSERT(constant.isCompiled());
+  TEST_ASSERT(constant.isConstant());
+  TEST_FLOATING_EQUALITY(constant.evaluate(variables), 1.0e-5*94.25*94.25, tolerance);
+
+  Expression timeDependent("-0.1*sin(3.1415926553589793*t/0.00005);", coordinatesAndTime());
+  TEST_ASSERT(timeDependent.isCompiled());
+  TEST_ASSERT(!timeDependent.dependsOn(0) && !timeDependent.dependsOn(1) && !timeDependent.dependsOn(2));
+  TEST_ASSERT(timeDependent.dependsOn(3));
+  TEST_FLOATING_EQUALITY(timeDependent.evaluate(variables), -0.1*sin(3.1415926553589793*0.5/0.00005), tolerance);
+
+  Expression spatial("-2000.0 * y / sqrt(x*x + y*y)", coordinatesAndTime());
+  TEST_ASSERT(spatial.isCompiled());
+  TEST_ASSERT(spatial.dependsOn(0) && spatial.dependsOn(1));
+  TEST_ASSERT(!spatial.dependsOn(2) && !spatial.dependsOn(3));
+  TEST_FLOATING_EQUALITY(spatial.evaluate(variables), -2000.0*2.0/sqrt(5.0), tolerance);
+
+  Expression precedence("-2^2 + 2^3^2 + (x < 1.5 && y >= 2) + atan2(y, x)", coordinatesAndTime());
+  TEST_ASSERT(precedence.isCompiled());
+  TEST_FLOATING_EQUALITY(precedence.evaluate(variables), -4.0 + 512.0 + 1.0 + atan2(2.0, 1.0), tolerance);
+}
+
+//! Check that batch evaluation with strided and uniform inputs matches scalar evaluation.
+
+TEUCHOS_UNIT_TEST(Expression, BatchEvaluationTest) {
+
+  double tolerance = 1.0e-14;
+  int numPoints = 1000;
+  vector<double> coordinates(3*numPoints);
+  for(int i=0 ; i<3*numPoints ; ++i)
+    coordinates[i] = 0.001*(i+1);
+  double time = 0.3;
+
+  Expression expression("0.001*y*t/1.0e-8 + x*exp(-z)", coordinatesAndTime());
+  TEST_ASSERT(expression.isCompiled());
+
+  vector<double> result(numPoints);
+  const double* variables[4] = {&coordinates[0], &coordinates[1], &coordinates[2], &time};
+  const int strides[4] = {3, 3, 3, 0};
+  expression.evaluate(numPoints, variables, strides, &result[0]);
+
+  for(int i=0 ; i<numPoints ; ++i){
+    double pointVariables[4] = {coordinates[3*i], coordinates[3*i+1], coordinates[3*i+2], time};
+    TEST_FLOATING_EQUALITY(result[i], expression.evaluate(pointVariables), tolerance);
+  }
+}
+
+//! Check that statements the parser does not support are left to the run-time compiler.
+
+TEUCHOS_UNIT_TEST(Expression, RuntimeCompilerFallbackTest) {
+
+  Expression statement("if(t<=1){value=-y*1.0e-6*t;} else{value=-y*1.0e-6*1;}", coordinatesAndTime());
+  TEST_ASSERT(!statement.isCompiled());
+  TEST_ASSERT(statement.dependsOn(1) && statement.dependsOn(3));
+  TEST_ASSERT(!statement.dependsOn(0) && !statement.dependsOn(2));
+
+  double variables[4] = {1.0, 2.0, 3.0, 0.5};
+  TEST_FLOATING_EQUALITY(statement.evaluate(variables), -2.0*1.0e-6*0.5, 1.0e-14);
+}
+
+int main( int argc, char* argv[] ) {
+
+    Teuchos::GlobalMPISession mpiSession(&argc, &argv);
+
+    return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
@@ -0,0 +1,123 @@
+/*! \file utPeridigm_PowerIteration.cpp  with Teuchos Unit test Library*/
+
+//@HEADER
+// ************************************************************************
+//
+// ************************************************************************
+//@HEADER
+
+#include <Epetra_ConfigDefs.h> // used to define HAVE_MPI
+#include "Peridigm_Simulation.hpp"
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "Teuchos_GlobalMPISession.hpp"
+#include <boost/math/constants/constants.hpp>
+#include <cmath>
+
+using namespace Teuchos;
+using namespace PeridigmNS;
+using namespace std;
+
+const int numPoints = 10;
+const double density = 7800.0;
+const double bulkModulus = 130.0e9;
+const double horizon = 1.5;
+
+//! Create the input deck for a bar of unit cells, bond based, in which each point bonds only to its nearest neighbors.
+Teuchos::RCP<Teuchos::ParameterList> createBarParams()
+{
+  Teuchos::RCP<Teuchos::ParameterList> params = rcp(new Teuchos::ParameterList());
+
+  Teuchos::ParameterList& discretizationParams = params->sublist("Discretization");
+  discretizationParams.set("Type", "PdQuickGrid");
+  Teuchos::ParameterList& pdQuickGridParams = discretizationParams.sublist("TensorProduct3DMeshGenerator");
+  pdQuickGridParams.set("Type", "PdQuickGrid");
+  pdQuickGridParams.set("X Origin",  0.0);
+  pdQuickGridParams.set("Y Origin",  0.0);
+  pdQuickGridParams.set("Z Origin",  0.0);
+  pdQuickGridParams.set("X Length",  static_cast<double>(numPoints));
+  pdQuickGridParams.set("Y Length",  1.0);
+  pdQuickGridParams.set("Z Length",  1.0);
+  pdQuickGridParams.set("Number Points X", numPoints);
+  pdQuickGridParams.set("Number Points Y", 1);
+  pdQuickGridParams.set("Number Points Z", 1);
+
+  Teuchos::ParameterList& materialParams = params->sublist("Materials").sublist("My Bond Based Material");
+  materialParams.set("Material Model", "Elastic Bond Based");
+  materialParams.set("Density", density);
+  materialParams.set("Bulk Modulus", bulkModulus);
+
+  Teuchos::ParameterList& blockParams = params->sublist("Blocks").sublist("My Block");
+  blockParams.set("Block Names", "block_1");
+  blockParams.set("Material", "My Bond Based Material");
+  blockParams.set("Horizon", horizon);
+
+  Teuchos::ParameterList& solverParams = params->sublist("Solver");
+  solverParams.set("Initial Time", 0.0);
+  solverParams.set("Final Time", 1.0);
+  solverParams.sublist("Verlet").set("Time Step Estimator", "Power Iteration");
+
+  return params;
+}
+
+//! The bond-sum time step, sqrt(2 rho / sum_j c V_j/|xi_j|), for an interior point with two unit bonds.
+double bondSumCriticalTimeStep()
+{
+  const double pi = boost::math::constants::pi<double>();
+  double springConstant = 18.0*bulkModulus/(pi*horizon*horizon*horizon*horizon);
+  return sqrt(2.0*density/(2.0*springConstant));
+}
+
+//! The bar is a free-free chain of equal masses and springs, whose largest eigenvalue is the Gershgorin
+//! bound 4/dt_bs^2 scaled by sin^2((N-1) pi/(2N)); the power iteration must recover it.
+
+TEUCHOS_UNIT_TEST(PowerIteration, BarTest) {
+
+  Simulation simulation(MPI_COMM_WORLD, createBarParams());
+  Teuchos::RCP<Peridigm> peridigm = simulation.getPeridigm();
+
+  Teuchos::ParameterList powerIterationParams;
+  powerIterationParams.set("Maximum Iterations", 1000);
+  powerIterationParams.set("Tolerance", 1.0e-5);
+  powerIterationParams.set("Margin", 1.0);
+
+  const double pi = boost::math::constants::pi<double>();
+  double bondSumTimeStep = bondSumCriticalTimeStep();
+  double analyticTimeStep = bondSumTimeStep/sin((numPoints-1)*pi/(2.0*numPoints));
+
+  double timeStep = peridigm->computePowerIterationCriticalTimeStep(powerIterationParams, bondSumTimeStep);
+  TEST_FLOATING_EQUALITY(timeStep, analyticTimeStep, 1.0e-3);
+  TEST_COMPARE(timeStep, >=, bondSumTimeStep);
+  TEST_COMPARE(timeStep, <=, analyticTimeStep*(1.0 + 1.0e-6));
+
+  // The configuration is restored
+  Teuchos::RCP<Epetra_Vector> u = simulation.getDisplacement();
+  double uNorm;
+  u->NormInf(&uNorm);
+  TEST_EQUALITY(uNorm, 0.0);
+}
+
+//! An unconverged iteration falls back on the bond-sum time step, scaled by the margin.
+
+TEUCHOS_UNIT_TEST(PowerIteration, UnconvergedTest) {
+
+  Simulation simulation(MPI_COMM_WORLD, createBarParams());
+  Teuchos::RCP<Peridigm> peridigm = simulation.getPeridigm();
+
+  Teuchos::ParameterList powerIterationParams;
+  powerIterationParams.set("Maximum Iterations", 1);
+  powerIterationParams.set("Tolerance", 1.0e-12);
+  powerIterationParams.set("Margin", 0.95);
+
+  double bondSumTimeStep = bondSumCriticalTimeStep();
+  double timeStep = peridigm->computePowerIterationCriticalTimeStep(powerIterationParams, bondSumTimeStep);
+  TEST_FLOATING_EQUALITY(timeStep, 0.95*bondSumTimeStep, 1.0e-12);
+}
+
+int main( int argc, char* argv[] ) {
+
+    Teuchos::GlobalMPISession mpiSession(&argc, &argv);
+
+    return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
@@ -0,0 +1,340 @@
+/*! \file utPeridigm_Simulation.cpp  with Teuchos Unit test Library*/
+
+//@HEADER
+// ************************************************************************
+//
+// ************************************************************************
+//@HEADER
+
+#include <Epetra_ConfigDefs.h> // used to define HAVE_MPI
+#include "Peridigm_Simulation.hpp"
+#include "Peridigm_BondBreakageLog.hpp"
+#include <fstream>
+#include <string>
+#include <vector>
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "Teuchos_GlobalMPISession.hpp"
+
+using namespace Teuchos;
+using namespace PeridigmNS;
+using namespace std;
+
+//! Create the input deck for a four-point bar with its right end pulled in the x direction.
+Teuchos::RCP<Teuchos::ParameterList> createFourPointBarParams()
+{
+  Teuchos::RCP<Teuchos::ParameterList> params = rcp(new Teuchos::ParameterList());
+
+  Teuchos::ParameterList& discretizationParams = params->sublist("Discretization");
+  discretizationParams.set("Type", "PdQuickGrid");
+  Teuchos::ParameterList& pdQuickGridParams = discretizationParams.sublist("TensorProduct3DMeshGenerator");
+  pdQuickGridParams.set("Type", "PdQuickGrid");
+  pdQuickGridParams.set("X Origin",  0.0);
+  pdQuickGridParams.set("Y Origin",  0.0);
+  pdQuickGridParams.set("Z Origin",  0.0);
+  pdQuickGridParams.set("X Length",  4.0);
+  pdQuickGridParams.set("Y Length",  1.0);
+  pdQuickGridParams.set("Z Length",  1.0);
+  pdQuickGridParams.set("Number Points X", 4);
+  pdQuickGridParams.set("Number Points Y", 1);
+  pdQuickGridParams.set("Number Points Z", 1);
+
+  Teuchos::ParameterList& materialParams = params->sublist("Materials").sublist("My Elastic Material");
+  materialParams.set("Material Model", "Elastic");
+  materialParams.set("Density", 7800.0);
+  materialParams.set("Bulk Modulus", 130.0e9);
+  materialParams.set("Shear Modulus", 78.0e9);
+
+  Teuchos::ParameterList& blockParams = params->sublist("Blocks").sublist("My Block");
+  blockParams.set("Block Names", "block_1");
+  blockParams.set("Material", "My Elastic Material");
+  blockParams.set("Horizon", 1.5);
+
+  Teuchos::ParameterList& bcParams = params->sublist("Boundary Conditions");
+  bcParams.set("Node Set Left", "1");
+  bcParams.set("Node Set Right", "4");
+  Teuchos::ParameterList& pullParams = bcParams.sublist("Prescribed Displacement Right");
+  pullParams.set("Type", "Prescribed Displacement");
+  pullParams.set("Node Set", "Node Set Right");
+  pullParams.set("Coordinate", "x");
+  pullParams.set("Value", "1.0e3*t");
+
+  Teuchos::ParameterList& solverParams = params->sublist("Solver");
+  solverParams.set("Initial Time", 0.0);
+  solverParams.set("Final Time", 1.0);
+  solverParams.sublist("Verlet").set("Fixed dt", 1.0e-7);
+
+  return params;
+}
+
+//! Create the input deck for a 4x2x2 block, clamped at its left end and pulled at its right end, for the QuasiStatic solver.
+//! The displacement of the right end is written to a probe file with the given name at every load step.
+Teuchos::RCP<Teuchos::ParameterList> createQuasiStaticParams(const string& probeFileName)
+{
+  Teuchos::RCP<Teuchos::ParameterList> params = rcp(new Teuchos::ParameterList());
+
+  Teuchos::ParameterList& discretizationParams = params->sublist("Discretization");
+  discretizationParams.set("Type", "PdQuickGrid");
+  Teuchos::ParameterList& pdQuickGridParams = discretizationParams.sublist("TensorProduct3DMeshGenerator");
+  pdQuickGridParams.set("Type", "PdQuickGrid");
+  pdQuickGridParams.set("X Origin",  0.0);
+  pdQuickGridParams.set("Y Origin",  0.0);
+  pdQuickGridParams.set("Z Origin",  0.0);
+  pdQuickGridParams.set("X Length",  4.0);
+  pdQuickGridParams.set("Y Length",  2.0);
+  pdQuickGridParams.set("Z Length",  2.0);
+  pdQuickGridParams.set("Number Points X", 4);
+  pdQuickGridParams.set("Number Points Y", 2);
+  pdQuickGridParams.set("Number Points Z", 2);
+
+  Teuchos::ParameterList& materialParams = params->sublist("Materials").sublist("My Elastic Material");
+  materialParams.set("Material Model", "Elastic");
+  materialParams.set("Density", 7800.0);
+  materialParams.set("Bulk Modulus", 130.0e9);
+  materialParams.set("Shear Modulus", 78.0e9);
+
+  Teuchos::ParameterList& blockParams = params->sublist("Blocks").sublist("My Block");
+  blockParams.set("Block Names", "block_1");
+  blockParams.set("Material", "My Elastic Material");
+  blockParams.set("Horizon", 1.5);
+
+  Teuchos::ParameterList& bcParams = params->sublist("Boundary Conditions");
+  bcParams.set("Node Set Left", "1 5 9 13");
+  bcParams.set("Node Set Right", "4 8 12 16");
+  const char* coordinates[3] = {"x", "y", "z"};
+  for(int i=0 ; i<3 ; ++i){
+    Teuchos::ParameterList& clampParams = bcParams.sublist(string("Prescribed Displacement Left ") + coordinates[i]);
+    clampParams.set("Type", "Prescribed Displacement");
+    clampParams.set("Node Set", "Node Set Left");
+    clampParams.set("Coordinate", coordinates[i]);
+    clampParams.set("Value", "0.0");
+  }
+  Teuchos::ParameterList& pullParams = bcParams.sublist("Prescribed Displacement Right");
+  pullParams.set("Type", "Prescribed Displacement");
+  pullParams.set("Node Set", "Node Set Right");
+  pullParams.set("Coordinate", "x");
+  pullParams.set("Value", "1.0e-3*t");
+
+  Teuchos::ParameterList& solverParams = params->sublist("Solver");
+  solverParams.set("Initial Time", 0.0);
+  solverParams.set("Final Time", 1.0);
+  Teuchos::ParameterList& quasiStaticParams = solverParams.sublist("QuasiStatic");
+  quasiStaticParams.set("Number of Load Steps", 4);
+  quasiStaticParams.set("Maximum Solver Iterations", 10);
+
+  Teuchos::ParameterList& outputParams = params->sublist("Output");
+  outputParams.set("Output File Type", "Probe");
+  outputParams.set("Output Format", "CSV");
+  outputParams.set("Output Filename", probeFileName);
+  outputParams.set("Output Frequency", 1);
+  Teuchos::ParameterList& probeParams = outputParams.sublist("Probes").sublist("Right_Displacement");
+  probeParams.set("Variable", "Displacement");
+  probeParams.set("Node Set", "Node Set Right");
+  probeParams.set("Calculation Type", "Sum");
+
+  return params;
+}
+
+//! Read the lines of a probe file.
+vector<string> readProbeFile(const string& probeFileName)
+{
+  vector<string> lines;
+  ifstream file((probeFileName + ".csv").c_str());
+  string line;
+  while(getline(file, line))
+    lines.push_back(line);
+  return lines;
+}
+
+//! Advance the Verlet solver and check the time, the views of the mothership vectors, and the prescribed displacement.
+
+TEUCHOS_UNIT_TEST(Simulation, AdvanceExplicitTest) {
+
+  Simulation simulation(MPI_COMM_WORLD, createFourPointBarParams());
+  Teuchos::RCP<Peridigm> peridigm = simulation.getPeridigm();
+
+  double dt = 1.0e-7;
+  double time = simulation.advanceExplicit(5);
+  TEST_FLOATING_EQUALITY(time, 5.0*dt, 1.0e-12);
+  TEST_FLOATING_EQUALITY(simulation.getTime(), 5.0*dt, 1.0e-12);
+  TEST_FLOATING_EQUALITY(simulation.getTimeStep(), dt, 1.0e-15);
+  TEST_EQUALITY(peridigm->getExplicitStep(), 5);
+
+  // The accessors return the mothership vectors themselves, not copies
+  TEST_EQUALITY(simulation.getModelCoordinates().get(), peridigm->getX().get());
+  TEST_EQUALITY(simulation.getCurrentCoordinates().get(), peridigm->getY().get());
+  TEST_EQUALITY(simulation.getDisplacement().get(), peridigm->getU().get());
+  TEST_EQUALITY(simulation.getVelocity().get(), peridigm->getV().get());
+  TEST_EQUALITY(simulation.getAcceleration().get(), peridigm->getA().get());
+  TEST_EQUALITY(simulation.getForce().get(), peridigm->getForce().get());
+  TEST_EQUALITY(simulation.getVolume().get(), peridigm->getVolume().get());
+  TEST_EQUALITY(simulation.getDisplacement()->Values(), peridigm->getU()->Values());
+  TEST_EQUALITY(simulation.getNumOwnedPoints(), peridigm->getOneDimensionalMap()->NumMyElements());
+
+  // The owned points in the node sets are found by local id, and the prescribed displacement has been applied
+  Teuchos::RCP<Epetra_Vector> x = simulation.getModelCoordinates();
+  Teuchos::RCP<Epetra_Vector> u = simulation.getDisplacement();
+  vector<int> right = simulation.getNodeSetLocalIds("Node Set Right");
+  vector<int> left = simulation.getNodeSetLocalIds("Node Set Left");
+  for(unsigned int i=0 ; i<right.size() ; ++i){
+    TEST_EQUALITY(peridigm->getOneDimensionalMap()->GID(right[i]), 3);
+    TEST_FLOATING_EQUALITY((*x)[3*right[i]], 3.5, 1.0e-14);
+    TEST_FLOATING_EQUALITY((*u)[3*right[i]], 1.0e3*time, 1.0e-10);
+  }
+  for(unsigned int i=0 ; i<left.size() ; ++i){
+    TEST_EQUALITY(peridigm->getOneDimensionalMap()->GID(left[i]), 0);
+    TEST_FLOATING_EQUALITY((*x)[3*left[i]], 0.5, 1.0e-14);
+  }
+  int numLocal[2] = {static_cast<int>(right.size()), static_cast<int>(left.size())};
+  int numGlobal[2];
+  peridigm->getEpetraComm()->SumAll(numLocal, numGlobal, 2);
+  TEST_EQUALITY(numGlobal[0], 1);
+  TEST_EQUALITY(numGlobal[1], 1);
+
+  simulation.flushOutput();
+}
+
+//! Check that advancing in several calls gives the same solution as advancing in a single call.
+
+TEUCHOS_UNIT_TEST(Simulation, RepeatedAdvanceTest) {
+
+  Simulation singleCall(MPI_COMM_WORLD, createFourPointBarParams());
+  singleCall.advanceExplicit(5);
+
+  Simulation severalCalls(MPI_COMM_WORLD, createFourPointBarParams());
+  severalCalls.advanceExplicit(3);
+  severalCalls.advanceExplicit(0);
+  double time = severalCalls.advanceExplicit(2);
+  TEST_FLOATING_EQUALITY(time, singleCall.getTime(), 1.0e-14);
+
+  Teuchos::RCP<Epetra_Vector> u1 = singleCall.getDisplacement();
+  Teuchos::RCP<Epetra_Vector> u2 = severalCalls.getDisplacement();
+  Teuchos::RCP<Epetra_Vector> v1 = singleCall.getVelocity();
+  Teuchos::RCP<Epetra_Vector> v2 = severalCalls.getVelocity();
+  TEST_EQUALITY(u1->MyLength(), u2->MyLength());
+  for(int i=0 ; i<u1->MyLength() ; ++i){
+    TEST_EQUALITY((*u1)[i], (*u2)[i]);
+    TEST_EQUALITY((*v1)[i], (*v2)[i]);
+  }
+}
+
+//! Check that a force density written into the applied external force accelerates the point it is applied to.
+
+TEUCHOS_UNIT_TEST(Simulation, AppliedExternalForceTest) {
+
+  const double density = 7800.0;
+  const double forceDensity = 7.8e6;
+  const double dt = 1.0e-7;
+
+  Simulation unloaded(MPI_COMM_WORLD, createFourPointBarParams());
+  unloaded.advanceExplicit(1);
+
+  // Push the left end, which has no boundary condition, in the y direction before the first step
+  Simulation loaded(MPI_COMM_WORLD, createFourPointBarParams());
+  vector<int> left = loaded.getNodeSetLocalIds("Node Set Left");
+  Teuchos::RCP<Epetra_Vector> appliedExternalForce = loaded.getAppliedExternalForce();
+  TEST_ASSERT(!appliedExternalForce.is_null());
+  for(unsigned int i=0 ; i<left.size() ; ++i)
+    (*appliedExternalForce)[3*left[i]+1] = forceDensity;
+
+  // The undeformed bar carries no internal force, so the initial acceleration is the applied force over the density
+  loaded.advanceExplicit(0);
+  Teuchos::RCP<Epetra_Vector> a = loaded.getAcceleration();
+  for(unsigned int i=0 ; i<left.size() ; ++i){
+    TEST_EQUALITY((*a)[3*left[i]], 0.0);
+    TEST_FLOATING_EQUALITY((*a)[3*left[i]+1], forceDensity/density, 1.0e-14);
+    TEST_EQUALITY((*a)[3*left[i]+2], 0.0);
+  }
+
+  // After one Verlet step, u = dt*(dt/2)*a; the internal force from this displacement is negligible
+  loaded.advanceExplicit(1);
+  Teuchos::RCP<Epetra_Vector> u = loaded.getDisplacement();
+  Teuchos::RCP<Epetra_Vector> uUnloaded = unloaded.getDisplacement();
+  for(unsigned int i=0 ; i<left.size() ; ++i){
+    TEST_FLOATING_EQUALITY((*u)[3*left[i]+1] - (*uUnloaded)[3*left[i]+1], 0.5*dt*dt*forceDensity/density, 1.0e-10);
+    TEST_FLOATING_EQUALITY((*a)[3*left[i]+1], forceDensity/density, 1.0e-6);
+  }
+
+  // The applied external force is not cleared by the solver
+  for(unsigned int i=0 ; i<left.size() ; ++i)
+    TEST_EQUALITY((*appliedExternalForce)[3*left[i]+1], forceDensity);
+}
+
+//! Check that advancing the QuasiStatic solver one load step at a time gives the same solution, output, and
+//! bond breakage log step numbers as a single run over the same load steps.
+
+TEUCHOS_UNIT_TEST(Simulation, AdvanceQuasiStaticTest) {
+
+  const int numLoadSteps = 4;
+
+  Teuchos::RCP<Teuchos::ParameterList> singleRunParams = createQuasiStaticParams("utPeridigm_Simulation_SingleRun");
+  Simulation singleRun(MPI_COMM_WORLD, singleRunParams);
+  singleRun.getPeridigm()->execute(Teuchos::sublist(singleRunParams, "Solver"));
+  TEST_EQUALITY(BondBreakageLog::self().getStep(), numLoadSteps);
+
+  Simulation severalCalls(MPI_COMM_WORLD, createQuasiStaticParams("utPeridigm_Simulation_SeveralCalls"));
+  double time = 0.0;
+  for(int step=1 ; step<=numLoadSteps ; ++step){
+    time = severalCalls.advanceQuasiStatic();
+    TEST_FLOATING_EQUALITY(time, step*1.0/numLoadSteps, 1.0e-14);
+    TEST_EQUALITY(BondBreakageLog::self().getStep(), step);
+  }
+  TEST_FLOATING_EQUALITY(severalCalls.getTime(), 1.0, 1.0e-14);
+
+  Teuchos::RCP<Epetra_Vector> u1 = singleRun.getDisplacement();
+  Teuchos::RCP<Epetra_Vector> u2 = severalCalls.getDisplacement();
+  Teuchos::RCP<Epetra_Vector> v1 = singleRun.getVelocity();
+  Teuchos::RCP<Epetra_Vector> v2 = severalCalls.getVelocity();
+  TEST_EQUALITY(u1->MyLength(), u2->MyLength());
+  for(int i=0 ; i<u1->MyLength() ; ++i){
+    TEST_EQUALITY((*u1)[i], (*u2)[i]);
+    TEST_EQUALITY((*v1)[i], (*v2)[i]);
+  }
+
+  // The right end has reached its prescribed displacement
+  vector<int> right = severalCalls.getNodeSetLocalIds("Node Set Right");
+  for(unsigned int i=0 ; i<right.size() ; ++i)
+    TEST_FLOATING_EQUALITY((*u2)[3*right[i]], 1.0e-3, 1.0e-12);
+
+  // The initial configuration is written once, so the probe files hold the same steps and values
+  singleRun.flushOutput();
+  severalCalls.flushOutput();
+  if(singleRun.getPeridigm()->getEpetraComm()->MyPID() == 0){
+    vector<string> singleRunLines = readProbeFile("utPeridigm_Simulation_SingleRun");
+    vector<string> severalCallsLines = readProbeFile("utPeridigm_Simulation_SeveralCalls");
+    TEST_EQUALITY(static_cast<int>(singleRunLines.size()), numLoadSteps + 2);
+    TEST_EQUALITY(singleRunLines.size(), severalCallsLines.size());
+    for(unsigned int i=0 ; i<singleRunLines.size() && i<severalCallsLines.size() ; ++i)
+      TEST_EQUALITY(singleRunLines[i], severalCallsLines[i]);
+  }
+}
+
+//! Check that "Write Initial Configuration" false suppresses the output of the initial configuration.
+
+TEUCHOS_UNIT_TEST(Simulation, WriteInitialConfigurationTest) {
+
+  Teuchos::RCP<Teuchos::ParameterList> params = createQuasiStaticParams("utPeridigm_Simulation_NoInitialConfiguration");
+  Simulation simulation(MPI_COMM_WORLD, params);
+  Teuchos::RCP<Teuchos::ParameterList> solverParams = Teuchos::sublist(params, "Solver");
+  solverParams->set("Write Initial Configuration", false);
+  simulation.getPeridigm()->execute(solverParams);
+  simulation.flushOutput();
+
+  // A header and one line per load step; the first sample is taken at the end of the first load step
+  if(simulation.getPeridigm()->getEpetraComm()->MyPID() == 0){
+    vector<string> lines = readProbeFile("utPeridigm_Simulation_NoInitialConfiguration");
+    TEST_EQUALITY(static_cast<int>(lines.size()), 5);
+    if(lines.size() > 1){
+      size_t timeBegin = lines[1].find(',') + 1;
+      TEST_EQUALITY(lines[1].substr(timeBegin, lines[1].find(',', timeBegin) - timeBegin), "2.5000000000000000e-01");
+    }
+  }
+}
+
+int main( int argc, char* argv[] ) {
+
+    Teuchos::GlobalMPISession mpiSession(&argc, &argv);
+
+    return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
@@ -47,11 +47,12 @@
 
 #include "Peridigm_CriticalStretchDamageModel.hpp"
 #include "Peridigm_Field.hpp"
+#include "Peridigm_BondBreakageLog.hpp"
 
 using namespace std;
 
 PeridigmNS::CriticalStretchDamageModel::CriticalStretchDamageModel(const Teuchos::ParameterList& params)
-  : DamageModel(params), m_applyThermalStrains(false), m_modelCoordinatesFieldId(-1), m_coordinatesFieldId(-1), m_damageFieldId(-1), m_bondDamageFieldId(-1), m_deltaTemperatureFieldId(-1)
+  : DamageModel(params), m_applyThermalStrains(false), m_fusedEvaluation(false), m_modelCoordinatesFieldId(-1), m_coordinatesFieldId(-1), m_damageFieldId(-1), m_bondDamageFieldId(-1), m_deltaTemperatureFieldId(-1)
 {
   m_criticalStretch = params.get<double>("Critical Stretch");
 
@@ -60,6 +61,10 @@ PeridigmNS::CriticalStretchDamageModel::CriticalStretchDamageModel(const Teuchos
     m_applyThermalStrains = true;
   }
 
+  // Evaluate the breaking criterion within the material model's force evaluation, if the material model supports it
+  if(params.isParameter("Fused Evaluation"))
+    m_fusedEvaluation = params.get<bool>("Fused Evaluation");
+
   PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
   m_modelCoordinatesFieldId = fieldManager.getFieldId("Model_Coordinates");
   m_coordinatesFieldId = fieldManager.getFieldId("Coordinates");
@@ -127,6 +132,11 @@ PeridigmNS::CriticalStretchDamageModel::computeDamage(const double dt,
   int nodeId, numNeighbors, neighborID, iID, iNID;
   double nodeInitialX[3], nodeCurrentX[3], initialDistance, currentDistance, relativeExtension, totalDamage;
 
+  // Bonds that break during this evaluation are reported to the bond breakage log, if enabled
+  PeridigmNS::BondBreakageLog& bondBreakageLog = PeridigmNS::BondBreakageLog::self();
+  const bool logBondBreakage = bondBreakageLog.isEnabled();
+  Teuchos::RCP<const Epetra_BlockMap> overlapMap = dataManager.getOverlapScalarPointMap();
+
   // Set the bond damage to the previous value
   *(dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_NP1)) = *(dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_N));
 
@@ -158,6 +168,8 @@ PeridigmNS::CriticalStretchDamageModel::computeDamage(const double dt,
         trialDamage = 1.0;
       if(trialDamage > bondDamageNP1[bondIndex]){
         bondDamageNP1[bondIndex] = trialDamage;
+        if(logBondBreakage)
+          bondBreakageLog.recordBrokenBond(overlapMap->GID(nodeId), overlapMap->GID(neighborID));
       }
       bondIndex += 1;
     }
@@ -182,3 +194,18 @@ PeridigmNS::CriticalStretchDamageModel::computeDamage(const double dt,
  	damage[nodeId] = totalDamage;
   }
 }
+
+bool
+PeridigmNS::CriticalStretchDamageModel::getInlineDamageCriterion(InlineDamageCriterion& criterion) const
+{
+  // The fused kernels do not report individual bond-breaking events
+  if(!m_fusedEvaluation || BondBreakageLog::self().isEnabled())
+    return false;
+
+  criterion.criticalStretch = m_criticalStretch;
+  criterion.thermalExpansionCoefficient = m_applyThermalStrains ? m_alpha : 0.0;
+  criterion.damageFieldId = m_damageFieldId;
+  criterion.bondDamageFieldId = m_bondDamageFieldId;
+  criterion.deltaTemperatureFieldId = m_applyThermalStrains ? m_deltaTemperatureFieldId : -1;
+  return true;
+}
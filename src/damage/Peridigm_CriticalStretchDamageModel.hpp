@@ -89,6 +89,9 @@ namespace PeridigmNS {
                   const int* neighborhoodList,
                   PeridigmNS::DataManager& dataManager) const ;
 
+    //! Returns the critical stretch criterion if "Fused Evaluation" is enabled.
+    virtual bool getInlineDamageCriterion(InlineDamageCriterion& criterion) const ;
+
   protected:
 
 	//! Computes the distance between nodes (a1, a2, a3) and (b1, b2, b3).
@@ -101,6 +104,7 @@ namespace PeridigmNS {
     double m_criticalStretch;
     double m_alpha;
     bool m_applyThermalStrains;
+    bool m_fusedEvaluation;
 
     // field ids for all relevant data
     std::vector<int> m_fieldIds;
@@ -56,6 +56,17 @@
 
 namespace PeridigmNS {
 
+  //! Bond breaking criterion simple enough to be evaluated inside a material model's bond loop.
+  struct InlineDamageCriterion {
+    InlineDamageCriterion() : criticalStretch(0.0), thermalExpansionCoefficient(0.0), damageFieldId(-1), bondDamageFieldId(-1), deltaTemperatureFieldId(-1) {}
+    double criticalStretch;
+    double thermalExpansionCoefficient;
+    int damageFieldId;
+    int bondDamageFieldId;
+    //! Set to -1 if the criterion does not include thermal strains.
+    int deltaTemperatureFieldId;
+  };
+
   //! Base class defining the Peridigm damage model interface.
   class DamageModel{
 
@@ -89,6 +100,9 @@ namespace PeridigmNS {
                   const int* neighborhoodList,
                   PeridigmNS::DataManager& dataManager) const = 0;
 
+    //! Returns true if the damage may be evaluated inline by the material model (see Material::computeForceAndDamage()), in which case the criterion is filled in.
+    virtual bool getInlineDamageCriterion(InlineDamageCriterion& criterion) const { return false; }
+
   private:
 	
 	//! Default constructor with no arguments, private to prevent use.
@@ -47,6 +47,7 @@
 
 #include "Peridigm_InterfaceAwareDamageModel.hpp"
 #include "Peridigm_Field.hpp"
+#include "Peridigm_BondBreakageLog.hpp"
 
 using namespace std;
 
@@ -135,6 +136,11 @@ PeridigmNS::InterfaceAwareDamageModel::computeDamage(const double dt,
   int nodeId, numNeighbors, neighborID, iID, iNID;
   double nodeInitialX[3], nodeCurrentX[3], initialDistance, currentDistance, relativeExtension, totalDamage;
 
+  // Bonds that break during this evaluation are reported to the bond breakage log, if enabled
+  PeridigmNS::BondBreakageLog& bondBreakageLog = PeridigmNS::BondBreakageLog::self();
+  const bool logBondBreakage = bondBreakageLog.isEnabled();
+  Teuchos::RCP<const Epetra_BlockMap> overlapMap = dataManager.getOverlapScalarPointMap();
+
   // Update the bond damage
   // Break bonds if the extension is greater than the critical extension
   for(iID=0 ; iID<numOwnedPoints ; ++iID){
@@ -172,6 +178,8 @@ PeridigmNS::InterfaceAwareDamageModel::computeDamage(const double dt,
       }
       if(trialDamage > bondDamage[bondIndex]){
         bondDamage[bondIndex] = trialDamage;
+        if(logBondBreakage)
+          bondBreakageLog.recordBrokenBond(overlapMap->GID(nodeId), overlapMap->GID(neighborID));
       }
       bondIndex += 1;
     }
@@ -206,6 +214,7 @@ PeridigmNS::InterfaceAwareDamageModel::computeDamage(const double dt,
       cout << "Warning: Potentially rank deficient node detected (Node with 2 or less bonds). " << endl
            << "Node " << nodeId + 1 << " will be removed from the linear system." << endl;
       deficientSet->push_back(nodeId);
+      m_bcManager->invalidateNodeSetCaches();
 
       // if the node is removed from the linear system break all its bonds
       bondIndex -= numNeighbors;
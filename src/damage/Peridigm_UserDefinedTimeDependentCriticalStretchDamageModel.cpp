@@ -47,6 +47,7 @@
 
 #include "Peridigm_UserDefinedTimeDependentCriticalStretchDamageModel.hpp"
 #include "Peridigm_Field.hpp"
+#include "Peridigm_BondBreakageLog.hpp"
 
 using namespace std;
 
@@ -56,10 +57,8 @@ PeridigmNS::UserDefinedTimeDependentCriticalStretchDamageModel::UserDefinedTimeD
 
   functiondmg = params.get<string>("Time Dependent Critical Stretch");
   
-  // set up RTCompiler
-  rtcFunction = Teuchos::rcp<PG_RuntimeCompiler::Function>(new PG_RuntimeCompiler::Function(2, "rtcUserDefinedTimeDependentShortRangeForceContactModel"));
-  rtcFunction->addVar("double", "t");
-  rtcFunction->addVar("double", "value");
+  // compile the function once
+  expression = Teuchos::rcp(new PeridigmNS::Expression(functiondmg, vector<string>(1, "t"), "rtcUserDefinedTimeDependentCriticalStretchDamageModel"));
     
 
   if(params.isParameter("Thermal Expansion Coefficient")){
@@ -94,39 +93,9 @@ PeridigmNS::UserDefinedTimeDependentCriticalStretchDamageModel::~UserDefinedTime
 }
 
 void PeridigmNS::UserDefinedTimeDependentCriticalStretchDamageModel::evaluateParserDmg(double & currentValue, double & previousValue, const double & timeCurrent, const double & timePrevious){
-  
-  string rtcFunctionString = functiondmg;
-  if(rtcFunctionString.find("value") == string::npos)
-    rtcFunctionString = "value = " + rtcFunctionString;
-  bool success = rtcFunction->addBody(rtcFunctionString);
-  if(!success){
-    string msg = "\n**** Error:  rtcFunction->addBody(functiondmg) returned nonzero error code in UserDefinedTimeDependentCriticalStretchDamageModel::evaluateParserDmg().\n";
-    msg += "**** " + rtcFunction->getErrors() + "\n";
-    TEUCHOS_TEST_FOR_EXCEPT_MSG(!success, msg);
-  }
 
-  // set the return value to 0.0
-  if(success)
-    success = rtcFunction->varValueFill(1, 0.0);
-  // evaluate at previous time
-  if(success)
-    success = rtcFunction->varValueFill(0, timePrevious);
-  if(success)
-    success = rtcFunction->execute();
-  if(success)
-    previousValue = rtcFunction->getValueOfVar("value");
-  // evaluate at current time
-  if(success)
-    success = rtcFunction->varValueFill(0, timeCurrent);
-  if(success)
-    success = rtcFunction->execute();
-  if(success)
-    currentValue = rtcFunction->getValueOfVar("value");
-  if(!success){
-    string msg = "\n**** Error in UserDefinedTimeDependentCriticalStretchDamageModel::evaluateParserDmg().\n";
-    msg += "**** " + rtcFunction->getErrors() + "\n";
-    TEUCHOS_TEST_FOR_EXCEPT_MSG(!success, msg);
-  }
+  previousValue = expression->evaluate(&timePrevious);
+  currentValue = expression->evaluate(&timeCurrent);
 
   m_criticalStretch = currentValue;
   
@@ -183,6 +152,11 @@ PeridigmNS::UserDefinedTimeDependentCriticalStretchDamageModel::computeDamage(co
   int nodeId, numNeighbors, neighborID, iID, iNID;
   double nodeInitialX[3], nodeCurrentX[3], initialDistance, currentDistance, relativeExtension, totalDamage;
 
+  // Bonds that break during this evaluation are reported to the bond breakage log, if enabled
+  PeridigmNS::BondBreakageLog& bondBreakageLog = PeridigmNS::BondBreakageLog::self();
+  const bool logBondBreakage = bondBreakageLog.isEnabled();
+  Teuchos::RCP<const Epetra_BlockMap> overlapMap = dataManager.getOverlapScalarPointMap();
+
   // Set the bond damage to the previous value
   dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_NP1) =
     dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_N);
@@ -215,6 +189,8 @@ PeridigmNS::UserDefinedTimeDependentCriticalStretchDamageModel::computeDamage(co
         trialDamage = 1.0;
       if(trialDamage > bondDamageNP1[bondIndex]){
         bondDamageNP1[bondIndex] = trialDamage;
+        if(logBondBreakage)
+          bondBreakageLog.recordBrokenBond(overlapMap->GID(nodeId), overlapMap->GID(neighborID));
       }
       bondIndex += 1;
     }
@@ -53,13 +53,7 @@
 #include <Teuchos_ParameterList.hpp>
 #include <Epetra_Vector.h>
 #include <Epetra_Map.h>
-
-#include <Trilinos_version.h>
-#if TRILINOS_MAJOR_MINOR_VERSION >= 111100
-#include "RTC_FunctionRTC.hh"
-#else
-#include "FunctionRTC.hh"
-#endif
+#include "Peridigm_Expression.hpp"
 
 namespace PeridigmNS {
 
@@ -128,8 +122,8 @@ namespace PeridigmNS {
     //! string defined funciton
     std::string functiondmg;
 
-    //! Run-time compiler, used as function parser
-    Teuchos::RCP<PG_RuntimeCompiler::Function> rtcFunction;
+    //! Compiled function parser
+    Teuchos::RCP<PeridigmNS::Expression> expression;
 
     // field ids for all relevant data
     std::vector<int> m_fieldIds;
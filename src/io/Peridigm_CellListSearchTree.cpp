@@ -0,0 +1,219 @@
+/*! \file Peridigm_CellListSearchTree.cpp */
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include "Peridigm_CellListSearchTree.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#ifdef PERIDIGM_OPENMP
+#include <omp.h>
+#endif
+
+PeridigmNS::CellListSearchTree::CellListSearchTree(int numPoints, const double* coordinates, double cellSize_)
+  : SearchTree(numPoints, coordinates), cellSize(cellSize_), inverseCellSize(0.0)
+{
+  if(numPoints < 0)
+    throw std::invalid_argument("\n**** Error:  CellListSearchTree, number of points must be nonnegative.\n");
+
+  // Bounding box of the points
+  double upperCorner[3];
+  for(int dof=0 ; dof<3 ; ++dof){
+    lowerCorner[dof] = 0.0;
+    upperCorner[dof] = 0.0;
+  }
+  if(numPoints > 0){
+    for(int dof=0 ; dof<3 ; ++dof)
+      lowerCorner[dof] = upperCorner[dof] = coordinates[dof];
+  }
+  for(int i=1 ; i<numPoints ; ++i){
+    for(int dof=0 ; dof<3 ; ++dof){
+      double value = coordinates[3*i+dof];
+      if(value < lowerCorner[dof])
+        lowerCorner[dof] = value;
+      if(value > upperCorner[dof])
+        upperCorner[dof] = value;
+    }
+  }
+  double extent[3];
+  for(int dof=0 ; dof<3 ; ++dof)
+    extent[dof] = upperCorner[dof] - lowerCorner[dof];
+
+  // If no cell size is given, target roughly eight points per cell
+  if(cellSize <= 0.0){
+    double maxExtent = std::max(extent[0], std::max(extent[1], extent[2]));
+    double boxVolume = 1.0;
+    for(int dof=0 ; dof<3 ; ++dof)
+      boxVolume *= std::max(extent[dof], 1.0e-3*maxExtent);
+    cellSize = 2.0*std::pow(boxVolume/std::max(numPoints, 1), 1.0/3.0);
+    if(!(cellSize > 0.0))
+      cellSize = 1.0;
+  }
+
+  // Guard against an excessive number of (mostly empty) cells
+  const double maxNumCells = 8.0*std::max(numPoints, 1) + 64.0;
+  while( (std::floor(extent[0]/cellSize) + 1.0)*(std::floor(extent[1]/cellSize) + 1.0)*(std::floor(extent[2]/cellSize) + 1.0) > maxNumCells )
+    cellSize *= 2.0;
+  inverseCellSize = 1.0/cellSize;
+
+  int totalNumCells = 1;
+  for(int dof=0 ; dof<3 ; ++dof){
+    numCells[dof] = static_cast<int>(std::floor(extent[dof]*inverseCellSize)) + 1;
+    totalNumCells *= numCells[dof];
+  }
+
+  // Bin the points with a counting sort
+  std::vector<int> pointCell(numPoints);
+  cellOffsets.assign(totalNumCells + 1, 0);
+  for(int i=0 ; i<numPoints ; ++i){
+    int index[3];
+    for(int dof=0 ; dof<3 ; ++dof){
+      index[dof] = static_cast<int>((coordinates[3*i+dof] - lowerCorner[dof])*inverseCellSize);
+      index[dof] = std::min(std::max(index[dof], 0), numCells[dof] - 1);
+    }
+    int cell = (index[2]*numCells[1] + index[1])*numCells[0] + index[0];
+    pointCell[i] = cell;
+    cellOffsets[cell+1] += 1;
+  }
+  for(int cell=0 ; cell<totalNumCells ; ++cell)
+    cellOffsets[cell+1] += cellOffsets[cell];
+
+  std::vector<int> cellPosition(cellOffsets.begin(), cellOffsets.end() - 1);
+  pointIds.resize(numPoints);
+  sortedCoordinates.resize(3*numPoints);
+  for(int i=0 ; i<numPoints ; ++i){
+    int position = cellPosition[pointCell[i]]++;
+    pointIds[position] = i;
+    for(int dof=0 ; dof<3 ; ++dof)
+      sortedCoordinates[3*position+dof] = coordinates[3*i+dof];
+  }
+}
+
+PeridigmNS::CellListSearchTree::~CellListSearchTree()
+{
+}
+
+void PeridigmNS::CellListSearchTree::FindPointsWithinRadius(const double* point, double searchRadius, std::vector<int>& neighborList)
+{
+  appendPointsWithinRadius(point, searchRadius, neighborList);
+}
+
+void PeridigmNS::CellListSearchTree::appendPointsWithinRadius(const double* point, double searchRadius, std::vector<int>& neighborList) const
+{
+  // Range of cells overlapping the bounding box of the search sphere
+  int lower[3], upper[3];
+  for(int dof=0 ; dof<3 ; ++dof){
+    double lo = std::floor((point[dof] - searchRadius - lowerCorner[dof])*inverseCellSize);
+    double hi = std::floor((point[dof] + searchRadius - lowerCorner[dof])*inverseCellSize);
+    if(hi < 0.0 || lo > numCells[dof] - 1)
+      return;
+    lower[dof] = lo < 0.0 ? 0 : static_cast<int>(lo);
+    upper[dof] = hi > numCells[dof] - 1 ? numCells[dof] - 1 : static_cast<int>(hi);
+  }
+
+  const double radiusSquared = searchRadius*searchRadius;
+  for(int k=lower[2] ; k<=upper[2] ; ++k){
+    for(int j=lower[1] ; j<=upper[1] ; ++j){
+      int rowStart = (k*numCells[1] + j)*numCells[0];
+      // Cells along a row are contiguous in memory
+      int begin = cellOffsets[rowStart + lower[0]];
+      int end = cellOffsets[rowStart + upper[0] + 1];
+      for(int position=begin ; position<end ; ++position){
+        const double* x = &sortedCoordinates[3*position];
+        double dx = x[0] - point[0];
+        double dy = x[1] - point[1];
+        double dz = x[2] - point[2];
+        if(dx*dx + dy*dy + dz*dz <= radiusSquared)
+          neighborList.push_back(pointIds[position]);
+      }
+    }
+  }
+}
+
+void PeridigmNS::CellListSearchTree::BatchFindPointsWithinRadius(int numQueryPoints,
+                                                                 const double* points,
+                                                                 const double* searchRadii,
+                                                                 std::vector<int>& neighborListOffsets,
+                                                                 std::vector<int>& neighborList)
+{
+  int numChunks = 1;
+#ifdef PERIDIGM_OPENMP
+  numChunks = omp_get_max_threads();
+#endif
+
+  // Each chunk of contiguous queries is processed into its own buffer, then the buffers are concatenated in order
+  std::vector< std::vector<int> > chunkLists(numChunks);
+  neighborListOffsets.resize(numQueryPoints + 1);
+
+#ifdef PERIDIGM_OPENMP
+  #pragma omp parallel for schedule(static,1) num_threads(numChunks)
+#endif
+  for(int chunk=0 ; chunk<numChunks ; ++chunk){
+    const int begin = static_cast<int>((static_cast<long long>(numQueryPoints)*chunk)/numChunks);
+    const int end = static_cast<int>((static_cast<long long>(numQueryPoints)*(chunk+1))/numChunks);
+    std::vector<int>& list = chunkLists[chunk];
+    for(int i=begin ; i<end ; ++i){
+      // Offsets are relative to the chunk until the chunks are concatenated
+      neighborListOffsets[i] = static_cast<int>(list.size());
+      appendPointsWithinRadius(&points[3*i], searchRadii[i], list);
+    }
+  }
+
+  size_t totalSize = 0;
+  for(int chunk=0 ; chunk<numChunks ; ++chunk)
+    totalSize += chunkLists[chunk].size();
+  neighborList.resize(totalSize);
+
+  int chunkStart = 0;
+  for(int chunk=0 ; chunk<numChunks ; ++chunk){
+    const int begin = static_cast<int>((static_cast<long long>(numQueryPoints)*chunk)/numChunks);
+    const int end = static_cast<int>((static_cast<long long>(numQueryPoints)*(chunk+1))/numChunks);
+    for(int i=begin ; i<end ; ++i)
+      neighborListOffsets[i] += chunkStart;
+    std::copy(chunkLists[chunk].begin(), chunkLists[chunk].end(), neighborList.begin() + chunkStart);
+    chunkStart += static_cast<int>(chunkLists[chunk].size());
+  }
+  neighborListOffsets[numQueryPoints] = chunkStart;
+}
@@ -46,6 +46,7 @@
 #ifndef PERIDIGM_OUTPUTMANAGER_HPP
 #define PERIDIGM_OUTPUTMANAGER_HPP
 
+#include <limits>
 #include <Teuchos_RCP.hpp>
 #include <Epetra_Map.h>
 #include <Epetra_Vector.h>
@@ -75,6 +76,18 @@ namespace PeridigmNS {
     //! Write data to disk
     virtual void write(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, double) = 0;
 
+    //! Write any buffered data to disk
+    virtual void flush(){};
+
+    //! Notify the output manager that the points have been redistributed among the processors
+    virtual void repartition(){};
+
+    //! Schedule output by simulation time, every output frequency multiples of the nominal time step, rather than by the number of calls to write()
+    virtual void scheduleOutputByTime(double initialTime, double nominalTimeStep){};
+
+    //! First scheduled output time strictly after the given time, or the largest double if output is not scheduled by time
+    virtual double nextOutputTime(double currentTime) const { return std::numeric_limits<double>::max(); }
+
   protected:
 
     //! Number of processors and processor ID
@@ -47,6 +47,8 @@
 #define PERIDIGM_OUTPUTMANAGER_CONTAINER_HPP
 
 #include <vector>
+#include <algorithm>
+#include <limits>
 
 #include <Teuchos_RCP.hpp>
 #include <Teuchos_ParameterList.hpp>
@@ -78,6 +80,36 @@ namespace PeridigmNS {
         (*it)->write(blocks, current_time);
     }
 
+    //! Write any buffered data in all output managers in container
+    void flush() {
+      std::vector< Teuchos::RCP< PeridigmNS::OutputManager > >::iterator it;
+      for ( it=outputManagers.begin() ; it < outputManagers.end(); it++ )
+        (*it)->flush();
+    }
+
+    //! Notify all output managers in container that the points have been redistributed
+    void repartition() {
+      std::vector< Teuchos::RCP< PeridigmNS::OutputManager > >::iterator it;
+      for ( it=outputManagers.begin() ; it < outputManagers.end(); it++ )
+        (*it)->repartition();
+    }
+
+    //! Schedule output by simulation time in all output managers in container
+    void scheduleOutputByTime(double initialTime, double nominalTimeStep) {
+      std::vector< Teuchos::RCP< PeridigmNS::OutputManager > >::iterator it;
+      for ( it=outputManagers.begin() ; it < outputManagers.end(); it++ )
+        (*it)->scheduleOutputByTime(initialTime, nominalTimeStep);
+    }
+
+    //! Earliest scheduled output time strictly after the given time over all output managers in container
+    double nextOutputTime(double currentTime) const {
+      double time = std::numeric_limits<double>::max();
+      std::vector< Teuchos::RCP< PeridigmNS::OutputManager > >::const_iterator it;
+      for ( it=outputManagers.begin() ; it < outputManagers.end(); it++ )
+        time = std::min(time, (*it)->nextOutputTime(currentTime));
+      return time;
+    }
+
   protected:
 
     //! Container for RCPs to individual output managers
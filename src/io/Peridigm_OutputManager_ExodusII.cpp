@@ -50,6 +50,7 @@
 #include <iostream>
 #include <iomanip>
 #include <limits>
+#include <cmath>
 
 #include <netcdf.h>
 #include <exodusII.h>
@@ -125,6 +126,11 @@ PeridigmNS::OutputManager_ExodusII::OutputManager_ExodusII(const Teuchos::RCP<Te
   firstOutputStep = params->get<int>("Initial Output Step",1); 
   lastOutputStep = params->get<int>("Final Output Step",std::numeric_limits<int>::max()-1); 
 
+  // Output is scheduled by the number of calls to write() unless the solver requests otherwise
+  timeBasedOutput = false;
+  outputTimeOrigin = 0.0;
+  outputTimeInterval = 0.0;
+
   // User-requested fields for output 
   outputVariables = sublist(params, "Output Variables");
 
@@ -150,6 +156,8 @@ PeridigmNS::OutputManager_ExodusII::OutputManager_ExodusII(const Teuchos::RCP<Te
   
   // Not called yet
   initializeExodusDatabaseCalled = false;
+  reinitializeExodusDatabase = false;
+  databaseSequenceNumber = 0;
 
   // Initialize the exodus database
   // initializeExodusDatabase(blocks);
@@ -222,7 +230,14 @@ void PeridigmNS::OutputManager_ExodusII::write(Teuchos::RCP< std::vector<Peridig
 
   // Only write if count is in between first and last dumps and frequency count match. 
   // The +/- 1 is to account for the initialization dumps
-  if ((count<(firstOutputStep) || count>(lastOutputStep+1)) || (frequency<=0 || (count-1)%frequency!=0)) return;
+  if (count<(firstOutputStep) || count>(lastOutputStep+1)) return;
+  if (timeBasedOutput) {
+    // The initial configuration is always written, afterwards only the scheduled output times are written
+    // The solver lands exactly on each scheduled time, the tolerance only absorbs roundoff in the schedule
+    double outputIndex = std::floor((current_time - outputTimeOrigin)/outputTimeInterval + 0.5);
+    if (count != 1 && std::fabs(current_time - (outputTimeOrigin + outputIndex*outputTimeInterval)) > 1.0e-9*outputTimeInterval) return;
+  }
+  else if (frequency<=0 || (count-1)%frequency!=0) return;
 
   // increment exodus_count index
   exodusCount = exodusCount + 1;
@@ -234,8 +249,8 @@ void PeridigmNS::OutputManager_ExodusII::write(Teuchos::RCP< std::vector<Peridig
   if (globalDataOnly && myPID != 0)
     return;
 
-  // If first call, intialize database
-  if (!initializeExodusDatabaseCalled) {
+  // If first call, or if the decomposition has changed, intialize database
+  if (!initializeExodusDatabaseCalled || reinitializeExodusDatabase) {
     if(globalDataOnly)
       initializeExodusDatabaseWithOnlyGlobalData(blocks);
     else
@@ -466,6 +481,40 @@ void PeridigmNS::OutputManager_ExodusII::write(Teuchos::RCP< std::vector<Peridig
   if (retval!= 0) reportExodusError(retval, "write", "ex_close");
 }
 
+void PeridigmNS::OutputManager_ExodusII::scheduleOutputByTime(double initialTime, double nominalTimeStep) {
+
+  // An output frequency of zero or less still means no output
+  if (frequency<=0 || nominalTimeStep<=0.0)
+    return;
+
+  timeBasedOutput = true;
+  outputTimeOrigin = initialTime;
+  outputTimeInterval = frequency*nominalTimeStep;
+}
+
+double PeridigmNS::OutputManager_ExodusII::nextOutputTime(double currentTime) const {
+
+  if (!timeBasedOutput)
+    return std::numeric_limits<double>::max();
+
+  // Computed from the time alone so that every processor, including those that do not write, agrees on the schedule
+  double outputIndex = std::floor((currentTime - outputTimeOrigin)/outputTimeInterval + 1.0e-9) + 1.0;
+  return outputTimeOrigin + outputIndex*outputTimeInterval;
+}
+
+void PeridigmNS::OutputManager_ExodusII::repartition() {
+
+  // Databases containing only global data do not depend on the decomposition
+  if (globalDataOnly || !initializeExodusDatabaseCalled)
+    return;
+
+  // The node and element counts of an exodus database are fixed, so the output continues in
+  // a new set of databases with a "-s" sequence suffix, following the exodus restart convention
+  databaseSequenceNumber += 1;
+  reinitializeExodusDatabase = true;
+  exodusCount = 0;
+}
+
 void PeridigmNS::OutputManager_ExodusII::initializeExodusDatabase(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks) {
 
   /*
@@ -493,11 +542,19 @@ void PeridigmNS::OutputManager_ExodusII::initializeExodusDatabase(Teuchos::RCP<
     initializeExodusDatabaseCalled = true;
   }
 
+  reinitializeExodusDatabase = false;
+
   // Construct output filename
   filename.str(std::string());
   filename.clear();
+  std::string sequencedFilenameBase = filenameBase;
+  if (databaseSequenceNumber > 0) {
+    std::ostringstream sequence;
+    sequence << "-s" << std::setfill('0') << std::setw(4) << databaseSequenceNumber + 1;
+    sequencedFilenameBase += sequence.str();
+  }
   if (numProc > 1) {
-    filename << filenameBase.c_str();
+    filename << sequencedFilenameBase.c_str();
     // determine number of zeros to use when padding filenames
     std::ostringstream tmpstr;
     tmpstr << numProc;
@@ -509,7 +566,7 @@ void PeridigmNS::OutputManager_ExodusII::initializeExodusDatabase(Teuchos::RCP<
     filename << std::setfill('0') << std::setw(len) << myPID;
   }
   else {
-    filename << filenameBase.c_str() << ".e";
+    filename << sequencedFilenameBase.c_str() << ".e";
   }
 
   /*
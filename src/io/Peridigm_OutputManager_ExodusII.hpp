@@ -74,6 +74,15 @@ namespace PeridigmNS {
     //! Write data to disk
     virtual void write(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, double);
 
+    //! Start a new set of databases at the next write, the current databases hold the previous decomposition
+    virtual void repartition();
+
+    //! Write at multiples of the output frequency times the nominal time step instead of every frequency calls to write()
+    virtual void scheduleOutputByTime(double initialTime, double nominalTimeStep);
+
+    //! First scheduled output time strictly after the given time
+    virtual double nextOutputTime(double currentTime) const;
+
   private:
     
     //! Copy constructor.
@@ -115,9 +124,24 @@ namespace PeridigmNS {
     //! Index of last plot dump step to Exodus file
     int lastOutputStep;
 
+    //! Flag indicating that output is scheduled by simulation time
+    bool timeBasedOutput;
+
+    //! Simulation time of the first output when output is scheduled by time
+    double outputTimeOrigin;
+
+    //! Simulation time between outputs when output is scheduled by time
+    double outputTimeInterval;
+
     //! Flag indicating if this is the first call to initializeExodusDatabase
     bool initializeExodusDatabaseCalled;
 
+    //! Flag indicating that the database must be reinitialized because the decomposition has changed
+    bool reinitializeExodusDatabase;
+
+    //! Number of times the database has been restarted due to a change in decomposition
+    int databaseSequenceNumber;
+
     //! Word sizes for IO and CPU
     int CPU_word_size, IO_word_size;
 
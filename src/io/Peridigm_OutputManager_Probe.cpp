@@ -0,0 +1,438 @@
+/*! \file Peridigm_OutputManager_Probe.cpp */
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <limits>
+#include <cfloat>
+#include <climits>
+
+#include <Epetra_Comm.h>
+#include "Teuchos_StandardParameterEntryValidators.hpp"
+#include <Teuchos_Assert.hpp>
+
+#include "Peridigm.hpp"
+#include "Peridigm_OutputManager_Probe.hpp"
+#include "Peridigm_Field.hpp"
+
+using namespace std;
+
+PeridigmNS::OutputManager_Probe::OutputManager_Probe(const Teuchos::RCP<Teuchos::ParameterList>& params, 
+                                                     PeridigmNS::Peridigm *peridigm_,
+                                                     Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks) 
+  : peridigm(peridigm_), numColumns(0), bufferSize(1000), volumeFieldId(-1) {
+  
+  // No input to validate; no output requested
+  iWrite = true;
+  if (params == Teuchos::null) {
+    iWrite = false;
+    return;
+  }
+
+  // The contents of the "Probes" sublist are checked below
+  Teuchos::ParameterList validParameterList = getValidParameterList();
+  bool isValid = true;
+  try {
+    params->validateParameters(validParameterList, 0);
+  }
+  catch(Teuchos::Exceptions::InvalidParameterName &excpt)  {std::cout<<excpt.what(); isValid=false;}
+  catch(Teuchos::Exceptions::InvalidParameterType &excpt)  {std::cout<<excpt.what(); isValid=false;}
+  catch(Teuchos::Exceptions::InvalidParameterValue &excpt) {std::cout<<excpt.what(); isValid=false;}
+  catch(...) {isValid=false;}
+  if (!isValid){
+    std::cout.flush();
+    TEUCHOS_TEST_FOR_EXCEPTION(1, std::invalid_argument, "PeridigmNS::OutputManager_Probe:::OutputManager_Probe() -- Invalid parameter, type or value.");
+  }
+
+  numProc = params->get<int>("NumProc");
+  myPID = params->get<int>("MyPID");
+
+  // Default to sampling every step
+  frequency = params->get<int>("Output Frequency",1); 
+
+  // Default to CSV output
+  outputFormat = params->get<string>("Output Format","CSV"); 
+  TEUCHOS_TEST_FOR_EXCEPTION( outputFormat != "CSV" && outputFormat != "BINARY", std::invalid_argument,
+                              "PeridigmNS::OutputManager_Probe:::OutputManager_Probe() -- Output format must be CSV or BINARY.");
+
+  // Output filename base
+  filenameBase = params->get<string>("Output Filename","probes"); 
+
+  // Number of samples buffered before they are reduced and written
+  bufferSize = params->get<int>("Buffer Size",1000);
+  TEUCHOS_TEST_FOR_EXCEPTION( bufferSize < 1, std::invalid_argument,
+                              "PeridigmNS::OutputManager_Probe:::OutputManager_Probe() -- Buffer Size must be positive.");
+
+  writeNeighborlist = false;
+
+  FieldManager& fieldManager = FieldManager::self();
+  volumeFieldId = fieldManager.getFieldId("Volume");
+
+  TEUCHOS_TEST_FOR_EXCEPTION( !params->isSublist("Probes"), std::invalid_argument,
+                              "PeridigmNS::OutputManager_Probe:::OutputManager_Probe() -- \"Probes\" parameter list not found.");
+  Teuchos::ParameterList& probeParams = params->sublist("Probes");
+  for (Teuchos::ParameterList::ConstIterator it = probeParams.begin(); it != probeParams.end(); ++it) {
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(!probeParams.isSublist(it->first),
+                                "**** Error processing probe parameters, expected ParameterList but found single entry.\n");
+    const Teuchos::ParameterList& params = probeParams.sublist(it->first);
+
+    Probe probe;
+    probe.name = it->first;
+    probe.variable = params.get<string>("Variable");
+    probe.fieldId = fieldManager.getFieldId(probe.variable);
+    FieldSpec spec = fieldManager.getFieldSpec(probe.fieldId);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(spec.getRelation() != PeridigmField::NODE && spec.getRelation() != PeridigmField::ELEMENT,
+                                "**** Error:  Probe " + probe.name + " requested " + probe.variable + ", probes can track only NODE or ELEMENT data.\n");
+    if(spec.getLength() == PeridigmField::SCALAR)
+      probe.length = 1;
+    else if(spec.getLength() == PeridigmField::VECTOR)
+      probe.length = 3;
+    else
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(true, "**** Error:  Probe " + probe.name + " requested " + probe.variable + ", probes can track only SCALAR or VECTOR data.\n");
+    probe.isStated = (spec.getTemporal() == PeridigmField::TWO_STEP);
+    probe.globalId = -1;
+    probe.operation = ComputeReduction::SUM;
+    probe.volumeWeighted = false;
+    probe.position[0] = probe.position[1] = probe.position[2] = 0.0;
+
+    probe.isNodeSet = params.isParameter("Node Set");
+    if(probe.isNodeSet){
+      probe.nodeSetName = params.get<string>("Node Set");
+      string calculationType = params.get<string>("Calculation Type", "Sum");
+      if(calculationType == "Minimum")
+        probe.operation = ComputeReduction::MINIMUM;
+      else if(calculationType == "Maximum")
+        probe.operation = ComputeReduction::MAXIMUM;
+      else if(calculationType == "Sum")
+        probe.operation = ComputeReduction::SUM;
+      else
+        TEUCHOS_TEST_FOR_EXCEPT_MSG(true, "**** Error:  invalid \"Calculation Type\" for probe " + probe.name + ", must be \"Minimum\", \"Maximum\", or \"Sum\".\n");
+      probe.volumeWeighted = params.get<bool>("Volume Weighted", false);
+    }
+    else{
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(!params.isParameter("X") || !params.isParameter("Y") || !params.isParameter("Z"),
+                                  "**** Error:  Probe " + probe.name + " must specify either a \"Node Set\" or a location \"X\", \"Y\", \"Z\".\n");
+      probe.position[0] = params.get<double>("X");
+      probe.position[1] = params.get<double>("Y");
+      probe.position[2] = params.get<double>("Z");
+    }
+
+    numColumns += probe.length;
+    probes.push_back(probe);
+  }
+
+  // Initialize count (number of times write() has been called)
+  count = 0;
+
+  resolveProbes(blocks);
+
+  iWrite = (myPID == 0);
+  if(iWrite)
+    initializeFile();
+}
+
+PeridigmNS::OutputManager_Probe::~OutputManager_Probe() {
+  // No flush() here; it is collective and the destructor may run on a single rank while an exception unwinds
+  if(file.is_open())
+    file.close();
+}
+
+Teuchos::ParameterList PeridigmNS::OutputManager_Probe::getValidParameterList() {
+
+  // prevent Teuchos from converting parameter types
+  Teuchos::AnyNumberParameterEntryValidator::AcceptedTypes intParam(false);
+  intParam.allowInt(true);
+
+  Teuchos::ParameterList validParameterList("Output");
+  setIntParameter("MyPID",0,"Process ID",&validParameterList,intParam);
+  setIntParameter("NumProc",0,"Number of Process IDs",&validParameterList,intParam);
+  validParameterList.set("Output File Type","Probe");
+  validParameterList.set("Output Filename","probes");
+  Teuchos::setStringToIntegralParameter<int>("Output Format","CSV","CSV or BINARY",Teuchos::tuple<string>("CSV","BINARY"),&validParameterList);
+  setIntParameter("Output Frequency",1,"Frequency of Output",&validParameterList,intParam);
+  setIntParameter("Buffer Size",1000,"Number of samples buffered before writing",&validParameterList,intParam);
+  validParameterList.sublist("Probes");
+
+  return validParameterList;
+}
+
+void PeridigmNS::OutputManager_Probe::initializeFile() {
+
+  std::ostringstream filename;
+  filename << filenameBase << (outputFormat == "CSV" ? ".csv" : ".probe");
+
+  vector<string> columnNames;
+  for(unsigned int i=0 ; i<probes.size() ; ++i){
+    if(probes[i].length == 1)
+      columnNames.push_back(probes[i].name);
+    else{
+      columnNames.push_back(probes[i].name + "_X");
+      columnNames.push_back(probes[i].name + "_Y");
+      columnNames.push_back(probes[i].name + "_Z");
+    }
+  }
+
+  if(outputFormat == "CSV"){
+    file.open(filename.str().c_str(), ios::out | ios::trunc);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(!file.is_open(), "**** Error:  Unable to open probe file " + filename.str() + "\n");
+    file << "Step,Time";
+    for(unsigned int i=0 ; i<columnNames.size() ; ++i)
+      file << "," << columnNames[i];
+    file << endl;
+    file << std::scientific << std::setprecision(16);
+  }
+  else{
+    file.open(filename.str().c_str(), ios::out | ios::binary | ios::trunc);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(!file.is_open(), "**** Error:  Unable to open probe file " + filename.str() + "\n");
+    const int version = 1;
+    file.write("PDPR", 4);
+    file.write(reinterpret_cast<const char*>(&version), sizeof(int));
+    file.write(reinterpret_cast<const char*>(&numColumns), sizeof(int));
+    for(unsigned int i=0 ; i<columnNames.size() ; ++i){
+      int length = static_cast<int>(columnNames[i].size());
+      file.write(reinterpret_cast<const char*>(&length), sizeof(int));
+      file.write(columnNames[i].c_str(), length);
+    }
+    file.flush();
+  }
+}
+
+void PeridigmNS::OutputManager_Probe::findNearestPoints(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks) {
+
+  vector<int> pointProbes;
+  for(unsigned int i=0 ; i<probes.size() ; ++i){
+    if(!probes[i].isNodeSet)
+      pointProbes.push_back(i);
+  }
+  if(pointProbes.size() == 0)
+    return;
+
+  int modelCoordinatesFieldId = FieldManager::self().getFieldId("Model_Coordinates");
+  int numPointProbes = static_cast<int>(pointProbes.size());
+  vector<double> localMinDistanceSquared(numPointProbes, DBL_MAX), globalMinDistanceSquared(numPointProbes);
+  vector<int> localGlobalId(numPointProbes, INT_MAX), globalGlobalId(numPointProbes);
+
+  for(std::vector<Block>::iterator blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
+    double *x;
+    blockIt->getData(modelCoordinatesFieldId, PeridigmField::STEP_NONE)->ExtractView(&x);
+    Teuchos::RCP<const Epetra_BlockMap> ownedMap = blockIt->getOwnedScalarPointMap();
+    int numOwnedPoints = blockIt->getNeighborhoodData()->NumOwnedPoints();
+    for(int p=0 ; p<numPointProbes ; ++p){
+      const double* position = probes[pointProbes[p]].position;
+      for(int iID=0 ; iID<numOwnedPoints ; ++iID){
+        double distanceSquared = (x[3*iID] - position[0])*(x[3*iID] - position[0])
+          + (x[3*iID+1] - position[1])*(x[3*iID+1] - position[1])
+          + (x[3*iID+2] - position[2])*(x[3*iID+2] - position[2]);
+        int globalId = ownedMap->GID(iID);
+        // If there are ties, choose the point with the lowest global id
+        if(distanceSquared < localMinDistanceSquared[p] || (distanceSquared == localMinDistanceSquared[p] && globalId < localGlobalId[p])){
+          localMinDistanceSquared[p] = distanceSquared;
+          localGlobalId[p] = globalId;
+        }
+      }
+    }
+  }
+
+  const Epetra_Comm& comm = *peridigm->getEpetraComm();
+  comm.MinAll(&localMinDistanceSquared[0], &globalMinDistanceSquared[0], numPointProbes);
+  for(int p=0 ; p<numPointProbes ; ++p){
+    if(localMinDistanceSquared[p] != globalMinDistanceSquared[p])
+      localGlobalId[p] = INT_MAX;
+  }
+  comm.MinAll(&localGlobalId[0], &globalGlobalId[0], numPointProbes);
+
+  for(int p=0 ; p<numPointProbes ; ++p){
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(globalGlobalId[p] == INT_MAX, "**** Error:  Unable to find a point for probe " + probes[pointProbes[p]].name + "\n");
+    probes[pointProbes[p]].globalId = globalGlobalId[p];
+  }
+}
+
+void PeridigmNS::OutputManager_Probe::resolveProbes(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks) {
+
+  // The nearest points are found once, thereafter the points are tracked by global id
+  bool needNearestPoints = false;
+  for(unsigned int i=0 ; i<probes.size() ; ++i){
+    if(!probes[i].isNodeSet && probes[i].globalId == -1)
+      needNearestPoints = true;
+  }
+  if(needNearestPoints)
+    findNearestPoints(blocks);
+
+  Teuchos::RCP< std::map< std::string, std::vector<int> > > nodeSets = peridigm->boundaryAndInitialConditionManager->getNodeSets();
+
+  for(unsigned int i=0 ; i<probes.size() ; ++i){
+    Probe& probe = probes[i];
+    probe.localPoints.clear();
+
+    PeridigmField::Step step = probe.isStated ? PeridigmField::STEP_NP1 : PeridigmField::STEP_NONE;
+    bool foundData = false;
+    for(unsigned int b=0 ; b<blocks->size() ; ++b){
+      if((*blocks)[b].hasData(probe.fieldId, step))
+        foundData = true;
+    }
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(!foundData, "**** Error:  Probe " + probe.name + " requested " + probe.variable + ", which is not available in any block.\n");
+
+    vector<int> globalIds;
+    if(probe.isNodeSet){
+      std::map< std::string, std::vector<int> >::iterator nodeSet = nodeSets->find(probe.nodeSetName);
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(nodeSet == nodeSets->end(), "**** Error:  Node set " + probe.nodeSetName + " for probe " + probe.name + " not found.\n");
+      globalIds = nodeSet->second;
+    }
+    else{
+      globalIds.push_back(probe.globalId);
+    }
+
+    for(unsigned int b=0 ; b<blocks->size() ; ++b){
+      Block& block = (*blocks)[b];
+      if(!block.hasData(probe.fieldId, step))
+        continue;
+      Teuchos::RCP<const Epetra_BlockMap> ownedMap = block.getOwnedScalarPointMap();
+      for(unsigned int j=0 ; j<globalIds.size() ; ++j){
+        int localId = ownedMap->LID(globalIds[j]);
+        if(localId != -1)
+          probe.localPoints.push_back(std::make_pair(static_cast<int>(b), localId));
+      }
+    }
+  }
+}
+
+void PeridigmNS::OutputManager_Probe::write(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, double current_time) {
+
+  if (probes.size() == 0) return;
+
+  // increment index count
+  count = count + 1;
+
+  // The first call corresponds to the initial configuration
+  if (frequency<=0 || (count-1)%frequency!=0) return;
+
+  sampleSteps.push_back(count-1);
+  sampleTimes.push_back(current_time);
+
+  double values[3];
+  for(unsigned int i=0 ; i<probes.size() ; ++i){
+    const Probe& probe = probes[i];
+    PeridigmField::Step step = probe.isStated ? PeridigmField::STEP_NP1 : PeridigmField::STEP_NONE;
+
+    double initialValue = 0.0;
+    if(probe.operation == ComputeReduction::MINIMUM)
+      initialValue = DBL_MAX;
+    else if(probe.operation == ComputeReduction::MAXIMUM)
+      initialValue = -DBL_MAX;
+    for(int k=0 ; k<probe.length ; ++k)
+      values[k] = initialValue;
+
+    for(unsigned int j=0 ; j<probe.localPoints.size() ; ++j){
+      Block& block = (*blocks)[probe.localPoints[j].first];
+      int localId = probe.localPoints[j].second;
+      double *data, *volume;
+      block.getData(probe.fieldId, step)->ExtractView(&data);
+      double weight = 1.0;
+      if(probe.volumeWeighted){
+        block.getData(volumeFieldId, PeridigmField::STEP_NONE)->ExtractView(&volume);
+        weight = volume[localId];
+      }
+      for(int k=0 ; k<probe.length ; ++k){
+        double value = weight*data[probe.length*localId + k];
+        if(probe.operation == ComputeReduction::SUM)
+          values[k] += value;
+        else if(probe.operation == ComputeReduction::MINIMUM && value < values[k])
+          values[k] = value;
+        else if(probe.operation == ComputeReduction::MAXIMUM && value > values[k])
+          values[k] = value;
+      }
+    }
+
+    reduction.add(probe.operation, values, probe.length);
+  }
+
+  if(static_cast<int>(sampleSteps.size()) >= bufferSize)
+    flush();
+}
+
+void PeridigmNS::OutputManager_Probe::flush() {
+
+  if(sampleSteps.size() == 0)
+    return;
+
+  // A single reduction per operation for all buffered samples
+  reduction.reduce(*peridigm->getEpetraComm());
+
+  if(iWrite){
+    for(unsigned int s=0 ; s<sampleSteps.size() ; ++s){
+      if(outputFormat == "CSV")
+        file << sampleSteps[s] << "," << sampleTimes[s];
+      else{
+        file.write(reinterpret_cast<const char*>(&sampleSteps[s]), sizeof(int));
+        file.write(reinterpret_cast<const char*>(&sampleTimes[s]), sizeof(double));
+      }
+      for(unsigned int i=0 ; i<probes.size() ; ++i){
+        const double* values = reduction.next(probes[i].operation, probes[i].length);
+        if(outputFormat == "CSV"){
+          for(int k=0 ; k<probes[i].length ; ++k)
+            file << "," << values[k];
+        }
+        else
+          file.write(reinterpret_cast<const char*>(values), probes[i].length*sizeof(double));
+      }
+      if(outputFormat == "CSV")
+        file << "\n";
+    }
+    file.flush();
+  }
+
+  reduction.clear();
+  sampleSteps.clear();
+  sampleTimes.clear();
+}
+
+void PeridigmNS::OutputManager_Probe::repartition() {
+  Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks = peridigm->getBlocks();
+  resolveProbes(blocks);
+}
@@ -0,0 +1,169 @@
+/*! \file Peridigm_OutputManager_Probe.hpp */
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef PERIDIGM_OUTPUTMANAGER_PROBE_HPP
+#define PERIDIGM_OUTPUTMANAGER_PROBE_HPP
+
+#include <fstream>
+
+#include <Peridigm_OutputManager.hpp>
+#include <Peridigm_Compute.hpp>
+
+#include <Teuchos_ParameterList.hpp>
+
+// Forward declaration
+namespace PeridigmNS {
+  class Peridigm; 
+} 
+
+namespace PeridigmNS {
+
+  /** \brief Time-history output for a small number of probes.
+   *
+   *  Each probe tracks a SCALAR or VECTOR variable either at the point nearest to a given location ("X", "Y", "Z")
+   *  or over a node set ("Node Set", with "Calculation Type" Sum, Minimum, or Maximum and optional "Volume Weighted").
+   *  Probes are resolved to locally-owned points once, and again only when the points are repartitioned.
+   *  Local contributions are buffered on every processor for "Buffer Size" samples and are then reduced across
+   *  processors in a single collective call per reduction operation; the root processor appends the samples to
+   *  the time-history file.  Samples remaining in the buffer are written by Peridigm::flushOutput(), which
+   *  Peridigm::execute() calls on completion; they are not written by the destructor.  Probes do not invoke the
+   *  compute classes, so they should track fields that are updated by the solver (e.g., Displacement, Velocity,
+   *  Force_Density).
+   *
+   *  The CSV file has the columns Step, Time, and one column per probe component.  The BINARY file starts with the
+   *  characters "PDPR" followed by the int32 version and number of columns and, for each column, the int32 length
+   *  and characters of its name; each sample is stored as int32 step, float64 time, and float64 values.
+   */
+  class OutputManager_Probe: public PeridigmNS::OutputManager {
+    
+  public:
+    
+    //! Basic constructor.
+    OutputManager_Probe(const Teuchos::RCP<Teuchos::ParameterList>& params, 
+                        PeridigmNS::Peridigm *peridigm_,
+                        Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks);
+    
+    //! Destructor; closes the file without writing samples that have not been flushed.
+    virtual ~OutputManager_Probe();
+
+    //! Record a sample, writing the buffered samples to disk when the buffer is full
+    virtual void write(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, double);
+
+    //! Write the buffered samples to disk; collective, called through Peridigm::flushOutput()
+    virtual void flush();
+
+    //! Resolve the probes to the new locally-owned points
+    virtual void repartition();
+
+  private:
+    
+    //! Copy constructor.
+    OutputManager_Probe( const OutputManager& OM );
+    
+    //! Assignment operator.
+    OutputManager_Probe& operator=( const OutputManager& OM );
+
+    //! Valid Teuchos::ParameterList 
+    Teuchos::ParameterList getValidParameterList();
+
+    //! Find the locally-owned points for each probe
+    void resolveProbes(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks);
+
+    //! Find the global id of the point nearest to each point probe
+    void findNearestPoints(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks);
+
+    //! Open the time-history file and write the header
+    void initializeFile();
+
+    //! Parent pointer
+    PeridigmNS::Peridigm *peridigm;
+
+    //! Description of a single probe
+    struct Probe {
+      std::string name;
+      std::string variable;
+      int fieldId;
+      int length;
+      bool isStated;
+      bool isNodeSet;
+      std::string nodeSetName;
+      double position[3];
+      int globalId;
+      ComputeReduction::Operation operation;
+      bool volumeWeighted;
+      //! Block index and block-local id of the locally-owned points tracked by the probe
+      std::vector< std::pair<int,int> > localPoints;
+    };
+
+    //! Probes
+    std::vector<Probe> probes;
+
+    //! Total number of values per sample
+    int numColumns;
+
+    //! Number of samples held in memory before they are reduced and written
+    int bufferSize;
+
+    //! Step and time of the buffered samples
+    std::vector<int> sampleSteps;
+    std::vector<double> sampleTimes;
+
+    //! Local contributions of the buffered samples
+    ComputeReduction reduction;
+
+    //! Field id for the volume
+    int volumeFieldId;
+
+    //! Flag indicating that the file has been created
+    bool fileInitialized;
+
+    //! Output stream for the time-history file (root processor only)
+    std::ofstream file;
+  };
+  
+}
+ 
+#endif //PERIDIGM_OUTPUTMANAGER_PROBE_HPP
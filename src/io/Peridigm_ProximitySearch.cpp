@@ -207,7 +207,8 @@ void PeridigmNS::ProximitySearch::GlobalProximitySearch(Teuchos::RCP<Epetra_Vect
                                                         int& neighborListSize,                                                      /* output */
                                                         int*& neighborList,                                                         /* output (allocated within function) */
                                                         std::vector< std::tr1::shared_ptr<PdBondFilter::BondFilter> > bondFilters,  /* optional input */
-                                                        double radiusAddition)                                                      /* optional input */
+                                                        double radiusAddition,                                                      /* optional input */
+                                                        const std::string& searchTreeType)                                          /* optional input */
 
 {
   // The proximity search does not appear to function properly if any of the search radii are set to zero
@@ -268,7 +269,8 @@ void PeridigmNS::ProximitySearch::GlobalProximitySearch(Teuchos::RCP<Epetra_Vect
                                  decomp.myGlobalIDs,
                                  decomp.myX,
                                  rebalancedSearchRadii,
-                                 bondFilters);
+                                 bondFilters,
+                                 searchTreeType);
 
   // The neighbor search is complete, but needs to be brought back into the initial decomposition
 
@@ -49,6 +49,7 @@
 #include <Teuchos_RCP.hpp>
 #include <Epetra_Vector.h>
 #include <vector>
+#include <string>
 #include "BondFilter.h"
 
 namespace PeridigmNS {
@@ -88,6 +89,7 @@ namespace ProximitySearch {
      *  \param neighborList      [output]          Pointer to the neighbor list containing the number of neighbors for each point and the list of neighbors for each point (indexes into x).
      *  \param bondFilters       [optional input]  Set of bond filters to employ during the proximity search.
      *  \param radiusAddition    [optional input]  An additional length added to each radius defining the search sphere for each point.
+     *  \param searchTreeType    [optional input]  The search tree used for the local searches, "Zoltan" (default), "JAM", or "Cell List".
      *
      *  The global proximity search finds, for each point in x, all the points that are within the specified search radius.  The search radius is defined separately for
      *  each point.  The neighborList is allocated within this function and becomes the responsibility of the calling routine (i.e., the calling routine is responsible for deallocation).
@@ -102,7 +104,8 @@ namespace ProximitySearch {
                              int& neighborListSize,
                              int*& neighborList,
                              std::vector< std::tr1::shared_ptr<PdBondFilter::BondFilter> > bondFilters = std::vector< std::tr1::shared_ptr<PdBondFilter::BondFilter> >(),
-                             double radiusAddition = 0.0);
+                             double radiusAddition = 0.0,
+                             const std::string& searchTreeType = "Zoltan");
 
 }
 }
@@ -78,6 +78,34 @@ namespace PeridigmNS {
      **/
     virtual void FindPointsWithinRadius(const double* point, double searchRadius, std::vector<int>& neighborList) = 0;
 
+    /** \brief Finds the sets of points within given radii of a batch of points.
+     *
+     *  \param numQueryPoints       The number of query points.
+     *  \param points               The coordinates of the query points, stored as (X0, Y0, Z0, X1, Y1, Z1, ..., XN, YN, ZN).
+     *  \param searchRadii          The radius of the search sphere for each query point.
+     *  \param neighborListOffsets  Resized to numQueryPoints+1; the ids found for query point i are neighborList[neighborListOffsets[i]] through neighborList[neighborListOffsets[i+1]-1].
+     *  \param neighborList         The ids found for all the query points, concatenated in query order.
+     **/
+    virtual void BatchFindPointsWithinRadius(int numQueryPoints,
+                                             const double* points,
+                                             const double* searchRadii,
+                                             std::vector<int>& neighborListOffsets,
+                                             std::vector<int>& neighborList) {
+      neighborListOffsets.resize(numQueryPoints + 1);
+      neighborList.clear();
+      std::vector<int> queryList;
+      for(int i=0 ; i<numQueryPoints ; ++i){
+        neighborListOffsets[i] = static_cast<int>(neighborList.size());
+        queryList.clear();
+        FindPointsWithinRadius(&points[3*i], searchRadii[i], queryList);
+        neighborList.insert(neighborList.end(), queryList.begin(), queryList.end());
+      }
+      neighborListOffsets[numQueryPoints] = static_cast<int>(neighborList.size());
+    }
+
+    //! Returns true if FindPointsWithinRadius() may be called concurrently from multiple threads.
+    virtual bool IsThreadSafe() const { return false; }
+
   private:
 
     //! Default constructor is private to prevent use
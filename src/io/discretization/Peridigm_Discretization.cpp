@@ -46,7 +46,14 @@
 //@HEADER
 
 #include "Peridigm_Discretization.hpp"
+#include "Peridigm_HorizonManager.hpp"
+#include "PdZoltan.h"
+#include <iostream>
 #include <sstream>
+#include <fstream>
+#include <cstring>
+#include <cstdio>
+#include <unistd.h>
 
 using std::set;
 using std::string;
@@ -149,6 +156,9 @@ Epetra_BlockMap PeridigmNS::Discretization::getOverlapMap(const Epetra_Comm& com
 void PeridigmNS::Discretization::createBondFilters(const Teuchos::RCP<Teuchos::ParameterList>& params){
   if(params->isSublist("Bond Filters")){
     Teuchos::RCP<Teuchos::ParameterList> bondFilterParameters = sublist(params, "Bond Filters");
+    stringstream ss;
+    bondFilterParameters->print(ss);
+    bondFilterSignature = ss.str();
     for (Teuchos::ParameterList::ConstIterator it = bondFilterParameters->begin(); it != bondFilterParameters->end(); ++it) {
       string parameterListName = it->first;
       Teuchos::ParameterList params = bondFilterParameters->sublist(parameterListName);
@@ -187,3 +197,232 @@ int PeridigmNS::Discretization::blockNameToBlockId(string blockName) const {
   blockIDSS >> bID;
   return bID;
 }
+
+void PeridigmNS::Discretization::setNeighborhoodCache(const Teuchos::RCP<Teuchos::ParameterList>& params){
+  if(params->isParameter("Neighborhood Cache File"))
+    neighborhoodCacheFileName = params->get<string>("Neighborhood Cache File");
+}
+
+void PeridigmNS::Discretization::setLoadBalanceWeighting(const Teuchos::RCP<Teuchos::ParameterList>& params){
+  if(params->isParameter("Weighted Load Balance"))
+    weightedLoadBalance = params->get<bool>("Weighted Load Balance");
+  if(params->isSublist("Load Balance Cost Factors")){
+    Teuchos::ParameterList& costFactorParams = params->sublist("Load Balance Cost Factors");
+    for(Teuchos::ParameterList::ConstIterator it = costFactorParams.begin() ; it != costFactorParams.end() ; ++it){
+      double costFactor = costFactorParams.get<double>(it->first);
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(costFactor <= 0.0, "\n**** Error, \"Load Balance Cost Factors\" must be positive, invalid value for " + it->first + "\n");
+      loadBalanceCostFactors[it->first] = costFactor;
+    }
+  }
+}
+
+std::vector<double> PeridigmNS::Discretization::estimatedBondCounts(const QUICKGRID::Data& decomp,
+                                                                    const std::vector<std::string>& pointBlockNames) const {
+  PeridigmNS::HorizonManager& horizonManager = PeridigmNS::HorizonManager::self();
+  std::vector<double> bondCounts(decomp.numPoints);
+  const double* x = decomp.myX.get();
+  const double* volume = decomp.cellVolume.get();
+  for(size_t i=0 ; i<decomp.numPoints ; ++i){
+    const string& blockName = pointBlockNames[i];
+    double horizon(0.0);
+    if(horizonManager.blockHasConstantHorizon(blockName))
+      horizon = horizonManager.getBlockConstantHorizonValue(blockName);
+    else
+      horizon = horizonManager.evaluateHorizon(blockName, x[3*i], x[3*i+1], x[3*i+2]);
+    // Number of cells in a sphere of radius horizon, excluding the point itself
+    double count = 4.18879020478639*horizon*horizon*horizon/volume[i] - 1.0;
+    bondCounts[i] = count > 1.0 ? count : 1.0;
+  }
+  return bondCounts;
+}
+
+void PeridigmNS::Discretization::loadBalance(QUICKGRID::Data& decomp,
+                                             const std::vector<double>& bondCounts,
+                                             const std::vector<std::string>& pointBlockNames) const {
+  if(!weightedLoadBalance){
+    decomp = PDNEIGH::getLoadBalancedDiscretization(decomp);
+    return;
+  }
+
+  // Sized to at least one so that every processor takes the weighted (collective) path
+  std::vector<double> weights(decomp.numPoints > 0 ? decomp.numPoints : 1, 0.0);
+  for(size_t i=0 ; i<decomp.numPoints ; ++i){
+    double costFactor = 1.0;
+    std::map<std::string, double>::const_iterator it = loadBalanceCostFactors.find(pointBlockNames[i]);
+    if(it != loadBalanceCostFactors.end())
+      costFactor = it->second;
+    weights[i] = bondCounts[i]*costFactor;
+  }
+
+  double imbalanceBefore(1.0), imbalanceAfter(1.0);
+  decomp = PDNEIGH::getWeightedLoadBalancedDiscretization(decomp, &weights[0], imbalanceBefore, imbalanceAfter);
+
+  int myRank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &myRank);
+  if(myRank == 0){
+    stringstream ss;
+    ss << "Weighted load balance, bond imbalance (max/average) before " << imbalanceBefore << ", after " << imbalanceAfter << "\n";
+    std::cout << ss.str() << std::endl;
+  }
+}
+
+namespace {
+
+  //! Neighborhood cache file identifier and format version.
+  const char neighborhoodCacheMagic[8] = {'P','D','N','C','A','C','H','E'};
+  const int neighborhoodCacheVersion = 2;
+
+  //! 64-bit FNV-1a hash, accumulated over successive calls.
+  void hashBytes(unsigned long long& hash, const void* data, size_t numBytes){
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for(size_t i=0 ; i<numBytes ; ++i){
+      hash ^= bytes[i];
+      hash *= 1099511628211ULL;
+    }
+  }
+
+  template<typename T>
+  void writeBinary(std::ofstream& outFile, const T* data, size_t n){
+    if(n > 0)
+      outFile.write(reinterpret_cast<const char*>(data), n*sizeof(T));
+  }
+
+  template<typename T>
+  bool readBinary(std::ifstream& inFile, T* data, size_t n){
+    if(n > 0)
+      inFile.read(reinterpret_cast<char*>(data), n*sizeof(T));
+    return inFile.good();
+  }
+}
+
+string PeridigmNS::Discretization::neighborhoodCacheFile(const Epetra_Comm& comm) const {
+  stringstream ss;
+  ss << neighborhoodCacheFileName << "." << comm.NumProc() << "." << comm.MyPID();
+  return ss.str();
+}
+
+unsigned long long PeridigmNS::Discretization::neighborhoodCacheKey(Teuchos::RCP<Epetra_Vector> x,
+                                                                    Teuchos::RCP<Epetra_Vector> searchRadii,
+                                                                    double radiusAddition) const {
+  unsigned long long hash = 14695981039346656037ULL;
+  const Epetra_BlockMap& map = searchRadii->Map();
+  int numProc = map.Comm().NumProc();
+  int numOwned = map.NumMyElements();
+  hashBytes(hash, &neighborhoodCacheVersion, sizeof(int));
+  hashBytes(hash, &numProc, sizeof(int));
+  hashBytes(hash, &numOwned, sizeof(int));
+  hashBytes(hash, map.MyGlobalElements(), numOwned*sizeof(int));
+  hashBytes(hash, x->Values(), x->MyLength()*sizeof(double));
+  hashBytes(hash, searchRadii->Values(), searchRadii->MyLength()*sizeof(double));
+  hashBytes(hash, &radiusAddition, sizeof(double));
+  hashBytes(hash, bondFilterSignature.c_str(), bondFilterSignature.size());
+  return hash;
+}
+
+unsigned long long PeridigmNS::Discretization::neighborhoodCacheChecksum(unsigned long long key,
+                                                                         int numOverlap,
+                                                                         const int* overlapGlobalIds,
+                                                                         int neighborListSize,
+                                                                         const int* neighborList) const {
+  unsigned long long hash = key;
+  hashBytes(hash, &numOverlap, sizeof(int));
+  hashBytes(hash, overlapGlobalIds, numOverlap*sizeof(int));
+  hashBytes(hash, &neighborListSize, sizeof(int));
+  hashBytes(hash, neighborList, neighborListSize*sizeof(int));
+  return hash;
+}
+
+bool PeridigmNS::Discretization::readNeighborhoodCache(Teuchos::RCP<Epetra_Vector> x,
+                                                       Teuchos::RCP<Epetra_Vector> searchRadii,
+                                                       double radiusAddition,
+                                                       Teuchos::RCP<Epetra_BlockMap>& overlapMap,
+                                                       int& neighborListSize,
+                                                       int*& neighborList) const {
+  if(neighborhoodCacheFileName.empty())
+    return false;
+
+  const Epetra_Comm& comm = searchRadii->Map().Comm();
+  unsigned long long key = neighborhoodCacheKey(x, searchRadii, radiusAddition);
+
+  std::vector<int> overlapGlobalIds;
+  std::vector<int> list;
+  int localHit = 0;
+  std::ifstream inFile(neighborhoodCacheFile(comm).c_str(), std::ios::in | std::ios::binary);
+  if(inFile.is_open()){
+    char magic[8];
+    int version(0), numOverlap(0), listSize(0);
+    unsigned long long fileKey(0), fileChecksum(0);
+    if(readBinary(inFile, magic, 8) &&
+       std::memcmp(magic, neighborhoodCacheMagic, 8) == 0 &&
+       readBinary(inFile, &version, 1) && version == neighborhoodCacheVersion &&
+       readBinary(inFile, &fileKey, 1) && fileKey == key &&
+       readBinary(inFile, &numOverlap, 1) && numOverlap > 0){
+      overlapGlobalIds.resize(numOverlap);
+      if(readBinary(inFile, &overlapGlobalIds[0], numOverlap) &&
+         readBinary(inFile, &listSize, 1) && listSize > 0){
+        list.resize(listSize);
+        // The trailing checksum must be present, must match the data, and must be the end of the file
+        if(readBinary(inFile, &list[0], listSize) &&
+           readBinary(inFile, &fileChecksum, 1) &&
+           inFile.peek() == std::ifstream::traits_type::eof() &&
+           fileChecksum == neighborhoodCacheChecksum(key, numOverlap, &overlapGlobalIds[0], listSize, &list[0]))
+          localHit = 1;
+      }
+    }
+  }
+
+  // The proximity search is collective, so either every processor uses the cache or none do
+  int globalHit(0);
+  comm.MinAll(&localHit, &globalHit, 1);
+  if(globalHit == 0)
+    return false;
+
+  overlapMap = Teuchos::rcp(new Epetra_BlockMap(-1, static_cast<int>(overlapGlobalIds.size()), &overlapGlobalIds[0], 1, 0, comm));
+  neighborListSize = static_cast<int>(list.size());
+  neighborList = new int[neighborListSize];
+  std::memcpy(neighborList, &list[0], neighborListSize*sizeof(int));
+  return true;
+}
+
+void PeridigmNS::Discretization::writeNeighborhoodCache(Teuchos::RCP<Epetra_Vector> x,
+                                                        Teuchos::RCP<Epetra_Vector> searchRadii,
+                                                        double radiusAddition,
+                                                        Teuchos::RCP<const Epetra_BlockMap> overlapMap,
+                                                        int neighborListSize,
+                                                        const int* neighborList) const {
+  if(neighborhoodCacheFileName.empty())
+    return;
+
+  const Epetra_Comm& comm = searchRadii->Map().Comm();
+  unsigned long long key = neighborhoodCacheKey(x, searchRadii, radiusAddition);
+  int numOverlap = overlapMap->NumMyElements();
+
+  unsigned long long checksum = neighborhoodCacheChecksum(key, numOverlap, overlapMap->MyGlobalElements(), neighborListSize, neighborList);
+
+  // Write to a temporary file and rename it into place, so that an interrupted write, or another
+  // run writing the same cache, never leaves a partial file under the cache file name
+  string fileName = neighborhoodCacheFile(comm);
+  stringstream tempFileNameStream;
+  tempFileNameStream << fileName << ".tmp." << getpid();
+  string tempFileName = tempFileNameStream.str();
+  {
+    std::ofstream outFile(tempFileName.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(!outFile.is_open(), "**** Error opening neighborhood cache file " + tempFileName + " for writing.\n");
+    writeBinary(outFile, neighborhoodCacheMagic, 8);
+    writeBinary(outFile, &neighborhoodCacheVersion, 1);
+    writeBinary(outFile, &key, 1);
+    writeBinary(outFile, &numOverlap, 1);
+    writeBinary(outFile, overlapMap->MyGlobalElements(), numOverlap);
+    writeBinary(outFile, &neighborListSize, 1);
+    writeBinary(outFile, neighborList, neighborListSize);
+    writeBinary(outFile, &checksum, 1);
+    outFile.close();
+    if(outFile.fail())
+      std::remove(tempFileName.c_str());
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(outFile.fail(), "**** Error writing neighborhood cache file " + tempFileName + ".\n");
+  }
+  int renameError = std::rename(tempFileName.c_str(), fileName.c_str());
+  if(renameError != 0)
+    std::remove(tempFileName.c_str());
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(renameError != 0, "**** Error renaming neighborhood cache file " + tempFileName + " to " + fileName + ".\n");
+}
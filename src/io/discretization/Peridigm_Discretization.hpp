@@ -65,7 +65,8 @@ namespace PeridigmNS {
     //! Constructor
     Discretization() :
       elementBlocks(Teuchos::rcp(new std::map< std::string, std::vector<int> >())),
-      nodeSets(Teuchos::rcp(new std::map< std::string, std::vector<int> >()))
+      nodeSets(Teuchos::rcp(new std::map< std::string, std::vector<int> >())),
+      weightedLoadBalance(false)
     {}
 
     //! Destructor
@@ -158,11 +159,59 @@ namespace PeridigmNS {
 
     void createBondFilters(const Teuchos::RCP<Teuchos::ParameterList>& params);
 
+    /** \brief Read the optional "Neighborhood Cache File" parameter.
+     *  The cache holds the result of the proximity search and is supported only by the Exodus
+     *  discretization; the text file and PdQuickGrid discretizations reject the parameter. */
+    void setNeighborhoodCache(const Teuchos::RCP<Teuchos::ParameterList>& params);
+
+    //! Read the optional "Weighted Load Balance" parameter and "Load Balance Cost Factors" sublist.
+    void setLoadBalanceWeighting(const Teuchos::RCP<Teuchos::ParameterList>& params);
+
     //! Get the block id for a given block name
     int blockNameToBlockId(std::string blockName) const;
 
   protected:
 
+    /** \brief Load the result of a proximity search from the neighborhood cache.
+     *  Returns true, on all processors, only if every processor found a cache file whose key
+     *  matches the current owned points, positions, horizons, bond filters, and processor count. */
+    bool readNeighborhoodCache(Teuchos::RCP<Epetra_Vector> x,
+                               Teuchos::RCP<Epetra_Vector> searchRadii,
+                               double radiusAddition,
+                               Teuchos::RCP<Epetra_BlockMap>& overlapMap,
+                               int& neighborListSize,
+                               int*& neighborList) const;
+
+    //! Write the result of a proximity search to the neighborhood cache.
+    void writeNeighborhoodCache(Teuchos::RCP<Epetra_Vector> x,
+                                Teuchos::RCP<Epetra_Vector> searchRadii,
+                                double radiusAddition,
+                                Teuchos::RCP<const Epetra_BlockMap> overlapMap,
+                                int neighborListSize,
+                                const int* neighborList) const;
+
+    //! Hash of the cached data, written at the end of the neighborhood cache file to detect truncated or corrupted files.
+    unsigned long long neighborhoodCacheChecksum(unsigned long long key,
+                                                 int numOverlap,
+                                                 const int* overlapGlobalIds,
+                                                 int neighborListSize,
+                                                 const int* neighborList) const;
+
+    //! Hash of the inputs to the proximity search, used to validate the neighborhood cache.
+    unsigned long long neighborhoodCacheKey(Teuchos::RCP<Epetra_Vector> x,
+                                            Teuchos::RCP<Epetra_Vector> searchRadii,
+                                            double radiusAddition) const;
+
+    //! Name of the neighborhood cache file for this processor.
+    std::string neighborhoodCacheFile(const Epetra_Comm& comm) const;
+
+    /** \brief Load balance the decomposition with PdZoltan RCB. If weighted load balancing is enabled, each point
+     *  is weighted by its bond count scaled by the cost factor for its block, and the imbalance is reported. */
+    void loadBalance(QUICKGRID::Data& decomp, const std::vector<double>& bondCounts, const std::vector<std::string>& pointBlockNames) const;
+
+    //! Expected bond count for each point in the decomposition, from its horizon and cell volume (ignores truncation at free surfaces).
+    std::vector<double> estimatedBondCounts(const QUICKGRID::Data& decomp, const std::vector<std::string>& pointBlockNames) const;
+
     //! Get the overlap map.
     static Epetra_BlockMap getOverlap(int ndf, int numShared, int*shared, int numOwned, const  int* owned, const Epetra_Comm& comm);
 
@@ -187,6 +236,18 @@ namespace PeridigmNS {
 
     std::vector< std::tr1::shared_ptr<PdBondFilter::BondFilter> > bondFilters;
 
+    //! Text representation of the bond filter parameters, included in the neighborhood cache key.
+    std::string bondFilterSignature;
+
+    //! Base name of the neighborhood cache files, empty if the cache is disabled.
+    std::string neighborhoodCacheFileName;
+
+    //! Flag for weighting the initial load balance by bond counts.
+    bool weightedLoadBalance;
+
+    //! Relative cost per bond for each block, used in weighted load balancing (defaults to 1.0).
+    std::map<std::string, double> loadBalanceCostFactors;
+
   private:
 
     //! Private to prohibit copying.
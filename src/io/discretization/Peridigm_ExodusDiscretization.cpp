@@ -49,9 +49,11 @@
 #include "Peridigm_ProximitySearch.hpp"
 #include "Peridigm_HorizonManager.hpp"
 #include "Peridigm_GeometryUtils.hpp"
+#include "PdZoltan.h"
 #include <Epetra_Map.h>
 #include <Epetra_Vector.h>
 #include <Epetra_Import.h>
+#include <Epetra_Export.h>
 #include <Epetra_MpiComm.h>
 #include <Teuchos_CommHelpers.hpp>
 #include <Teuchos_DefaultComm.hpp>
@@ -59,6 +61,8 @@
 #include <Teuchos_RCP.hpp>
 #include <Ionit_Initializer.h>
 #include <sstream>
+#include <set>
+#include <algorithm>
 #include <boost/math/constants/constants.hpp>
 #include <boost/algorithm/string.hpp>
 #include <exodusII.h>
@@ -72,6 +76,7 @@ PeridigmNS::ExodusDiscretization::ExodusDiscretization(const Teuchos::RCP<const
   verbose(false),
   minElementRadius(1.0e50),
   maxElementRadius(0.0),
+  parallelRead(false),
   storeExodusMesh(false),
   constructInterfaces(false),
   computeIntersections(false),
@@ -81,12 +86,17 @@ PeridigmNS::ExodusDiscretization::ExodusDiscretization(const Teuchos::RCP<const
   myPID(epetra_comm->MyPID()),
   numPID(epetra_comm->NumProc()),
   bondFilterCommand("None"),
+  searchTreeType("Zoltan"),
   comm(epetra_comm)
 {
   TEUCHOS_TEST_FOR_EXCEPT_MSG(params->get<string>("Type") != "Exodus", "Invalid Type in ExodusDiscretization");
 
   if(params->isParameter("Omit Bonds Between Blocks"))
     bondFilterCommand = params->get<string>("Omit Bonds Between Blocks");
+  if(params->isParameter("Search Tree"))
+    searchTreeType = params->get<string>("Search Tree");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(searchTreeType != "Zoltan" && searchTreeType != "JAM" && searchTreeType != "Cell List",
+                              "**** Error, unrecognized value for \"Search Tree\", valid options are \"Zoltan\", \"JAM\", and \"Cell List\".\n");
   string meshFileName = params->get<string>("Input Mesh File");
 
   if(params->isParameter("Verbose")){
@@ -107,11 +117,27 @@ PeridigmNS::ExodusDiscretization::ExodusDiscretization(const Teuchos::RCP<const
     storeExodusMesh = constructInterfaces;
   }
 
+  // Read a single genesis file in parallel instead of a pre-decomposed set of files
+  if(params->isParameter("Parallel Read")){
+    parallelRead = params->get<bool>("Parallel Read");
+  }
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(parallelRead && storeExodusMesh,
+                              "**** Error, \"Parallel Read\" is not compatible with storing the Exodus mesh (element-horizon intersections, interfaces).\n");
+
   // Set up bond filters
   createBondFilters(params);
 
+  // Optional on-disk cache for the results of the neighbor search
+  setNeighborhoodCache(params);
+
+  // Optional bond-count weighting of the load balance used with "Parallel Read"
+  setLoadBalanceWeighting(params);
+
   // Load data from mesh file
-  loadData(meshFileName);
+  if(parallelRead && numPID != 1)
+    loadDataInParallel(meshFileName);
+  else
+    loadData(meshFileName);
   
   if(computeIntersections)
     maxElementDimension = computeMaxElementDimension();
@@ -128,30 +154,29 @@ PeridigmNS::ExodusDiscretization::ExodusDiscretization(const Teuchos::RCP<const
     if(hasConstantHorizon)
       constantHorizonValue = horizonManager.getBlockConstantHorizonValue(blockName);
 
-    for(unsigned int i=0 ; i<globalIds.size() ; ++i){
-      int localId = oneDimensionalMap->LID(globalIds[i]);
-      if(hasConstantHorizon){
-        (*horizonForEachPoint)[localId] = constantHorizonValue;
-      }
-      else{
-        double x = (*initialX)[localId*3];
-        double y = (*initialX)[localId*3 + 1];
-        double z = (*initialX)[localId*3 + 2];
-        double horizon = horizonManager.evaluateHorizon(blockName, x, y, z);
-        (*horizonForEachPoint)[localId] = horizon;
-      }
+    vector<int> localIds(globalIds.size());
+    for(unsigned int i=0 ; i<globalIds.size() ; ++i)
+      localIds[i] = oneDimensionalMap->LID(globalIds[i]);
+
+    if(hasConstantHorizon){
+      for(unsigned int i=0 ; i<localIds.size() ; ++i)
+        (*horizonForEachPoint)[localIds[i]] = constantHorizonValue;
+    }
+    else{
+      horizonManager.evaluateHorizon(blockName, localIds, initialX->Values(), horizonForEachPoint->Values());
     }
   }
 
   int neighborListSize;
   int* neighborList;
 
-  // Execute the neighbor search
+  // Execute the neighbor search, or load its results from the neighborhood cache
   // When computing element-horizon intersections, the search is expanded by the maximum element dimension
-  if(computeIntersections)
-    ProximitySearch::GlobalProximitySearch(initialX, horizonForEachPoint, oneDimensionalOverlapMap, neighborListSize, neighborList, bondFilters, maxElementDimension);
-  else
-    ProximitySearch::GlobalProximitySearch(initialX, horizonForEachPoint, oneDimensionalOverlapMap, neighborListSize, neighborList, bondFilters);
+  double radiusAddition = computeIntersections ? maxElementDimension : 0.0;
+  if(!readNeighborhoodCache(initialX, horizonForEachPoint, radiusAddition, oneDimensionalOverlapMap, neighborListSize, neighborList)){
+    ProximitySearch::GlobalProximitySearch(initialX, horizonForEachPoint, oneDimensionalOverlapMap, neighborListSize, neighborList, bondFilters, radiusAddition, searchTreeType);
+    writeNeighborhoodCache(initialX, horizonForEachPoint, radiusAddition, oneDimensionalOverlapMap, neighborListSize, neighborList);
+  }
 
   // Ghost exodus data so that element-horizon intersections can be calculated for ghosted neighbors
   if(storeExodusMesh)
@@ -614,6 +639,348 @@ void PeridigmNS::ExodusDiscretization::loadData(const string& meshFileName)
   if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadData()", "ex_close");
 }
 
+void PeridigmNS::ExodusDiscretization::loadDataInParallel(const string& meshFileName)
+{
+  // Every processor opens the same (serial) genesis file
+  int compWordSize = sizeof(double);
+  int ioWordSize = 0;
+  float exodusVersion;
+  int exodusFileId = ex_open(meshFileName.c_str(), EX_READ, &compWordSize, &ioWordSize, &exodusVersion);
+  if(exodusFileId < 0){
+    cout << "\n****Error on processor " << myPID << ": unable to open file " << meshFileName.c_str() << "\n" << endl;
+    reportExodusError(exodusFileId, "ExodusDiscretization::loadDataInParallel()", "ex_open");
+  }
+
+  // Read the initialization parameters
+  int numDim, numNodes, numElem, numElemBlocks, numNodeSets, numSideSets;
+  char title[MAX_LINE_LENGTH];
+  int retval = ex_get_init(exodusFileId, title, &numDim, &numNodes, &numElem, &numElemBlocks, &numNodeSets, &numSideSets);
+  if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadDataInParallel()", "ex_get_init");
+
+  // Each processor reads a contiguous slab of elements
+  int slabSize = numElem / numPID;
+  int remainder = numElem % numPID;
+  int myNumElem = slabSize + (static_cast<int>(myPID) < remainder ? 1 : 0);
+  int myFirstElem = static_cast<int>(myPID)*slabSize + std::min(static_cast<int>(myPID), remainder); // 0-based index into the file
+
+  // Global element numbering for the slab
+  vector<int> elemIdMap(myNumElem);
+  if(myNumElem > 0){
+    retval = ex_get_partial_id_map(exodusFileId, EX_ELEM_MAP, myFirstElem + 1, myNumElem, &elemIdMap[0]);
+    if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadDataInParallel()", "ex_get_partial_id_map");
+  }
+  for(int i=0 ; i<myNumElem ; ++i)
+    elemIdMap[i] -= 1; // Note the switch from 1-based indexing to 0-based indexing
+
+  // Honor an "original_global_id_map", as in loadData()
+  int numNodeMaps, numElemMaps;
+  retval = ex_get_map_param(exodusFileId, &numNodeMaps, &numElemMaps);
+  if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadDataInParallel()", "ex_get_map_param");
+  if(numElemMaps > 0){
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(numElemMaps > 1,
+                                "**** Error in ExodusDiscretization::loadDataInParallel(), genesis file contains invalid number of auxiliary element maps (>1).\n");
+    char mapName[MAX_STR_LENGTH];
+    retval = ex_get_name(exodusFileId, EX_ELEM_MAP, 1, mapName);
+    if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadDataInParallel()", "ex_get_name");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(string(mapName) != string("original_global_id_map"),
+                                "**** Error in ExodusDiscretization::loadDataInParallel(), unknown exodus EX_ELEM_MAP: " + string(mapName) + ".\n");
+    if(myNumElem > 0){
+      retval = ex_get_partial_num_map(exodusFileId, EX_ELEM_MAP, 1, myFirstElem + 1, myNumElem, &elemIdMap[0]);
+      if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadDataInParallel()", "ex_get_partial_num_map");
+    }
+    for(int i=0 ; i<myNumElem ; ++i)
+      elemIdMap[i] -= 1; // Note the switch from 1-based indexing to 0-based indexing
+  }
+
+  // Read the block headers and the connectivity for the portion of each block that falls in the slab
+  vector<int> elemBlockIds(numElemBlocks);
+  retval = ex_get_elem_blk_ids(exodusFileId, &elemBlockIds[0]);
+  if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadDataInParallel()", "ex_get_elem_blk_ids");
+
+  vector<string> elemBlockNames(numElemBlocks);
+  vector<ExodusElementType> slabElemType(myNumElem, UNKNOWN_ELEMENT);
+  vector<int> slabElemBlockIndex(myNumElem);
+  vector<int> slabConnPtr(myNumElem + 1, 0);
+  vector<int> slabConn;
+  vector<double> slabSphereVolume(myNumElem, 0.0);
+  bool tenNodedTetWarningGiven(false), twentyNodedHexWarningGiven(false);
+  int blockFirstElem(0);
+  for(int iElemBlock=0 ; iElemBlock<numElemBlocks ; iElemBlock++){
+
+    int elemBlockId = elemBlockIds[iElemBlock];
+
+    // Get the block name, if there is one
+    char exodusElemBlockName[MAX_STR_LENGTH];
+    retval = ex_get_name(exodusFileId, EX_ELEM_BLOCK, elemBlockId, exodusElemBlockName);
+    if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadDataInParallel()", "ex_get_name");
+    string elemBlockName(exodusElemBlockName);
+    if(elemBlockName.size() == 0){
+      stringstream ss;
+      ss << "block_" << elemBlockId;
+      elemBlockName = ss.str();
+    }
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(elementBlocks->find(elemBlockName) != elementBlocks->end(), "**** Duplicate block found: " + elemBlockName + "\n");
+    // Every processor is aware of every block, whether or not it owns elements in it
+    (*elementBlocks)[elemBlockName] = vector<int>();
+    elemBlockNames[iElemBlock] = elemBlockName;
+
+    char elemType[MAX_STR_LENGTH];
+    int numElemThisBlock, numNodesPerElem, numAttributes;
+    retval = ex_get_elem_block(exodusFileId, elemBlockId, elemType, &numElemThisBlock, &numNodesPerElem, &numAttributes);
+    if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadDataInParallel()", "ex_get_elem_block");
+
+    // Intersection of this block with the slab
+    int first = std::max(blockFirstElem, myFirstElem);
+    int last = std::min(blockFirstElem + numElemThisBlock, myFirstElem + myNumElem);
+    blockFirstElem += numElemThisBlock;
+    if(last <= first)
+      continue;
+    int numInSlab = last - first;
+    int startInBlock = first - (blockFirstElem - numElemThisBlock); // 0-based index within the block
+
+    ExodusElementType exodusElementType(UNKNOWN_ELEMENT);
+    string elemTypeString(elemType);
+    boost::to_upper(elemTypeString);
+    if(elemTypeString == string("SPHERE"))
+      exodusElementType = SPHERE_ELEMENT;
+    else if(elemTypeString == string("TET") || elemTypeString == string("TETRA") || elemTypeString == string("TET4") || elemTypeString == string("TET10"))
+      exodusElementType = TET_ELEMENT;
+    else if(elemTypeString == string("HEX") || elemTypeString == string("HEX8") || elemTypeString == string("HEX20"))
+      exodusElementType = HEX_ELEMENT;
+    else{
+      string msg = "\n**** Error in loadDataInParallel(), unknown element type " + elemTypeString + ".\n";
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(true, msg);
+    }
+    if(exodusElementType == TET_ELEMENT && numNodesPerElem == 10 && !tenNodedTetWarningGiven){
+      cout << "**** Warning on processor " << myPID
+           << ", side nodes being discarded for 10-node tetrahedron element, will be treated as 4-node tetrahedron element." << endl;
+      tenNodedTetWarningGiven = true;
+    }
+    if(exodusElementType == HEX_ELEMENT && numNodesPerElem == 20 && !twentyNodedHexWarningGiven){
+      cout << "**** Warning on processor " << myPID
+           << ", side nodes being discarded for 20-node hexahedron element, will be treated as 8-node hexahedron element." << endl;
+      twentyNodedHexWarningGiven = true;
+    }
+
+    vector<int> conn(numInSlab*numNodesPerElem);
+    retval = ex_get_partial_conn(exodusFileId, EX_ELEM_BLOCK, elemBlockId, startInBlock + 1, numInSlab, &conn[0], 0, 0);
+    if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadDataInParallel()", "ex_get_partial_conn");
+    vector<double> attributes;
+    if(exodusElementType == SPHERE_ELEMENT){
+      attributes.resize(numInSlab*numAttributes);
+      retval = ex_get_partial_attr(exodusFileId, EX_ELEM_BLOCK, elemBlockId, startInBlock + 1, numInSlab, &attributes[0]);
+      if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadDataInParallel()", "ex_get_partial_attr");
+    }
+
+    for(int iElem=0 ; iElem<numInSlab ; ++iElem){
+      int slabId = first - myFirstElem + iElem;
+      slabElemType[slabId] = exodusElementType;
+      slabElemBlockIndex[slabId] = iElemBlock;
+      slabConnPtr[slabId + 1] = slabConnPtr[slabId] + numNodesPerElem;
+      for(int i=0 ; i<numNodesPerElem ; ++i)
+        slabConn.push_back(conn[iElem*numNodesPerElem + i] - 1); // Note the switch from 1-based indexing to 0-based indexing
+      if(exodusElementType == SPHERE_ELEMENT)
+        slabSphereVolume[slabId] = attributes[iElem*numAttributes + 1];
+    }
+  }
+
+  // Read the coordinates of the nodes referenced by the slab
+  // The sorted node ids are grouped into ranges, nodes separated by a short gap share a range to limit the number of reads,
+  // and ranges are capped in length to bound the read buffer
+  vector<int> slabNodes(slabConn);
+  std::sort(slabNodes.begin(), slabNodes.end());
+  slabNodes.erase(std::unique(slabNodes.begin(), slabNodes.end()), slabNodes.end());
+  int numSlabNodes = static_cast<int>(slabNodes.size());
+  const int maxCoordinateReadGap = 256;
+  const int maxCoordinateReadLength = 65536;
+  vector<double> exodusNodeCoordX(numSlabNodes), exodusNodeCoordY(numSlabNodes), exodusNodeCoordZ(numSlabNodes);
+  vector<double> rangeX, rangeY, rangeZ;
+  for(int first=0 ; first<numSlabNodes ; ){
+    int last = first;
+    while(last + 1 < numSlabNodes &&
+          slabNodes[last + 1] - slabNodes[last] <= maxCoordinateReadGap &&
+          slabNodes[last + 1] - slabNodes[first] < maxCoordinateReadLength)
+      last++;
+    int rangeLength = slabNodes[last] - slabNodes[first] + 1;
+    rangeX.resize(rangeLength);
+    rangeY.resize(rangeLength);
+    rangeZ.resize(rangeLength);
+    retval = ex_get_partial_coord(exodusFileId, slabNodes[first] + 1, rangeLength, &rangeX[0], &rangeY[0], &rangeZ[0]);
+    if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadDataInParallel()", "ex_get_partial_coord");
+    for(int i=first ; i<=last ; ++i){
+      int offset = slabNodes[i] - slabNodes[first];
+      exodusNodeCoordX[i] = rangeX[offset];
+      exodusNodeCoordY[i] = rangeY[offset];
+      exodusNodeCoordZ[i] = rangeZ[offset];
+    }
+    first = last + 1;
+  }
+
+  // Replace the exodus node ids in the slab connectivity with indices into slabNodes
+  for(unsigned int i=0 ; i<slabConn.size() ; ++i)
+    slabConn[i] = static_cast<int>(std::lower_bound(slabNodes.begin(), slabNodes.end(), slabConn[i]) - slabNodes.begin());
+
+  // Convert the slab elements to spheres
+  int dimension = 3;
+  QUICKGRID::Data decomp = QUICKGRID::allocatePdGridData(myNumElem, dimension);
+  decomp.globalNumPoints = numElem;
+  if(myNumElem > 0)
+    memcpy(decomp.myGlobalIDs.get(), &elemIdMap[0], myNumElem*sizeof(int));
+  double* slabX = decomp.myX.get();
+  double* slabVolume = decomp.cellVolume.get();
+  vector<double> nodeCoordinates;
+  for(int iElem=0 ; iElem<myNumElem ; ++iElem){
+    int numNodesPerElem = slabConnPtr[iElem + 1] - slabConnPtr[iElem];
+    nodeCoordinates.resize(3*numNodesPerElem);
+    for(int i=0 ; i<numNodesPerElem ; ++i){
+      int nodeId = slabConn[slabConnPtr[iElem] + i];
+      nodeCoordinates[3*i] = exodusNodeCoordX[nodeId];
+      nodeCoordinates[3*i+1] = exodusNodeCoordY[nodeId];
+      nodeCoordinates[3*i+2] = exodusNodeCoordZ[nodeId];
+    }
+    if(slabElemType[iElem] == SPHERE_ELEMENT){
+      slabX[3*iElem]   = nodeCoordinates[0];
+      slabX[3*iElem+1] = nodeCoordinates[1];
+      slabX[3*iElem+2] = nodeCoordinates[2];
+      slabVolume[iElem] = slabSphereVolume[iElem];
+    }
+    else if(slabElemType[iElem] == TET_ELEMENT)
+      tetCentroidAndVolume(&nodeCoordinates[0], &slabX[3*iElem], &slabVolume[iElem]);
+    else if(slabElemType[iElem] == HEX_ELEMENT)
+      hexCentroidAndVolume(&nodeCoordinates[0], &slabX[3*iElem], &slabVolume[iElem]);
+  }
+
+  // Block ids and node set membership in the slab (pre-load-balance) configuration
+  Epetra_BlockMap slabMap(numElem, myNumElem, decomp.myGlobalIDs.get(), 1, 0, *comm);
+  Epetra_Vector slabBlockID(slabMap);
+  for(int iElem=0 ; iElem<myNumElem ; ++iElem)
+    slabBlockID[iElem] = elemBlockIds[slabElemBlockIndex[iElem]];
+
+  nodeSets = Teuchos::rcp< map<string, vector<int> > >(new map<string, vector<int> >() );
+  nodeSetIds = Teuchos::rcp< map<string, int> >(new map<string, int>() );
+  map<string, Teuchos::RCP<Epetra_Vector> > slabNodeSetFlags;
+  if(numNodeSets > 0){
+    // Each processor reads a contiguous portion of each node set, the node set membership is exported to a linear
+    // distribution of the exodus nodes and then imported by the processors whose slab references the nodes
+    Epetra_Map linearNodeMap(numNodes, 0, *comm);
+    Epetra_Map slabNodeMap(-1, numSlabNodes, numSlabNodes > 0 ? &slabNodes[0] : 0, 0, *comm);
+    Epetra_Import slabNodeImporter(slabNodeMap, linearNodeMap);
+    Epetra_Vector linearNodeFlags(linearNodeMap);
+    Epetra_Vector slabNodeFlags(slabNodeMap);
+
+    vector<int> exodusNodeSetIds(numNodeSets);
+    retval = ex_get_node_set_ids(exodusFileId, &exodusNodeSetIds[0]);
+    if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadDataInParallel()", "ex_get_node_set_ids");
+    for(int i=0 ; i<numNodeSets ; ++i){
+      int nodeSetId = exodusNodeSetIds[i];
+      char exodusNodeSetName[MAX_STR_LENGTH];
+      retval = ex_get_name(exodusFileId, EX_NODE_SET, nodeSetId, exodusNodeSetName);
+      if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadDataInParallel()", "ex_get_name");
+      string nodeSetName(exodusNodeSetName);
+      if(nodeSetName.size() == 0){
+        stringstream ss;
+        ss << "nodelist_" << nodeSetId;
+        nodeSetName = ss.str();
+      }
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(nodeSets->find(nodeSetName) != nodeSets->end(), "**** Duplicate node set found: " + nodeSetName + "\n");
+      (*nodeSets)[nodeSetName] = vector<int>();
+      (*nodeSetIds)[nodeSetName] = nodeSetId;
+
+      int numNodesInSet, numDistributionFactorsInSet;
+      retval = ex_get_node_set_param(exodusFileId, nodeSetId, &numNodesInSet, &numDistributionFactorsInSet);
+      if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadDataInParallel()", "ex_get_node_set_param");
+      int nodeSetSlabSize = numNodesInSet / numPID;
+      int nodeSetRemainder = numNodesInSet % numPID;
+      int myNumNodesInSet = nodeSetSlabSize + (static_cast<int>(myPID) < nodeSetRemainder ? 1 : 0);
+      int myFirstNodeInSet = static_cast<int>(myPID)*nodeSetSlabSize + std::min(static_cast<int>(myPID), nodeSetRemainder);
+      vector<int> nodeSetNodeList(myNumNodesInSet);
+      if(myNumNodesInSet > 0){
+        retval = ex_get_partial_node_set(exodusFileId, nodeSetId, myFirstNodeInSet + 1, myNumNodesInSet, &nodeSetNodeList[0]);
+        if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadDataInParallel()", "ex_get_partial_node_set");
+      }
+      for(int j=0 ; j<myNumNodesInSet ; ++j)
+        nodeSetNodeList[j] -= 1; // Note the switch from 1-based indexing to 0-based indexing
+      std::sort(nodeSetNodeList.begin(), nodeSetNodeList.end());
+      nodeSetNodeList.erase(std::unique(nodeSetNodeList.begin(), nodeSetNodeList.end()), nodeSetNodeList.end());
+
+      Epetra_Map nodeSetPortionMap(-1, static_cast<int>(nodeSetNodeList.size()), nodeSetNodeList.size() > 0 ? &nodeSetNodeList[0] : 0, 0, *comm);
+      Epetra_Vector nodeSetPortionFlags(nodeSetPortionMap);
+      nodeSetPortionFlags.PutScalar(1.0);
+      Epetra_Export nodeSetExporter(nodeSetPortionMap, linearNodeMap);
+      linearNodeFlags.PutScalar(0.0);
+      linearNodeFlags.Export(nodeSetPortionFlags, nodeSetExporter, Add);
+      slabNodeFlags.Import(linearNodeFlags, slabNodeImporter, Insert);
+
+      // An element belongs to the node set if any of its nodes are in the exodus node set
+      Teuchos::RCP<Epetra_Vector> flags = Teuchos::rcp(new Epetra_Vector(slabMap));
+      for(int iElem=0 ; iElem<myNumElem ; ++iElem){
+        for(int j=slabConnPtr[iElem] ; j<slabConnPtr[iElem + 1] ; ++j){
+          if(slabNodeFlags[slabConn[j]] != 0.0){
+            (*flags)[iElem] = 1.0;
+            break;
+          }
+        }
+      }
+      slabNodeSetFlags[nodeSetName] = flags;
+    }
+  }
+
+  // Close the genesis file
+  retval = ex_close(exodusFileId);
+  if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadDataInParallel()", "ex_close");
+
+  // Redistribute the elements with the PdZoltan RCB load balancer
+  vector<string> pointBlockNames(myNumElem);
+  for(int iElem=0 ; iElem<myNumElem ; ++iElem)
+    pointBlockNames[iElem] = elemBlockNames[slabElemBlockIndex[iElem]];
+  vector<double> bondCounts;
+  if(weightedLoadBalance)
+    bondCounts = estimatedBondCounts(decomp, pointBlockNames);
+  loadBalance(decomp, bondCounts, pointBlockNames);
+
+  // Create the owned maps
+  oneDimensionalMap = Teuchos::rcp(new Epetra_BlockMap(numElem, decomp.numPoints, decomp.myGlobalIDs.get(), 1, 0, *comm));
+  threeDimensionalMap = Teuchos::rcp(new Epetra_BlockMap(numElem, decomp.numPoints, decomp.myGlobalIDs.get(), 3, 0, *comm));
+
+  // Initial positions and volumes travel with the decomp, block ids and node sets are imported
+  initialX = Teuchos::rcp(new Epetra_Vector(Copy, *threeDimensionalMap, decomp.myX.get()));
+  cellVolume = Teuchos::rcp(new Epetra_Vector(Copy, *oneDimensionalMap, decomp.cellVolume.get()));
+  blockID = Teuchos::rcp(new Epetra_Vector(*oneDimensionalMap));
+  Epetra_Import importer(*oneDimensionalMap, slabMap);
+  blockID->Import(slabBlockID, importer, Insert);
+
+  map<int, string> blockIdToName;
+  for(int iElemBlock=0 ; iElemBlock<numElemBlocks ; ++iElemBlock)
+    blockIdToName[elemBlockIds[iElemBlock]] = elemBlockNames[iElemBlock];
+  for(int i=0 ; i<blockID->MyLength() ; ++i){
+    int globalElemId = oneDimensionalMap->GID(i);
+    (*elementBlocks)[blockIdToName[static_cast<int>((*blockID)[i])]].push_back(globalElemId);
+  }
+
+  Epetra_Vector nodeSetFlags(*oneDimensionalMap);
+  for(map<string, Teuchos::RCP<Epetra_Vector> >::iterator it = slabNodeSetFlags.begin() ; it != slabNodeSetFlags.end() ; it++){
+    nodeSetFlags.Import(*(it->second), importer, Insert);
+    vector<int>& nodeSet = (*nodeSets)[it->first];
+    for(int i=0 ; i<nodeSetFlags.MyLength() ; ++i){
+      if(nodeSetFlags[i] != 0.0)
+        nodeSet.push_back(oneDimensionalMap->GID(i));
+    }
+  }
+
+  if(verbose && myPID == 0){
+    stringstream ss;
+    ss << "\nGenesis file " << meshFileName << " (parallel read)" << endl;
+    ss << "  title " << title << endl;
+    ss << "  number of dimensions " << numDim << endl;
+    ss << "  number of nodes " << numNodes << endl;
+    ss << "  number of elements " << numElem << endl;
+    ss << "  number of blocks " << numElemBlocks << endl;
+    ss << "  number of node sets " << numNodeSets << endl;
+    ss << "  number of side sets (ignored) " << numSideSets << endl;
+    cout << ss.str() << endl;
+  }
+}
+
 void
 PeridigmNS::ExodusDiscretization::constructInterfaceData()
 {
@@ -136,6 +136,9 @@ namespace PeridigmNS {
     //! Loads mesh data into Epetra_Vectors (initial positions, volumes, block ids) and stores original Exodus node locations and connectivity.
     void loadData(const std::string& meshFileName);
 
+    //! Reads a contiguous slab of a single (serial) genesis file on each processor, then load balances with PdZoltan RCB.
+    void loadDataInParallel(const std::string& meshFileName);
+
   protected:
 
     template<class T>
@@ -197,6 +200,9 @@ namespace PeridigmNS {
     //! Vector containing the block ID of each element
     Teuchos::RCP<Epetra_Vector> blockID;
 
+    //! Boolean flag for reading a single genesis file in parallel
+    bool parallelRead;
+
     //! Boolean flag for storing exodus mesh
     bool storeExodusMesh;
 
@@ -236,6 +242,9 @@ namespace PeridigmNS {
     //! Discretization parameter controling the formation of bonds
     std::string bondFilterCommand;
 
+    //! Search tree used for the neighbor search ("Zoltan", "JAM", or "Cell List")
+    std::string searchTreeType;
+
     //! Epetra communicator
     Teuchos::RCP<const Epetra_Comm> comm;
   };
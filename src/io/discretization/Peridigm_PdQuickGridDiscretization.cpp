@@ -70,6 +70,11 @@ PeridigmNS::PdQuickGridDiscretization::PdQuickGridDiscretization(const Teuchos::
 
   TEUCHOS_TEST_FOR_EXCEPT_MSG(params->isSublist("Bond Filters"), "**** Error: Bond filters not supported for PdQuickGrid discretizations.\n");
 
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(params->isParameter("Neighborhood Cache File"), "**** Error: Neighborhood cache not supported for PdQuickGrid discretizations.\n");
+
+  // Optional bond-count weighting of the initial load balance
+  setLoadBalanceWeighting(params);
+
   QUICKGRID::Data decomp = getDiscretization(params);
 
   createMaps(decomp);
@@ -193,6 +198,18 @@ PeridigmNS::PdQuickGridDiscretization::PdQuickGridDiscretization(const Teuchos::
 
 PeridigmNS::PdQuickGridDiscretization::~PdQuickGridDiscretization() {}
 
+namespace {
+  //! Number of bonds for each point, taken from the neighborhoods generated by QuickGrid.
+  std::vector<double> neighborhoodBondCounts(const QUICKGRID::Data& decomp){
+    std::vector<double> bondCounts(decomp.numPoints);
+    const int* neighborhood = decomp.neighborhood.get();
+    const int* neighborhoodPtr = decomp.neighborhoodPtr.get();
+    for(size_t i=0 ; i<decomp.numPoints ; ++i)
+      bondCounts[i] = neighborhood[neighborhoodPtr[i]];
+    return bondCounts;
+  }
+}
+
 QUICKGRID::Data PeridigmNS::PdQuickGridDiscretization::getDiscretization(const Teuchos::RCP<Teuchos::ParameterList>& params) {
 
   // This is the type of norm used to create neighborhood lists
@@ -233,7 +250,7 @@ QUICKGRID::Data PeridigmNS::PdQuickGridDiscretization::getDiscretization(const T
     decomp =  QUICKGRID::getDiscretization(myPID, cellPerProcIter);
     // Load balance and write new decomposition
 #ifdef HAVE_MPI
-    decomp = PDNEIGH::getLoadBalancedDiscretization(decomp);
+    loadBalance(decomp, neighborhoodBondCounts(decomp), std::vector<std::string>(decomp.numPoints, blockName));
 #endif
       
     minElementRadius = pow(0.238732414637843*(xLength/nx)*(yLength/ny)*(zLength/nz), 0.33333333333333333);
@@ -274,7 +291,7 @@ QUICKGRID::Data PeridigmNS::PdQuickGridDiscretization::getDiscretization(const T
     decomp =  QUICKGRID::getDiscretization(myPID, cellPerProcIter);
     // Load balance and write new decomposition
 #ifdef HAVE_MPI
-    decomp = PDNEIGH::getLoadBalancedDiscretization(decomp);
+    loadBalance(decomp, neighborhoodBondCounts(decomp), std::vector<std::string>(decomp.numPoints, blockName));
 #endif
 
 //     minElementRadius = pow(0.238732414637843*(xLength/nx)*(yLength/ny)*(zLength/nz), 0.33333333333333333);
@@ -76,6 +76,7 @@ PeridigmNS::TextFileDiscretization::TextFileDiscretization(const Teuchos::RCP<co
   myPID(epetra_comm->MyPID()),
   numPID(epetra_comm->NumProc()),
   bondFilterCommand("None"),
+  searchTreeType("Zoltan"),
   comm(epetra_comm)
 {
   TEUCHOS_TEST_FOR_EXCEPT_MSG(params->get<string>("Type") != "Text File", "Invalid Type in TextFileDiscretization");
@@ -83,10 +84,19 @@ PeridigmNS::TextFileDiscretization::TextFileDiscretization(const Teuchos::RCP<co
   string meshFileName = params->get<string>("Input Mesh File");
   if(params->isParameter("Omit Bonds Between Blocks"))
     bondFilterCommand = params->get<string>("Omit Bonds Between Blocks");
+  if(params->isParameter("Search Tree"))
+    searchTreeType = params->get<string>("Search Tree");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(searchTreeType != "Zoltan" && searchTreeType != "JAM" && searchTreeType != "Cell List",
+                              "**** Error, unrecognized value for \"Search Tree\", valid options are \"Zoltan\", \"JAM\", and \"Cell List\".\n");
+
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(params->isParameter("Neighborhood Cache File"), "**** Error: Neighborhood cache not supported for Text File discretizations.\n");
 
   // Set up bond filters
   createBondFilters(params);
 
+  // Optional bond-count weighting of the initial load balance
+  setLoadBalanceWeighting(params);
+
   QUICKGRID::Data decomp = getDecomp(meshFileName, params);
 
   // \todo Refactor; the createMaps() call is currently inside getDecomp() due to order-of-operations issues with tracking element blocks.
@@ -252,7 +262,16 @@ QUICKGRID::Data PeridigmNS::TextFileDiscretization::getDecomp(const string& text
     tempBlockIDPtr[i] = blockIds[i];
 
   // call the rebalance function on the current-configuration decomp
-  decomp = PDNEIGH::getLoadBalancedDiscretization(decomp);
+  vector<string> pointBlockNames(numElements);
+  for(int i=0 ; i<numElements ; ++i){
+    stringstream blockName;
+    blockName << "block_" << blockIds[i];
+    pointBlockNames[i] = blockName.str();
+  }
+  vector<double> bondCounts;
+  if(weightedLoadBalance)
+    bondCounts = estimatedBondCounts(decomp, pointBlockNames);
+  loadBalance(decomp, bondCounts, pointBlockNames);
 
   // create a (throw-away) one-dimensional owned map in the rebalanced configuration
   Epetra_BlockMap rebalancedMap(decomp.globalNumPoints, decomp.numPoints, decomp.myGlobalIDs.get(), 1, 0, *comm);
@@ -293,30 +312,24 @@ QUICKGRID::Data PeridigmNS::TextFileDiscretization::getDecomp(const string& text
     if(hasConstantHorizon)
       constantHorizonValue = horizonManager.getBlockConstantHorizonValue(blockName);
 
-    for(unsigned int i=0 ; i<globalIds.size() ; ++i){
-      int localId = rebalancedMap.LID(globalIds[i]);
-      if(hasConstantHorizon){
-        (*rebalancedHorizonForEachPoint)[localId] = constantHorizonValue;
-      }
-      else{
-        double x = rebalancedX[localId*3];
-        double y = rebalancedX[localId*3 + 1];
-        double z = rebalancedX[localId*3 + 2];
-        double horizon = horizonManager.evaluateHorizon(blockName, x, y, z);
-        (*rebalancedHorizonForEachPoint)[localId] = horizon;
-      }
+    vector<int> localIds(globalIds.size());
+    for(unsigned int i=0 ; i<globalIds.size() ; ++i)
+      localIds[i] = rebalancedMap.LID(globalIds[i]);
+
+    if(hasConstantHorizon){
+      for(unsigned int i=0 ; i<localIds.size() ; ++i)
+        (*rebalancedHorizonForEachPoint)[localIds[i]] = constantHorizonValue;
+    }
+    else{
+      horizonManager.evaluateHorizon(blockName, localIds, rebalancedX, rebalancedHorizonForEachPoint->Values());
     }
   }
 
   // execute neighbor search and update the decomp to include resulting ghosts
   std::tr1::shared_ptr<const Epetra_Comm> commSp(comm.getRawPtr(), NonDeleter<const Epetra_Comm>());
+  // An empty list of bond filters results in the default filter
   Teuchos::RCP<PDNEIGH::NeighborhoodList> list;
-  if(bondFilters.size() == 0){
-    list = Teuchos::rcp(new PDNEIGH::NeighborhoodList(commSp,decomp.zoltanPtr.get(),decomp.numPoints,decomp.myGlobalIDs,decomp.myX,rebalancedHorizonForEachPoint));
-  }
-  else{
-    list = Teuchos::rcp(new PDNEIGH::NeighborhoodList(commSp,decomp.zoltanPtr.get(),decomp.numPoints,decomp.myGlobalIDs,decomp.myX,rebalancedHorizonForEachPoint,bondFilters));
-  }
+  list = Teuchos::rcp(new PDNEIGH::NeighborhoodList(commSp,decomp.zoltanPtr.get(),decomp.numPoints,decomp.myGlobalIDs,decomp.myX,rebalancedHorizonForEachPoint,bondFilters,searchTreeType));
   decomp.neighborhood=list->get_neighborhood();
   decomp.sizeNeighborhoodList=list->get_size_neighborhood_list();
   decomp.neighborhoodPtr=list->get_neighborhood_ptr();
@@ -192,6 +192,9 @@ namespace PeridigmNS {
     //! Discretization parameter controling the formation of bonds
     std::string bondFilterCommand;
 
+    //! Search tree used for the neighbor search ("Zoltan", "JAM", or "Cell List")
+    std::string searchTreeType;
+
     //! Epetra communicator
     Teuchos::RCP<const Epetra_Comm> comm;
   };
@@ -0,0 +1,260 @@
+/*! \file utPeridigm_NeighborhoodCache.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_GlobalMPISession.hpp"
+#include <vector>
+#include <string>
+#include <sstream>
+#include <fstream>
+#include <cstdio>
+
+#include <Epetra_ConfigDefs.h> // used to define HAVE_MPI
+#ifdef HAVE_MPI
+  #include <Epetra_MpiComm.h>
+#else
+  #include <Epetra_SerialComm.h>
+#endif
+#include "Peridigm_ExodusDiscretization.hpp"
+#include "Peridigm_HorizonManager.hpp"
+
+using namespace Teuchos;
+using namespace PeridigmNS;
+using namespace std;
+
+//! Exodus discretization that exposes the neighborhood cache routines.
+class CacheTestDiscretization : public ExodusDiscretization {
+
+public:
+
+  CacheTestDiscretization(const RCP<const Epetra_Comm>& epetraComm,
+                          const RCP<ParameterList>& params)
+    : ExodusDiscretization(epetraComm, params) {}
+
+  //! Read the cache for the current positions and horizons
+  bool readCache(double radiusAddition, RCP<Epetra_BlockMap>& overlapMap, int& neighborListSize, int*& neighborList) const {
+    return readNeighborhoodCache(initialX, horizonForEachPoint, radiusAddition, overlapMap, neighborListSize, neighborList);
+  }
+
+  //! Name of the cache file for this processor
+  string cacheFile() const {
+    return neighborhoodCacheFile(initialX->Map().Comm());
+  }
+};
+
+RCP<const Epetra_Comm> createComm()
+{
+  RCP<const Epetra_Comm> comm;
+  #ifdef HAVE_MPI
+    comm = rcp(new Epetra_MpiComm(MPI_COMM_WORLD));
+  #else
+    comm = rcp(new Epetra_SerialComm);
+  #endif
+  return comm;
+}
+
+//! Parameters for the 2x2x2 mesh with the horizon a tad longer than the mesh spacing, and any stale cache files removed.
+RCP<ParameterList> createParams(const Epetra_Comm& comm, const string& cacheFileName)
+{
+  ParameterList blockParameterList;
+  ParameterList& blockParams = blockParameterList.sublist("My Block");
+  blockParams.set("Block Names", "block_1");
+  blockParams.set("Horizon", 0.501);
+  PeridigmNS::HorizonManager::self().loadHorizonInformationFromBlockParameters(blockParameterList);
+
+  RCP<ParameterList> discParams = rcp(new ParameterList);
+  discParams->set("Type", "Exodus");
+  discParams->set("Input Mesh File", "utPeridigm_ExodusDiscretization_2x2x2.g");
+  discParams->set("Neighborhood Cache File", cacheFileName);
+
+  stringstream ss;
+  ss << cacheFileName << "." << comm.NumProc() << "." << comm.MyPID();
+  std::remove(ss.str().c_str());
+  comm.Barrier();
+
+  return discParams;
+}
+
+//! Replace a byte of the file, counted back from the end of the file.
+void corruptByte(const string& fileName, int offsetFromEnd)
+{
+  fstream file(fileName.c_str(), ios::in | ios::out | ios::binary);
+  file.seekg(-offsetFromEnd, ios::end);
+  char c;
+  file.get(c);
+  file.seekp(-offsetFromEnd, ios::end);
+  file.put(static_cast<char>(c ^ 0x5A));
+  file.close();
+}
+
+bool fileExists(const string& fileName)
+{
+  ifstream file(fileName.c_str());
+  return file.is_open();
+}
+
+//! Check that two discretizations have the same overlap map and neighbor lists.
+void compareNeighborhoods(const CacheTestDiscretization& a, const CacheTestDiscretization& b, Teuchos::FancyOStream& out, bool& success)
+{
+  TEST_ASSERT(a.getGlobalOverlapMap(1)->SameAs(*b.getGlobalOverlapMap(1)));
+  RCP<NeighborhoodData> aData = a.getNeighborhoodData();
+  RCP<NeighborhoodData> bData = b.getNeighborhoodData();
+  TEST_EQUALITY(aData->NumOwnedPoints(), bData->NumOwnedPoints());
+  TEST_EQUALITY(aData->NeighborhoodListSize(), bData->NeighborhoodListSize());
+  if(aData->NumOwnedPoints() == bData->NumOwnedPoints() && aData->NeighborhoodListSize() == bData->NeighborhoodListSize()){
+    for(int i=0 ; i<aData->NumOwnedPoints() ; ++i){
+      TEST_EQUALITY(aData->OwnedIDs()[i], bData->OwnedIDs()[i]);
+      TEST_EQUALITY(aData->NeighborhoodPtr()[i], bData->NeighborhoodPtr()[i]);
+    }
+    for(int i=0 ; i<aData->NeighborhoodListSize() ; ++i)
+      TEST_EQUALITY(aData->NeighborhoodList()[i], bData->NeighborhoodList()[i]);
+  }
+}
+
+TEUCHOS_UNIT_TEST(NeighborhoodCache, RoundTripTest) {
+
+  RCP<const Epetra_Comm> comm = createComm();
+  RCP<ParameterList> discParams = createParams(*comm, "utPeridigm_NeighborhoodCache_RoundTrip");
+
+  // The first discretization performs the neighbor search and writes the cache
+  CacheTestDiscretization searched(comm, discParams);
+  TEST_ASSERT(fileExists(searched.cacheFile()));
+
+  // The cache holds exactly the overlap map and neighbor list of the search
+  RCP<Epetra_BlockMap> overlapMap;
+  int neighborListSize(0);
+  int* neighborList(0);
+  bool hit = searched.readCache(0.0, overlapMap, neighborListSize, neighborList);
+  TEST_ASSERT(hit);
+  if(hit){
+    TEST_ASSERT(overlapMap->SameAs(*searched.getGlobalOverlapMap(1)));
+    RCP<NeighborhoodData> neighborhoodData = searched.getNeighborhoodData();
+    TEST_EQUALITY(neighborListSize, neighborhoodData->NeighborhoodListSize());
+    if(neighborListSize == neighborhoodData->NeighborhoodListSize()){
+      for(int i=0 ; i<neighborListSize ; ++i)
+        TEST_EQUALITY(neighborList[i], neighborhoodData->NeighborhoodList()[i]);
+    }
+    delete[] neighborList;
+  }
+
+  // The second discretization loads the cache and ends up with identical neighborhoods
+  CacheTestDiscretization cached(comm, discParams);
+  compareNeighborhoods(searched, cached, out, success);
+  TEST_EQUALITY(searched.getNumBonds(), cached.getNumBonds());
+}
+
+TEUCHOS_UNIT_TEST(NeighborhoodCache, KeyMismatchTest) {
+
+  RCP<const Epetra_Comm> comm = createComm();
+  RCP<ParameterList> discParams = createParams(*comm, "utPeridigm_NeighborhoodCache_KeyMismatch");
+
+  CacheTestDiscretization searched(comm, discParams);
+
+  // A search radius that differs from the one the cache was written for changes the key
+  RCP<Epetra_BlockMap> overlapMap;
+  int neighborListSize(0);
+  int* neighborList(0);
+  TEST_ASSERT(!searched.readCache(0.1, overlapMap, neighborListSize, neighborList));
+  TEST_ASSERT(overlapMap.is_null());
+
+  // A different horizon changes the key; the discretization searches again and rewrites the cache
+  ParameterList blockParameterList;
+  ParameterList& blockParams = blockParameterList.sublist("My Block");
+  blockParams.set("Block Names", "block_1");
+  blockParams.set("Horizon", 0.751);
+  PeridigmNS::HorizonManager::self().loadHorizonInformationFromBlockParameters(blockParameterList);
+  CacheTestDiscretization largerHorizon(comm, discParams);
+  TEST_ASSERT(largerHorizon.getNumBonds() > searched.getNumBonds());
+
+  // The rewritten cache matches the new horizon but no longer the original one
+  TEST_ASSERT(!searched.readCache(0.0, overlapMap, neighborListSize, neighborList));
+  bool hit = largerHorizon.readCache(0.0, overlapMap, neighborListSize, neighborList);
+  TEST_ASSERT(hit);
+  if(hit)
+    delete[] neighborList;
+}
+
+TEUCHOS_UNIT_TEST(NeighborhoodCache, CorruptedChecksumTest) {
+
+  RCP<const Epetra_Comm> comm = createComm();
+  RCP<ParameterList> discParams = createParams(*comm, "utPeridigm_NeighborhoodCache_Corrupted");
+
+  CacheTestDiscretization searched(comm, discParams);
+  string cacheFile = searched.cacheFile();
+
+  RCP<Epetra_BlockMap> overlapMap;
+  int neighborListSize(0);
+  int* neighborList(0);
+
+  // The trailing 8 bytes hold the checksum; corrupt the last entry of the neighbor list in front of it
+  corruptByte(cacheFile, 9);
+  comm->Barrier();
+  TEST_ASSERT(!searched.readCache(0.0, overlapMap, neighborListSize, neighborList));
+
+  // A corrupted cache is ignored, the neighbor search is repeated, and the cache is rewritten
+  CacheTestDiscretization researched(comm, discParams);
+  compareNeighborhoods(searched, researched, out, success);
+  bool hit = searched.readCache(0.0, overlapMap, neighborListSize, neighborList);
+  TEST_ASSERT(hit);
+  if(hit)
+    delete[] neighborList;
+
+  // Corrupting the checksum itself is also detected
+  corruptByte(cacheFile, 1);
+  comm->Barrier();
+  overlapMap = Teuchos::null;
+  TEST_ASSERT(!searched.readCache(0.0, overlapMap, neighborListSize, neighborList));
+}
+
+int main
+(int argc, char* argv[])
+{
+  Teuchos::GlobalMPISession mpiSession(&argc, &argv);
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
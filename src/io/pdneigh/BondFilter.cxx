@@ -46,6 +46,7 @@
 #include "BondFilter.h"
 #include <cmath>
 #include <float.h>
+#include <algorithm>
 
 using UTILITIES::Vector3D;
 static UTILITIES::Dot dot;
@@ -103,6 +104,23 @@ bool FinitePlane::bondIntersect(double x[3], double tolerance) {
 	return intersects;
 }
 
+void FinitePlane::boundingBox(double min[3], double max[3], double tolerance) const {
+	/*
+	 * Corners of the plane, padded by the tolerance used in bondIntersect and by round-off
+	 */
+	double scale = a + b;
+	for(int i=0;i<3;i++)
+		scale = std::max(scale, std::abs(r0[i]));
+	double pad = tolerance*(1.0+a+b) + 1.0e-12*scale;
+	for(int i=0;i<3;i++){
+		double c0 = r0[i];
+		double c1 = r0[i] + b*ub[i];
+		double c2 = r0[i] + a*ua[i];
+		double c3 = r0[i] + a*ua[i] + b*ub[i];
+		min[i] = std::min(std::min(c0,c1),std::min(c2,c3)) - pad;
+		max[i] = std::max(std::max(c0,c1),std::max(c2,c3)) + pad;
+	}
+}
 
 void BondFilterDefault::filterBonds(std::vector<int>& treeList, const double *pt, const size_t ptLocalId, const double *xOverlap, bool *bondFlags) {
 
@@ -161,4 +179,107 @@ std::tr1::shared_ptr<BondFilter> FinitePlaneFilter::clone(bool withSelf) {
 	return std::tr1::shared_ptr<FinitePlaneFilter>(new FinitePlaneFilter(plane,withSelf,tolerance));
 }
 
+/*
+ * Comparison of filter indices by the center of their boxes along one axis
+ */
+struct BoxCenterLess {
+	BoxCenterLess(const std::vector<double>& boxes, int axis) : boxes(boxes), axis(axis) {}
+	bool operator()(int i, int j) const {
+		return boxes[6*i+axis]+boxes[6*i+3+axis] < boxes[6*j+axis]+boxes[6*j+3+axis];
+	}
+	const std::vector<double>& boxes;
+	int axis;
+};
+
+BondFilterHierarchy::BondFilterHierarchy(const std::vector< std::tr1::shared_ptr<BondFilter> >& filters)
+: excludeSelf(false)
+{
+	/*
+	 * Boxes are stored as (xMin, yMin, zMin, xMax, yMax, zMax) per filter
+	 */
+	std::vector<double> boxes(6*filters.size());
+	std::vector<int> boundedFilters;
+	for(unsigned int f=0;f<filters.size();f++){
+		if(!filters[f]->includesSelf())
+			excludeSelf = true;
+		if(filters[f]->boundingBox(&boxes[6*f], &boxes[6*f+3]))
+			boundedFilters.push_back(f);
+		else
+			unboundedFilters.push_back(f);
+	}
+	if(boundedFilters.size() > 0){
+		nodes.reserve(2*boundedFilters.size());
+		build(boundedFilters, 0, boundedFilters.size(), boxes);
+	}
+}
+
+int BondFilterHierarchy::build(std::vector<int>& indices, int begin, int end, const std::vector<double>& boxes) {
+
+	int nodeIndex = nodes.size();
+	nodes.push_back(Node());
+	Node node;
+	for(int i=0;i<3;i++){
+		node.min[i] = DBL_MAX;
+		node.max[i] = -DBL_MAX;
+	}
+	for(int n=begin;n<end;n++){
+		const double *box = &boxes[6*indices[n]];
+		for(int i=0;i<3;i++){
+			node.min[i] = std::min(node.min[i], box[i]);
+			node.max[i] = std::max(node.max[i], box[3+i]);
+		}
+	}
+	node.left = node.right = node.filter = -1;
+
+	if(end-begin == 1){
+		node.filter = indices[begin];
+	}
+	else{
+		/*
+		 * Split at the median along the longest axis of the node's box
+		 */
+		int axis = 0;
+		for(int i=1;i<3;i++)
+			if(node.max[i]-node.min[i] > node.max[axis]-node.min[axis]) axis = i;
+		int mid = (begin+end)/2;
+		std::nth_element(indices.begin()+begin, indices.begin()+mid, indices.begin()+end, BoxCenterLess(boxes,axis));
+		node.left = build(indices, begin, mid, boxes);
+		node.right = build(indices, mid, end, boxes);
+	}
+	nodes[nodeIndex] = node;
+	return nodeIndex;
+}
+
+void BondFilterHierarchy::findFilters(const double *center, double radius, std::vector<int>& filterIndices) const {
+
+	filterIndices.assign(unboundedFilters.begin(), unboundedFilters.end());
+	if(0==nodes.size()) return;
+
+	/*
+	 * Bonds lie within the closed sphere; pad it for round-off
+	 */
+	double r = radius*(1.0+1.0e-12);
+	double rSquared = r*r;
+	int stack[64];
+	int stackSize = 0;
+	stack[stackSize++] = 0;
+	while(stackSize > 0){
+		const Node& node = nodes[stack[--stackSize]];
+		double distanceSquared = 0.0;
+		for(int i=0;i<3;i++){
+			double d = 0.0;
+			if(center[i] < node.min[i]) d = node.min[i]-center[i];
+			else if(center[i] > node.max[i]) d = center[i]-node.max[i];
+			distanceSquared += d*d;
+		}
+		if(distanceSquared > rSquared) continue;
+		if(-1 != node.filter)
+			filterIndices.push_back(node.filter);
+		else{
+			stack[stackSize++] = node.left;
+			stack[stackSize++] = node.right;
+		}
+	}
+}
+
 }
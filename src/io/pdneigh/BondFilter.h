@@ -88,6 +88,10 @@ public:
 	 *      bondIntersect(x)
 	 */
 	bool bondIntersect(double x[3], double tolerance=1.0e-15);
+	/*
+	 * Axis-aligned box that contains every point for which bondIntersect(x,tolerance) can be true
+	 */
+	void boundingBox(double min[3], double max[3], double tolerance=1.0e-15) const;
 private:
 	UTILITIES::Vector3D n, r0, ub, ua;
 	double a, b;
@@ -105,6 +109,12 @@ public:
 	 */
 	virtual void filterBonds(std::vector<int>& treeList, const double *pt, const std::size_t ptLocalId, const double *xOverlap, bool* bondFlags) = 0;
 	virtual std::tr1::shared_ptr<BondFilter> clone(bool withSelf) = 0;
+	/*
+	 * Axis-aligned box outside of which this filter never removes a bond (other than the bond to self);
+	 * returns false if the filter is not spatially bounded
+	 */
+	virtual bool boundingBox(double min[3], double max[3]) const { return false; }
+	bool includesSelf() const { return includeSelf; }
 protected:
 	bool includeSelf;
 
@@ -132,11 +142,40 @@ public:
 	virtual ~FinitePlaneFilter() {}
 	virtual void filterBonds(std::vector<int>& treeList, const double *pt, const std::size_t ptLocalId, const double *xOverlap, bool* markForExclusion);
 	virtual std::tr1::shared_ptr<BondFilter> clone(bool withSelf=true);
+	virtual bool boundingBox(double min[3], double max[3]) const { plane.boundingBox(min,max,tolerance); return true; }
 private:
 	double tolerance;
 	FinitePlane plane;
 };
 
+/**
+ * Bounding-box hierarchy over a set of bond filters; used to find the filters that may
+ * remove bonds from the neighborhood (sphere) of a point.  Filters that are not spatially
+ * bounded are returned for every query.
+ */
+class BondFilterHierarchy {
+public:
+	explicit BondFilterHierarchy(const std::vector< std::tr1::shared_ptr<BondFilter> >& filters);
+	/*
+	 * Indices (into 'filters') of the filters whose bounding boxes intersect the sphere; the list is cleared first
+	 */
+	void findFilters(const double *center, double radius, std::vector<int>& filterIndices) const;
+	/*
+	 * True if any filter excludes a point from its own neighborhood
+	 */
+	bool excludesSelf() const { return excludeSelf; }
+private:
+	struct Node {
+		double min[3], max[3];
+		int left, right;
+		int filter;
+	};
+	int build(std::vector<int>& indices, int begin, int end, const std::vector<double>& boxes);
+	std::vector<Node> nodes;
+	std::vector<int> unboundedFilters;
+	bool excludeSelf;
+};
+
 }
 
 #endif /* BONDFILTER_H_ */
@@ -55,9 +55,15 @@
 
 #include "Peridigm_JAMSearchTree.hpp"
 #include "Peridigm_ZoltanSearchTree.hpp"
+#include "Peridigm_CellListSearchTree.hpp"
 #include "Peridigm_Memstat.hpp"
 
 #include <stdexcept>
+#include <algorithm>
+#include <cstring>
+#ifdef PERIDIGM_OPENMP
+#include <omp.h>
+#endif
 
 namespace PDNEIGH {
 
@@ -142,7 +148,8 @@ NeighborhoodList::NeighborhoodList
 		shared_ptr<int> ownedGIDs,
 		shared_ptr<double> owned_coordinates,
 		Teuchos::RCP<Epetra_Vector> horizonList,
-		std::vector< shared_ptr<PdBondFilter::BondFilter> > bondFilters
+		std::vector< shared_ptr<PdBondFilter::BondFilter> > bondFilters,
+		const std::string& searchTreeType
 )
 :
 		epetraComm(comm),
@@ -159,7 +166,8 @@ NeighborhoodList::NeighborhoodList
 		num_neighbors(num_owned_points),
 		sharedGIDs(),
 		zoltan(zz),
-		filter_ptrs(bondFilters)
+		filter_ptrs(bondFilters),
+		search_tree_type(searchTreeType)
 {
         if(filter_ptrs.size() == 0){
           filter_ptrs.push_back(shared_ptr<PdBondFilter::BondFilter>(new PdBondFilter::BondFilterDefault()));
@@ -204,7 +212,8 @@ NeighborhoodList::NeighborhoodList
 		shared_ptr<int> ownedGIDs,
 		shared_ptr<double> owned_coordinates,
 		double horizon,
-		std::vector< shared_ptr<PdBondFilter::BondFilter> > bondFilters
+		std::vector< shared_ptr<PdBondFilter::BondFilter> > bondFilters,
+		const std::string& searchTreeType
 )
 :
 		epetraComm(comm),
@@ -220,7 +229,8 @@ NeighborhoodList::NeighborhoodList
 		num_neighbors(num_owned_points),
 		sharedGIDs(),
 		zoltan(zz),
-		filter_ptrs(bondFilters)
+		filter_ptrs(bondFilters),
+		search_tree_type(searchTreeType)
 {
      if(filter_ptrs.size() == 0){
        filter_ptrs.push_back(shared_ptr<PdBondFilter::BondFilter>(new PdBondFilter::BondFilterDefault()));
@@ -395,12 +405,10 @@ void NeighborhoodList::createAndAddNeighborhood(){
 	MPI_Comm_size(MPI_COMM_WORLD, &numProcs);
 //	std::cout << "createAndAddNeighborhood:Aa" << std::endl;
 	/*
-	 * This is the maximum possible length of communication -- every frame point goes to every processor
+	 * Scratch space for the processors overlapping a single point's box;
+	 * this is the only allocation that scales with the number of processors
 	 */
 	Array<int> procsArrayPoint(numProcs);
-	Array<int> sendProcsArray(numProcs*frameSet->size());
-	Array<int> pointLocalIdsArray(numProcs*frameSet->size());
-
 
 	/*
 	 * dimension for each point must be '3'
@@ -418,65 +426,58 @@ void NeighborhoodList::createAndAddNeighborhood(){
 	int nSend(0), nReceive(0);
 	int error;
 
-//	std::cout << "rank, nSend, numProcs*frameSet->size() = " << rank << ": " << nSend << ", " << numProcs*frameSet->size() << std::endl;
+	double *x = owned_x.get();
+	double *horizon;
+	horizons->ExtractView(&horizon);
+	int* procsPointPtr = procsArrayPoint.get();
+	int numProcsPoint;
+
+	/*
+	 * First pass: count the off-processor destinations of each frame point;
+	 * boxes are sized by each point's own horizon
+	 */
+	for(std::set<int>::iterator myPointsIter=frameSet->begin();myPointsIter!=frameSet->end();myPointsIter++){
+		int id = *myPointsIter;
+		PointCenteredBoundingBox bb(x+dimension*id,horizon[id]);
+		Zoltan_LB_Box_Assign(zoltan,bb.get_xMin(),bb.get_yMin(),bb.get_zMin(),bb.get_xMax(),bb.get_yMax(),bb.get_zMax(),procsPointPtr,&numProcsPoint);
+		for(int j=0;j<numProcsPoint;j++)
+			if(rank!=procsPointPtr[j]) nSend++;
+	}
+
+	/*
+	 * Allocate exactly what is sent rather than numProcs*frameSet->size()
+	 */
+	Array<int> sendProcsArray(nSend);
+	Array<int> pointLocalIdsArray(nSend);
+
 	{
 		int* sendProcsPtr = sendProcsArray.get();
-		int* procsPointPtr = procsArrayPoint.get();
 		int* localIdsPtr = pointLocalIdsArray.get();
 
-
-		int numProcsPoint;
-		std::set<int>::iterator myPointsIter = frameSet->begin();
-		double *x = owned_x.get();
-        double *horizon;
-        horizons->ExtractView(&horizon);
-
-		for(;myPointsIter!=frameSet->end();myPointsIter++){
+		/*
+		 * Second pass: record destination processor and local id of each send
+		 */
+		int n=0;
+		for(std::set<int>::iterator myPointsIter=frameSet->begin();myPointsIter!=frameSet->end();myPointsIter++){
 
 			/*
 			 * This is a local id
 			 */
 			int id = *myPointsIter;
-			const double *xP = x+dimension*id;
-            const double *horizonP = horizon+id;
-			PointCenteredBoundingBox bb(xP,*horizonP);
-//			if(1==rank){
-//				std::cout << "localId, x,y,z = " << id << ", " << *xP << ", " << *(xP+1) << ", " << *(xP+2) << std::endl;
-//				std::cout << "xMin, xMax " << bb.get_xMin() << ", " << bb.get_xMax() << std::endl;
-//				std::cout << "yMin, yMax " << bb.get_yMin() << ", " << bb.get_yMax() << std::endl;
-//				std::cout << "zMin, zMax " << bb.get_zMin() << ", " << bb.get_zMax() << std::endl;
-//			}
-
-
+			PointCenteredBoundingBox bb(x+dimension*id,horizon[id]);
 			Zoltan_LB_Box_Assign(zoltan,bb.get_xMin(),bb.get_yMin(),bb.get_zMin(),bb.get_xMax(),bb.get_yMax(),bb.get_zMax(),procsPointPtr,&numProcsPoint);
-			/*
-			 * Get local id and copy it nSend times into idsPtr
-			 */
-			int *ptrToSendProcs = sendProcsPtr+nSend;
-			int *i = localIdsPtr+nSend;
-//			cout << "Zoltan_LB_Box_Assign -- numProcsPoint = " << numProcsPoint << endl;
 			for(int j=0;j<numProcsPoint;j++){
 				/*
 				 * Skip this point and processor if myRank = proc
 				 * We do not send points to ourself
 				 */
 				if(rank==procsPointPtr[j]) continue;
-				*i = id;
-				/*
-				 * Increment pointers
-				 */
-				*ptrToSendProcs = procsPointPtr[j];
-				ptrToSendProcs++; i++;
-
-				/*
-				 * Increment total number of points to be sent
-				 */
-				nSend++;
-
+				sendProcsPtr[n] = procsPointPtr[j];
+				localIdsPtr[n] = id;
+				n++;
 			}
 		}
 
-
 		/*
 		 * Create "communication" plan
 		 */
@@ -618,6 +619,30 @@ void NeighborhoodList::createAndAddNeighborhood(){
 
 }
 
+PeridigmNS::SearchTree* NeighborhoodList::createSearchTree(int numOverlapPoints, double* xOverlap) const {
+	/*
+	 * There are three implementations available:  Zoltan (default), JAM, and Cell List
+	 */
+	if("Zoltan"==search_tree_type)
+		return new PeridigmNS::ZoltanSearchTree(numOverlapPoints, xOverlap);
+	if("JAM"==search_tree_type)
+		return new PeridigmNS::JAMSearchTree(numOverlapPoints, xOverlap);
+	if("Cell List"==search_tree_type){
+		/*
+		 * Cell size is the largest horizon among the owned points
+		 */
+		double *h;
+		horizons->ExtractView(&h);
+		double maxHorizon = 0.0;
+		for(size_t p=0;p<num_owned_points;p++)
+			if(h[p]>maxHorizon) maxHorizon=h[p];
+		return new PeridigmNS::CellListSearchTree(numOverlapPoints, xOverlap, maxHorizon);
+	}
+	std::string message("\nERROR-->NeighborhoodList::createSearchTree(..)\n\tUnknown search tree type \"");
+	message += search_tree_type + "\", valid types are \"Zoltan\", \"JAM\", and \"Cell List\".\n";
+	throw std::invalid_argument(message);
+}
+
 void NeighborhoodList::buildNeighborhoodList
 (
 		int numOverlapPoints,
@@ -625,139 +650,158 @@ void NeighborhoodList::buildNeighborhoodList
 )
 {
 	/*
-	 * Create KdTree
-     * There are two implemenations available:  JAM and Zoltan
+	 * Create search tree
 	 */
-    //PeridigmNS::SearchTree* searchTree = new PeridigmNS::JAMSearchTree(numOverlapPoints, xOverlapPtr.get());
-    PeridigmNS::SearchTree* searchTree = new PeridigmNS::ZoltanSearchTree(numOverlapPoints, xOverlapPtr.get());
+	PeridigmNS::SearchTree* searchTree = createSearchTree(numOverlapPoints, xOverlapPtr.get());
 
 	/*
 	 * this is used by bond filters
 	 */
 	const double* xOverlap = xOverlapPtr.get();
+	const double* xOwned = owned_x.get();
+	double *h;
+	horizons->ExtractView(&h);
 
-	size_t sizeList = 0;
-	size_t max=0;
-	{
-		/*
-		 * Loop over owned points and determine number of points in horizon
-		 */
-		double *x = owned_x.get();
-        double *h;
-        horizons->ExtractView(&h);
-		const double *x_end = x+3*num_owned_points;
-		size_t localId=0;
-		for(;x!=x_end;x+=3, h+=1, localId++){
-
-            std::vector<int> treeList;
-			/*
-			 * Note that list returned includes this point *
-			 */
-			searchTree->FindPointsWithinRadius(x, *h, treeList);
-
-			if(0==treeList.size()){
-				/*
-				 * Houston, we have a problem
-				 */
-				std::stringstream sstr;
-				sstr << "\nERROR-->NeighborhoodList::buildNeighborhoodList(..)\n";
-				sstr << "\tKdTree search failed to find any points in its neighborhood including itself!\n\tThis is probably a problem.\n";
-				sstr << "\tLocal point id = " << localId << "\n"
-					 << "\tSearch horizon = " << *h << "\n"
-					 << "\tx,y,z = " << *(x) << ", " << *(x+1) << ", " << *(x+2) << std::endl;
-				std::string message=sstr.str();
-				throw std::runtime_error(message);
-			}
-
-			size_t ptListSize = treeList.size()+1;
-			sizeList += ptListSize;
+	/*
+	 * Bounding-box hierarchy over the bond filters; each point's bonds are only passed to the
+	 * filters whose boxes intersect the point's horizon sphere
+	 */
+	const PdBondFilter::BondFilterHierarchy filterHierarchy(filter_ptrs);
+	const bool excludeSelf = filterHierarchy.excludesSelf();
 
-			/*
-			 * Determine maximum possible number of neighbors over all points
-			 */
-			{
-                size_t numIds = treeList.size();
-				if(numIds>max) max=numIds;
-			}
-		}
-	}
 	/*
-	 * Second pass to populate neighborhood list
+	 * Owned points are split into contiguous chunks, one per thread.  Each point is searched and its
+	 * bonds are filtered exactly once; the surviving neighbors are appended to the chunk's own
+	 * compressed buffers (a count per point and the concatenated neighbor ids).  A prefix sum over the
+	 * counts then gives the neighborhood pointers, the list of the form (numNeigh, n_0, n_1, ...) is
+	 * allocated once at its final size, and each chunk is copied into its slot and released.  The
+	 * layout of the list does not depend on the number of threads.  Only thread-safe search trees
+	 * (currently the cell list) are queried by more than one thread.
 	 */
-	neighborhood_ptr = Array<int>(num_owned_points);
-	neighborhood     = Array<int>(sizeList);
-	Array<bool> markForExclusion(max);
+	int numChunks = 1;
+#ifdef PERIDIGM_OPENMP
+	if(searchTree->IsThreadSafe())
+		numChunks = omp_get_max_threads();
+#endif
+	const int numOwned = static_cast<int>(num_owned_points);
+	std::vector<int> chunkFailedId(numChunks, -1);
+	std::vector< std::vector<int> > chunkCounts(numChunks);
+	std::vector< std::vector<int> > chunkIds(numChunks);
+
+#ifdef PERIDIGM_OPENMP
+	#pragma omp parallel for schedule(static,1) num_threads(numChunks)
+#endif
+	for(int chunk=0;chunk<numChunks;chunk++){
+
+		const int begin = static_cast<int>((static_cast<long long>(numOwned)*chunk)/numChunks);
+		const int end   = static_cast<int>((static_cast<long long>(numOwned)*(chunk+1))/numChunks);
+
+		std::vector<int>& counts = chunkCounts[chunk];
+		std::vector<int>& ids = chunkIds[chunk];
+		counts.reserve(end-begin);
 
-	{
 		/*
-		 * Loop over owned points and determine number of points in horizon
+		 * Buffers are reused across queries
 		 */
-		int *ptr = neighborhood_ptr.get();
-		int neighPtr = 0;
-		int *list = neighborhood.get();
-		double *x = owned_x.get();
-        double *h;
-        horizons->ExtractView(&h);
-		for(size_t p=0;p<num_owned_points;p++,x+=3,h+=1,ptr++){
-			*ptr = neighPtr;
-            std::vector<int> treeList;
+		std::vector<int> treeList;
+		std::vector<int> filterIndices;
+		Array<bool> markForExclusion(64);
+
+		for(int p=begin;p<end;p++){
+
+			const double *x = xOwned+3*p;
+			treeList.clear();
 			/*
-			 * Note that list returned includes this point * but at start of list
+			 * Note that list returned includes this point
 			 */
-			searchTree->FindPointsWithinRadius(x, *h, treeList);
+			searchTree->FindPointsWithinRadius(x, h[p], treeList);
+
+			if(0==treeList.size()){
+				chunkFailedId[chunk] = p;
+				break;
+			}
 
 			sort(treeList.begin(), treeList.end());
 
+			if(markForExclusion.get_size() < treeList.size())
+				markForExclusion = Array<bool>(2*treeList.size());
 			bool *bondFlags = markForExclusion.get();
 
-			// Set all flags to "unbroken"
+			// Set all flags to "unbroken"; the point is excluded from its own neighborhood if any filter excludes it
 			for(unsigned int iBondFlag=0 ; iBondFlag<treeList.size(); ++iBondFlag){
-			  bondFlags[iBondFlag] = 0;
+			  bondFlags[iBondFlag] = (excludeSelf && treeList[iBondFlag]==p) ? 1 : 0;
 			}
 
-			for(unsigned int iFilter = 0 ; iFilter<filter_ptrs.size() ; iFilter++){
-			  filter_ptrs[iFilter]->filterBonds(treeList, x, p, xOverlap, bondFlags);
+			filterHierarchy.findFilters(x, h[p], filterIndices);
+			for(unsigned int iFilter = 0 ; iFilter<filterIndices.size() ; iFilter++){
+			  filter_ptrs[filterIndices[iFilter]]->filterBonds(treeList, x, p, xOverlap, bondFlags);
 			}
 
-			/*
-			 * Determine number of neighbors from flags
-			 * Save start of list so that number of neighbors can be assigned after it
-			 * has been calculated; Then increment pointer to first neighbor
-			 */
-
-			/*
-			 * Save address for number of neighbors; will assign later
-			 */
-			int *numNeighPtr = list; list++;
-			/*
-			 * Loop over flags and save neighbors as appropriate; also accumulate number of neighbors
-			 */
-			size_t numNeigh=0;
-			for(unsigned int n=0;n<treeList.size();n++,bondFlags++){
-				if(1==*bondFlags) continue;
-				int uid = treeList[n];
-				*list = uid;
-				list++;
+			int numNeigh=0;
+			for(unsigned int n=0;n<treeList.size();n++){
+				if(1==bondFlags[n]) continue;
+				ids.push_back(treeList[n]);
 				numNeigh++;
 			}
+			counts.push_back(numNeigh);
+		}
+	}
 
+	for(int chunk=0;chunk<numChunks;chunk++){
+		if(-1 != chunkFailedId[chunk]){
 			/*
-			 * Now save number of neighbors
-			 */
-			*numNeighPtr = numNeigh;
-			/*
-			 * increment neighborhood pointer
-			 */
-			neighPtr += (numNeigh+1);
-			/*
-			 * Delete list
+			 * Houston, we have a problem
 			 */
+			int localId = chunkFailedId[chunk];
+			const double *x = xOwned+3*localId;
+			std::stringstream sstr;
+			sstr << "\nERROR-->NeighborhoodList::buildNeighborhoodList(..)\n";
+			sstr << "\tKdTree search failed to find any points in its neighborhood including itself!\n\tThis is probably a problem.\n";
+			sstr << "\tLocal point id = " << localId << "\n"
+				 << "\tSearch horizon = " << h[localId] << "\n"
+				 << "\tx,y,z = " << *(x) << ", " << *(x+1) << ", " << *(x+2) << std::endl;
+			std::string message=sstr.str();
+			delete searchTree;
+			throw std::runtime_error(message);
+		}
+	}
+
+	/*
+	 * Exclusive prefix sum of the neighborhood sizes gives the neighborhood pointers
+	 */
+	neighborhood_ptr = Array<int>(num_owned_points);
+	int *ptr = neighborhood_ptr.get();
+	size_t sizeList = 0;
+	for(int chunk=0, p=0;chunk<numChunks;chunk++){
+		const std::vector<int>& counts = chunkCounts[chunk];
+		for(unsigned int i=0;i<counts.size();i++,p++){
+			ptr[p] = static_cast<int>(sizeList);
+			sizeList += counts[i]+1;
+		}
+	}
+	neighborhood = Array<int>(sizeList);
+
+	/*
+	 * Copy each chunk into its slot of the list and release its buffers
+	 */
+	int *list = neighborhood.get();
+	for(int chunk=0;chunk<numChunks;chunk++){
+		const std::vector<int>& counts = chunkCounts[chunk];
+		const int *ids = chunkIds[chunk].empty() ? 0 : &chunkIds[chunk][0];
+		for(unsigned int i=0;i<counts.size();i++){
+			*list = counts[i]; list++;
+			if(counts[i] > 0)
+				memcpy(list, ids, counts[i]*sizeof(int));
+			list += counts[i];
+			ids += counts[i];
 		}
+		std::vector<int>().swap(chunkCounts[chunk]);
+		std::vector<int>().swap(chunkIds[chunk]);
 	}
 
 	// output some memory statistics from here:
   PeridigmNS::Memstat * memstat = PeridigmNS::Memstat::Instance();
-  memstat->addStat("Zoltan Search Tree");
+  memstat->addStat(search_tree_type + " Search Tree");
 
 
 
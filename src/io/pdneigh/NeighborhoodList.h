@@ -56,10 +56,12 @@
 #include <Epetra_Vector.h>
 #include <vector>
 #include <map>
+#include <string>
 
 
 class Epetra_Comm;
 struct Zoltan_Struct;
+namespace PeridigmNS { class SearchTree; }
 class Epetra_Distributor;
 
 /**
@@ -130,7 +132,8 @@ public:
 			shared_ptr<int> ownedGIDs,
 			shared_ptr<double> owned_coordinates,
 			Teuchos::RCP<Epetra_Vector> horizonList,
-			std::vector< shared_ptr<PdBondFilter::BondFilter> > bondFilters = std::vector< shared_ptr<PdBondFilter::BondFilter> >()
+			std::vector< shared_ptr<PdBondFilter::BondFilter> > bondFilters = std::vector< shared_ptr<PdBondFilter::BondFilter> >(),
+			const std::string& searchTreeType = "Zoltan"
 			);
 	NeighborhoodList(
 			shared_ptr<const Epetra_Comm> comm,
@@ -139,7 +142,8 @@ public:
 			shared_ptr<int> ownedGIDs,
 			shared_ptr<double> owned_coordinates,
 			double horizon,
-			std::vector< shared_ptr<PdBondFilter::BondFilter> > bondFilters = std::vector< shared_ptr<PdBondFilter::BondFilter> >()
+			std::vector< shared_ptr<PdBondFilter::BondFilter> > bondFilters = std::vector< shared_ptr<PdBondFilter::BondFilter> >(),
+			const std::string& searchTreeType = "Zoltan"
 			);
 	double get_frameset_buffer_size() const;
 	size_t get_num_owned_points() const;
@@ -163,6 +167,7 @@ public:
 private:
 
 	void buildNeighborhoodList(int numOverlapPoints,shared_ptr<double> xOverlapPtr);
+	PeridigmNS::SearchTree* createSearchTree(int numOverlapPoints,double* xOverlap) const;
 	Array<int> createLocalNeighborList(const Epetra_BlockMap& overlapMap);
 	Array<int> createSharedGlobalIds() const;
 	void createAndAddNeighborhood();
@@ -179,6 +184,7 @@ private:
 	Array<int> neighborhood, local_neighborhood, neighborhood_ptr, num_neighbors, sharedGIDs;
 	struct Zoltan_Struct* zoltan;
 	std::vector< shared_ptr<PdBondFilter::BondFilter> > filter_ptrs;
+	std::string search_tree_type;
 
 };
 
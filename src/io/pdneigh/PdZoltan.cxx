@@ -226,11 +226,70 @@ struct Zoltan_Struct * createAndInitializeZoltan(QuickGridData& pdGridData){
 	return zoltan;
 }
 
+/*
+ * Weights handed to the Zoltan object list callback for weighted partitioning
+ */
+struct WeightedGridData {
+	QuickGridData *gridData;
+	const double *weights;
+};
+
+void zoltanQuery_weightedObjectList
+(
+		void *weightedGridData,
+		int numGids,
+		int numLids,
+		ZOLTAN_ID_PTR zoltanGlobalIds,
+		ZOLTAN_ID_PTR zoltanLocalIds,
+		int numWeights,
+		float *objectWts,
+		int *ierr
+)
+{
+	WeightedGridData *data = (WeightedGridData *)weightedGridData;
+	zoltanQuery_objectList(data->gridData,numGids,numLids,zoltanGlobalIds,zoltanLocalIds,numWeights,objectWts,ierr);
+	for(size_t i=0; i<data->gridData->numPoints; i++)
+		objectWts[i] = static_cast<float>(data->weights[i]);
+}
+
+/*
+ * Max over average of the per-processor weight
+ */
+double computeImbalance(double localWeight){
+	double maxWeight=0, sumWeight=0;
+	int numProcs;
+	MPI_Comm_size(MPI_COMM_WORLD,&numProcs);
+	MPI_Allreduce(&localWeight,&maxWeight,1,MPI_DOUBLE,MPI_MAX,MPI_COMM_WORLD);
+	MPI_Allreduce(&localWeight,&sumWeight,1,MPI_DOUBLE,MPI_SUM,MPI_COMM_WORLD);
+	return sumWeight > 0 ? maxWeight*numProcs/sumWeight : 1.0;
+}
+
+QuickGridData& loadBalance(QuickGridData& pdGridData, const double *pointWeights, double *imbalanceBefore, double *imbalanceAfter);
+
 QuickGridData& getLoadBalancedDiscretization(QuickGridData& pdGridData){
+	return loadBalance(pdGridData,0,0,0);
+}
+
+QuickGridData& getWeightedLoadBalancedDiscretization(QuickGridData& pdGridData, const double *pointWeights, double& imbalanceBefore, double& imbalanceAfter){
+	return loadBalance(pdGridData,pointWeights,&imbalanceBefore,&imbalanceAfter);
+}
+
+QuickGridData& loadBalance(QuickGridData& pdGridData, const double *pointWeights, double *imbalanceBefore, double *imbalanceAfter){
 //	std::cout << "getLoadBalancedDiscretization(QuickGridData& pdGridData) Start"  << std::endl; std::cout.flush();
 
 	struct Zoltan_Struct *zoltan = createAndInitializeZoltan(pdGridData);
 
+	/*
+	 * Optional per-point weights (e.g., bond counts); RCB then balances the total weight per processor
+	 */
+	WeightedGridData weightedGridData;
+	weightedGridData.gridData = &pdGridData;
+	weightedGridData.weights = pointWeights;
+	if(0!=pointWeights){
+		Zoltan_Set_Param(zoltan, "OBJ_WEIGHT_DIM", "1");
+		Zoltan_Set_Obj_List_Fn(zoltan, zoltanQuery_weightedObjectList, &weightedGridData);
+	}
+
 //	std::cout << "getLoadBalancedDiscretization(QuickGridData& pdGridData) A"  << std::endl; std::cout.flush();
 	pdGridData.zoltanPtr = shared_ptr<struct Zoltan_Struct>(zoltan,ZoltanDestroyer());
 
@@ -288,6 +347,34 @@ QuickGridData& getLoadBalancedDiscretization(QuickGridData& pdGridData){
 					&exportToPart       /* Partition to which each vertex will belong */
 			);
 //	std::cout << "getLoadBalancedDiscretization(PdGridData& pdGridData) E"  << std::endl; std::cout.flush();
+	if(0!=pointWeights){
+		/*
+		 * Weight per processor before and after the partition; exported points are credited to their new part
+		 */
+		int numProcs, myRank;
+		MPI_Comm_size(MPI_COMM_WORLD,&numProcs);
+		MPI_Comm_rank(MPI_COMM_WORLD,&myRank);
+		double localWeight=0;
+		for(size_t i=0; i<pdGridData.numPoints; i++)
+			localWeight += pointWeights[i];
+		vector<double> localPartWeights(numProcs,0.0), partWeights(numProcs,0.0);
+		localPartWeights[myRank] = localWeight;
+		for(int e=0; e<numExport; e++){
+			double w = pointWeights[exportLocalGids[e*numLidEntries]];
+			localPartWeights[myRank] -= w;
+			localPartWeights[exportToPart[e]] += w;
+		}
+		MPI_Allreduce(&localPartWeights[0],&partWeights[0],numProcs,MPI_DOUBLE,MPI_SUM,MPI_COMM_WORLD);
+		*imbalanceBefore = computeImbalance(localWeight);
+		*imbalanceAfter = computeImbalance(partWeights[myRank]);
+
+		/*
+		 * The weights are indexed by the pre-migration ordering; restore the unweighted callback
+		 */
+		Zoltan_Set_Param(zoltan, "OBJ_WEIGHT_DIM", "0");
+		Zoltan_Set_Obj_List_Fn(zoltan, zoltanQuery_objectList, &pdGridData);
+	}
+
 	Zoltan_Migrate
 	(
 			zoltan,
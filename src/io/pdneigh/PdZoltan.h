@@ -63,6 +63,12 @@ struct Zoltan_Struct * createAndInitializeZoltan(QUICKGRID::QuickGridData& pdGri
  */
 QUICKGRID::QuickGridData& getLoadBalancedDiscretization(QUICKGRID::QuickGridData& pdGridData);
 
+/*
+ * Load balancing with one weight per point (e.g., the number of bonds, scaled by a material cost);
+ * on return, imbalanceBefore and imbalanceAfter hold the max/average weight per processor
+ */
+QUICKGRID::QuickGridData& getWeightedLoadBalancedDiscretization(QUICKGRID::QuickGridData& pdGridData, const double *pointWeights, double& imbalanceBefore, double& imbalanceAfter);
+
 /*
  * Zoltan call back functions
  */
@@ -100,6 +100,46 @@ TEUCHOS_UNIT_TEST(FinitePlane, SimplePlaneCaseTest) {
 	TEST_ASSERT(0==plane.bondIntersectInfinitePlane(p0Ptr,p1Ptr,t,x));
 }
 
+TEUCHOS_UNIT_TEST(FinitePlane, BondFilterHierarchyTest) {
+
+	/*
+	 * Plane x=0, spanning 0<=y<=1 and 0<=z<=1
+	 */
+	double r0[3]; r0[0]=0;r0[1]=1;r0[2]=0;
+	double n[3]; n[0]=1;n[1]=0;n[2]=0;
+	double ua[3]; ua[0]=0;ua[1]=-1;ua[2]=0;
+	PdBondFilter::FinitePlane plane(n,r0,ua,1.0,1.0);
+
+	double min[3], max[3];
+	plane.boundingBox(min,max);
+	double tolerance = 1.0e-10;
+	TEST_FLOATING_EQUALITY(min[0]+1.0, 1.0, tolerance);
+	TEST_FLOATING_EQUALITY(min[1]+1.0, 1.0, tolerance);
+	TEST_FLOATING_EQUALITY(min[2]+1.0, 1.0, tolerance);
+	TEST_FLOATING_EQUALITY(max[0]+1.0, 1.0, tolerance);
+	TEST_FLOATING_EQUALITY(max[1], 1.0, tolerance);
+	TEST_FLOATING_EQUALITY(max[2], 1.0, tolerance);
+
+	/*
+	 * The plane filter is bounded; the default filter is not, and is returned for every query
+	 */
+	std::vector< std::tr1::shared_ptr<PdBondFilter::BondFilter> > filters;
+	filters.push_back(std::tr1::shared_ptr<PdBondFilter::BondFilter>(new PdBondFilter::FinitePlaneFilter(plane)));
+	filters.push_back(std::tr1::shared_ptr<PdBondFilter::BondFilter>(new PdBondFilter::BondFilterDefault()));
+	PdBondFilter::BondFilterHierarchy hierarchy(filters);
+	TEST_ASSERT(hierarchy.excludesSelf());
+
+	std::vector<int> filterIndices;
+	double nearPlane[3]; nearPlane[0]=0.5; nearPlane[1]=0.5; nearPlane[2]=0.5;
+	hierarchy.findFilters(nearPlane, 0.6, filterIndices);
+	TEST_ASSERT(2==filterIndices.size());
+
+	double farFromPlane[3]; farFromPlane[0]=2.0; farFromPlane[1]=2.0; farFromPlane[2]=2.0;
+	hierarchy.findFilters(farFromPlane, 0.5, filterIndices);
+	TEST_ASSERT(1==filterIndices.size());
+	TEST_ASSERT(1==filterIndices[0]);
+}
+
 int main( int argc, char* argv[] ) {
   
   return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
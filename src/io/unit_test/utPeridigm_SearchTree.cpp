@@ -47,6 +47,7 @@
 
 #include "Peridigm_JAMSearchTree.hpp"
 #include "Peridigm_ZoltanSearchTree.hpp"
+#include "Peridigm_CellListSearchTree.hpp"
 #include <Epetra_SerialComm.h>
 #include <Teuchos_ParameterList.hpp>
 #include <Teuchos_UnitTestHarness.hpp>
@@ -179,6 +180,51 @@ TEUCHOS_UNIT_TEST(SearchTree, JAMEightPointMesh) {
   delete searchTree;
 }
 
+//! Cell list eight-point test
+
+TEUCHOS_UNIT_TEST(SearchTree, CellListEightPointMesh) {
+
+  vector<double> mesh;
+  eightPointMesh(mesh);
+
+  vector<int> neighborList;
+  int searchPointIndex, degreesOfFreedom(3);
+  double searchRadius;
+  PeridigmNS::SearchTree* searchTree = new PeridigmNS::CellListSearchTree(static_cast<int>(mesh.size()/3), &mesh[0], 1.0);
+
+  // This search should find all the other points
+  
+  searchPointIndex = 2;
+  searchRadius = 3.015;
+  testEightPointMesh(mesh,searchTree, neighborList, searchPointIndex, degreesOfFreedom, searchRadius);
+  TEST_EQUALITY_CONST(static_cast<int>(neighborList.size()), 8);
+  
+  for(int i=0 ; i<8 ; ++i)
+    TEST_EQUALITY(neighborList[i], i);
+
+ // This search should find three neighbors
+  
+  searchPointIndex = 0;
+  searchRadius = 1.015;
+  testEightPointMesh(mesh,searchTree, neighborList, searchPointIndex, degreesOfFreedom, searchRadius);
+  TEST_EQUALITY_CONST(static_cast<int>(neighborList.size()), 4);
+   
+  TEST_EQUALITY_CONST(neighborList[0], 0);
+  TEST_EQUALITY_CONST(neighborList[1], 1);
+  TEST_EQUALITY_CONST(neighborList[2], 2);
+  TEST_EQUALITY_CONST(neighborList[3], 4);
+
+  
+ // This search should find no neighbors
+ 
+  searchPointIndex = 0;
+  searchRadius = 0.015;
+  testEightPointMesh(mesh,searchTree, neighborList, searchPointIndex, degreesOfFreedom, searchRadius);
+  TEST_EQUALITY_CONST(static_cast<int>(neighborList.size()), 1);
+ 
+  delete searchTree;
+}
+
 
 
 // //! Tests the search tree associated with the equally-spaced 1000-point cube mesh
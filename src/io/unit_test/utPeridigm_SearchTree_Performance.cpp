@@ -51,6 +51,7 @@
 #include "Peridigm_Timer.hpp"
 #include "Peridigm_JAMSearchTree.hpp"
 #include "Peridigm_ZoltanSearchTree.hpp"
+#include "Peridigm_CellListSearchTree.hpp"
 #include <Teuchos_ParameterList.hpp>
 #include <Teuchos_UnitTestHarness.hpp>
 #include "Teuchos_UnitTestRepository.hpp"
@@ -67,13 +68,15 @@ using namespace PeridigmNS;
 
 
 
-PeridigmNS::SearchTree* createTree(string treeType, int numPoints, double* coordinates)
+PeridigmNS::SearchTree* createTree(string treeType, int numPoints, double* coordinates, double searchRadius)
 {
   PeridigmNS::SearchTree* tree(NULL);
   if(treeType == "Zoltan")
     tree = new PeridigmNS::ZoltanSearchTree(numPoints, coordinates);
   else if(treeType == "JAM")
     tree = new PeridigmNS::JAMSearchTree(numPoints, coordinates);
+  else if(treeType == "Cell List")
+    tree = new PeridigmNS::CellListSearchTree(numPoints, coordinates, searchRadius);
   return tree;
 }
 
@@ -91,7 +94,7 @@ void testPerformance( vector<int> neighborList, double searchRadius, vector<doub
    int degreesOfFreedom(3);
    //neighborList.clear();
    
-   searchTree = createTree(treeType, static_cast<int>(mesh.size()/3), meshPtr);
+   searchTree = createTree(treeType, static_cast<int>(mesh.size()/3), meshPtr, searchRadius);
    neighborList.resize(130);
 
    for(unsigned int i=0 ; i<mesh.size()/3 ; i++){
@@ -597,6 +600,250 @@ TEUCHOS_UNIT_TEST(SearchTree_Performance, JAMTest) {
 
 }
 
+TEUCHOS_UNIT_TEST(SearchTree_Performance, CellListTest) {
+
+  vector<int> neighborList;
+  double searchRadius;
+  vector<double> mesh;
+  string fileName, testName, treeType;
+  PeridigmNS::SearchTree* searchTree(NULL);
+  unsigned int totalBonds, maxBonds, minBonds;
+  string str;
+  vector<double> data;
+  double num;
+  ifstream inFile;
+
+
+  treeType = "Cell List";
+
+  // Create a 8022-point discretization shaped like a dumbbell and find the neighbors of all the points
+
+  mesh.clear();
+  fileName = "./input_files/dumbbell.txt";
+  
+  searchRadius = (1.0/3.0)*3.015;
+  //! Read a mesh from a text file
+
+  inFile.open(fileName.c_str());
+  if(!inFile.is_open())
+    cout << "\n**** Warning:  This test can only be run from the directory where it resides (otherwise it won't find the input files) ****\n" << endl;
+  TEST_EQUALITY(inFile.is_open(), true);
+  while(inFile.good()){
+   
+    getline(inFile, str);
+    // Ignore comment lines, otherwise parse
+    if( !(str[0] == '#' || str[0] == '/' || str[0] == '*' || str.size() == 0) ){
+      
+      istringstream iss(str);
+      
+
+      while ( iss >> num) data.push_back(num);
+
+      // Check for obvious problems with the data
+
+      TEST_EQUALITY_CONST(static_cast<int>(data.size()), 5);
+
+      // Store the coordinates
+      mesh.push_back(data[0]);
+      mesh.push_back(data[1]);
+      mesh.push_back(data[2]);
+
+      data.clear();
+
+      
+    }
+  }
+  inFile.close();
+
+  testName = treeType + " test 1)  Dumbbell mesh with 8022 points";
+
+  PeridigmNS::Timer::self().startTimer(testName);
+  testPerformance( neighborList,  searchRadius, mesh, testName, treeType, searchTree, totalBonds, maxBonds, minBonds);
+
+  TEST_EQUALITY_CONST(totalBonds, static_cast<unsigned int>(8630086));
+  TEST_EQUALITY_CONST(maxBonds, static_cast<unsigned int>(1934));
+  TEST_EQUALITY_CONST(minBonds, static_cast<unsigned int>(52));
+  delete searchTree;
+  PeridigmNS::Timer::self().stopTimer(testName);
+
+  // Create a random, 8000-point discretization and find the neighbors of all the points
+
+  mesh.clear();
+  fileName = "./input_files/random.txt";
+  //! Read a mesh from a text file
+ 
+  inFile.open(fileName.c_str());
+  if(!inFile.is_open())
+    cout << "\n**** Warning:  This test can only be run from the directory where it resides (otherwise it won't find the input files) ****\n" << endl;
+  TEST_EQUALITY(inFile.is_open(), true);
+  while(inFile.good()){
+    
+    getline(inFile, str);
+    
+    if( !(str[0] == '#' || str[0] == '/' || str[0] == '*' || str.size() == 0) ){
+       istringstream iss(str);
+      
+      while ( iss >> num) data.push_back(num);
+
+      TEST_EQUALITY_CONST(static_cast<int>(data.size()), 5);
+
+      mesh.push_back(data[0]);
+      mesh.push_back(data[1]);
+      mesh.push_back(data[2]);
+
+      data.clear();
+
+      
+    }
+  }
+  inFile.close();
+
+  testName = treeType + " test 2)  Random mesh with 8000 points";
+  searchRadius = 3.0;
+
+  PeridigmNS::Timer::self().startTimer(testName);
+ 
+  testPerformance( neighborList,  searchRadius, mesh, testName, treeType, searchTree, totalBonds, maxBonds, minBonds);
+
+  TEST_EQUALITY_CONST(totalBonds, static_cast<unsigned int>(5005818));
+  TEST_EQUALITY_CONST(maxBonds, static_cast<unsigned int>(963));
+  TEST_EQUALITY_CONST(minBonds, static_cast<unsigned int>(127));
+  delete searchTree;
+  PeridigmNS::Timer::self().stopTimer(testName);
+
+  // Create a 27000-point discretization and find the neighbors of all the points
+
+ 
+  mesh.clear();
+  fileName = "./input_files/cube_27000.txt";
+
+  //! Read a mesh from a text file
+  inFile.open(fileName.c_str());
+  if(!inFile.is_open())
+    cout << "\n**** Warning:  This test can only be run from the directory where it resides (otherwise it won't find the input files) ****\n" << endl;
+  TEST_EQUALITY(inFile.is_open(), true);
+  while(inFile.good()){
+    
+    getline(inFile, str);
+    
+    if( !(str[0] == '#' || str[0] == '/' || str[0] == '*' || str.size() == 0) ){
+       istringstream iss(str);
+      
+      while ( iss >> num) data.push_back(num);
+
+      TEST_EQUALITY_CONST(static_cast<int>(data.size()), 5);
+
+      mesh.push_back(data[0]);
+      mesh.push_back(data[1]);
+      mesh.push_back(data[2]);
+
+      data.clear();
+
+      
+    }
+  }
+  inFile.close();
+
+  
+  testName = treeType + " test 3)  Equally-Spaced Cube with 27000 points";
+  searchRadius = (1.0/3.0)*3.015;
+
+  PeridigmNS::Timer::self().startTimer(testName);
+  testPerformance( neighborList, searchRadius, mesh, testName, treeType, searchTree, totalBonds, maxBonds, minBonds);
+  TEST_EQUALITY_CONST(totalBonds, static_cast<unsigned int>(2929168));
+  TEST_EQUALITY_CONST(maxBonds, static_cast<unsigned int>(122));
+  TEST_EQUALITY_CONST(minBonds, static_cast<unsigned int>(28));
+  delete searchTree;
+  PeridigmNS::Timer::self().stopTimer(testName);
+
+  // Create a 8000-point discretization and find the neighbors of all the points
+
+  mesh.clear();
+  fileName = "./input_files/cube_8000.txt";
+
+  //! Read a mesh from a text file
+  inFile.open(fileName.c_str());
+  if(!inFile.is_open())
+    cout << "\n**** Warning:  This test can only be run from the directory where it resides (otherwise it won't find the input files) ****\n" << endl;
+  TEST_EQUALITY(inFile.is_open(), true);
+  while(inFile.good()){
+    
+    getline(inFile, str);
+    
+    if( !(str[0] == '#' || str[0] == '/' || str[0] == '*' || str.size() == 0) ){
+       istringstream iss(str);
+      
+      while ( iss >> num) data.push_back(num);
+
+      TEST_EQUALITY_CONST(static_cast<int>(data.size()), 5);
+
+      mesh.push_back(data[0]);
+      mesh.push_back(data[1]);
+      mesh.push_back(data[2]);
+
+      data.clear();
+    }
+  }
+  inFile.close();
+
+  testName = treeType + " test 4)  Equally-Spaced Cube with 8000 points";
+  searchRadius = 0.5*3.015;
+
+  PeridigmNS::Timer::self().startTimer(testName);
+
+  testPerformance( neighborList, searchRadius, mesh, testName, treeType, searchTree, totalBonds, maxBonds, minBonds);
+
+  TEST_EQUALITY_CONST(totalBonds, static_cast<unsigned int>(816728));
+  TEST_EQUALITY_CONST(maxBonds, static_cast<unsigned int>(122));
+  TEST_EQUALITY_CONST(minBonds, static_cast<unsigned int>(28));
+  delete searchTree;
+  PeridigmNS::Timer::self().stopTimer(testName);
+
+  // Create a 1000-point discretization and find the neighbors of all the points
+
+  mesh.clear();
+  fileName = "./input_files/cube_1000.txt";
+
+  //! Read a mesh from a text file
+  inFile.open(fileName.c_str());
+  if(!inFile.is_open())
+    cout << "\n**** Warning:  This test can only be run from the directory where it resides (otherwise it won't find the input files) ****\n" << endl;
+  TEST_EQUALITY(inFile.is_open(), true);
+  while(inFile.good()){
+    
+    getline(inFile, str);
+    
+    if( !(str[0] == '#' || str[0] == '/' || str[0] == '*' || str.size() == 0) ){
+       istringstream iss(str);
+      
+      while ( iss >> num) data.push_back(num);
+
+      TEST_EQUALITY_CONST(static_cast<int>(data.size()), 5);
+
+      mesh.push_back(data[0]);
+      mesh.push_back(data[1]);
+      mesh.push_back(data[2]);
+
+      data.clear();
+    }
+  }
+  inFile.close();
+
+  testName = treeType + " test 5)  Equally-Spaced Cube with 1000 points";
+  searchRadius = 1.0*3.015;
+
+  PeridigmNS::Timer::self().startTimer(testName);
+  testPerformance( neighborList, searchRadius, mesh, testName, treeType, searchTree, totalBonds, maxBonds, minBonds);
+
+  TEST_EQUALITY_CONST(totalBonds, static_cast<unsigned int>(84288));
+  TEST_EQUALITY_CONST(maxBonds, static_cast<unsigned int>(122));
+  TEST_EQUALITY_CONST(minBonds, static_cast<unsigned int>(28));
+  delete searchTree;
+  
+  PeridigmNS::Timer::self().stopTimer(testName);
+
+}
+
 
 
 int main
@@ -113,3 +113,31 @@ PeridigmNS::ElasticBondBasedMaterial::computeForce(const double dt,
 
   MATERIAL_EVALUATION::computeInternalForceElasticBondBased(x,y,cellVolume,bondDamage,force,neighborhoodList,numOwnedPoints,m_bulkModulus,m_horizon);
 }
+
+void
+PeridigmNS::ElasticBondBasedMaterial::computeForceAndDamage(const double dt,
+                                                            const int numOwnedPoints,
+                                                            const int* ownedIDs,
+                                                            const int* neighborhoodList,
+                                                            PeridigmNS::DataManager& dataManager,
+                                                            const InlineDamageCriterion& criterion) const
+{
+  // Zero out the forces
+  dataManager.getData(m_forceDensityFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
+
+  // Extract pointers to the underlying data
+  double *x, *y, *cellVolume, *bondDamageN, *bondDamage, *damage, *force, *damageDeltaTemperature;
+
+  dataManager.getData(m_modelCoordinatesFieldId, PeridigmField::STEP_NONE)->ExtractView(&x);
+  dataManager.getData(m_coordinatesFieldId, PeridigmField::STEP_NP1)->ExtractView(&y);
+  dataManager.getData(m_volumeFieldId, PeridigmField::STEP_NONE)->ExtractView(&cellVolume);
+  dataManager.getData(criterion.bondDamageFieldId, PeridigmField::STEP_N)->ExtractView(&bondDamageN);
+  dataManager.getData(criterion.bondDamageFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondDamage);
+  dataManager.getData(criterion.damageFieldId, PeridigmField::STEP_NP1)->ExtractView(&damage);
+  dataManager.getData(m_forceDensityFieldId, PeridigmField::STEP_NP1)->ExtractView(&force);
+  damageDeltaTemperature = NULL;
+  if(criterion.deltaTemperatureFieldId != -1)
+    dataManager.getData(criterion.deltaTemperatureFieldId, PeridigmField::STEP_NP1)->ExtractView(&damageDeltaTemperature);
+
+  MATERIAL_EVALUATION::computeInternalForceAndDamageElasticBondBased(x,y,cellVolume,bondDamageN,bondDamage,damage,force,neighborhoodList,numOwnedPoints,m_bulkModulus,m_horizon,criterion.criticalStretch,criterion.thermalExpansionCoefficient,damageDeltaTemperature);
+}
@@ -172,6 +172,50 @@ PeridigmNS::ElasticMaterial::computeForce(const double dt,
 #endif
 }
 
+void
+PeridigmNS::ElasticMaterial::computeForceAndDamage(const double dt,
+                                                   const int numOwnedPoints,
+                                                   const int* ownedIDs,
+                                                   const int* neighborhoodList,
+                                                   PeridigmNS::DataManager& dataManager,
+                                                   const InlineDamageCriterion& criterion) const
+{
+  // Zero out the forces
+  dataManager.getData(m_forceDensityFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
+  if(m_computePartialStress)
+    dataManager.getData(m_partialStressFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
+
+  // Extract pointers to the underlying data
+  double *x, *y, *cellVolume, *weightedVolume, *dilatation, *bondDamageN, *bondDamage, *damage, *force, *deltaTemperature, *partialStress, *damageDeltaTemperature;
+
+  dataManager.getData(m_modelCoordinatesFieldId, PeridigmField::STEP_NONE)->ExtractView(&x);
+  dataManager.getData(m_coordinatesFieldId, PeridigmField::STEP_NP1)->ExtractView(&y);
+  dataManager.getData(m_volumeFieldId, PeridigmField::STEP_NONE)->ExtractView(&cellVolume);
+  dataManager.getData(m_weightedVolumeFieldId, PeridigmField::STEP_NONE)->ExtractView(&weightedVolume);
+  dataManager.getData(m_dilatationFieldId, PeridigmField::STEP_NP1)->ExtractView(&dilatation);
+  dataManager.getData(criterion.bondDamageFieldId, PeridigmField::STEP_N)->ExtractView(&bondDamageN);
+  dataManager.getData(criterion.bondDamageFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondDamage);
+  dataManager.getData(criterion.damageFieldId, PeridigmField::STEP_NP1)->ExtractView(&damage);
+  dataManager.getData(m_forceDensityFieldId, PeridigmField::STEP_NP1)->ExtractView(&force);
+  deltaTemperature = NULL;
+  if(m_applyThermalStrains)
+    dataManager.getData(m_deltaTemperatureFieldId, PeridigmField::STEP_NP1)->ExtractView(&deltaTemperature);
+  partialStress = NULL;
+  if(m_computePartialStress)
+    dataManager.getData(m_partialStressFieldId, PeridigmField::STEP_NP1)->ExtractView(&partialStress);
+  damageDeltaTemperature = NULL;
+  if(criterion.deltaTemperatureFieldId != -1)
+    dataManager.getData(criterion.deltaTemperatureFieldId, PeridigmField::STEP_NP1)->ExtractView(&damageDeltaTemperature);
+
+  // The bond damage is updated in the dilatation pass, which is the first loop over the bonds
+  MATERIAL_EVALUATION::computeDilatationAndDamage(x,y,weightedVolume,cellVolume,bondDamageN,bondDamage,dilatation,damage,neighborhoodList,numOwnedPoints,m_horizon,criterion.criticalStretch,m_OMEGA,m_alpha,deltaTemperature,criterion.thermalExpansionCoefficient,damageDeltaTemperature);
+#ifdef PERIDIGM_KOKKOS
+  MATERIAL_EVALUATION::computeInternalForceLinearElasticKokkos(x,y,weightedVolume,cellVolume,dilatation,bondDamage,scf,force,neighborhoodList,numOwnedPoints,m_bulkModulus,m_shearModulus,m_horizon,m_alpha,deltaTemperature);
+#else
+  MATERIAL_EVALUATION::computeInternalForceLinearElastic(x,y,weightedVolume,cellVolume,dilatation,bondDamage,force,partialStress,neighborhoodList,numOwnedPoints,m_bulkModulus,m_shearModulus,m_horizon,m_alpha,deltaTemperature);
+#endif
+}
+
 void
 PeridigmNS::ElasticMaterial::computeStoredElasticEnergyDensity(const double dt,
                                                                const int numOwnedPoints,
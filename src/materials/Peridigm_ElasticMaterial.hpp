@@ -137,6 +137,18 @@ namespace PeridigmNS {
 		 const int* neighborhoodList,
                  PeridigmNS::DataManager& dataManager) const;
 
+    //! Returns true for the critical stretch criterion, which is evaluated inline by computeForceAndDamage().
+    virtual bool supportsInlineDamage(const InlineDamageCriterion& criterion) const { return true; }
+
+    //! Evaluate the critical stretch criterion and the internal force in a single pass over the bonds.
+    virtual void
+    computeForceAndDamage(const double dt,
+                          const int numOwnedPoints,
+                          const int* ownedIDs,
+                          const int* neighborhoodList,
+                          PeridigmNS::DataManager& dataManager,
+                          const InlineDamageCriterion& criterion) const;
+
     //! Compute stored elastic density energy.
     virtual void
     computeStoredElasticEnergyDensity(const double dt,
@@ -53,6 +53,16 @@
 
 using namespace std;
 
+void PeridigmNS::Material::computeForceAndDamage(const double dt,
+                                                 const int numOwnedPoints,
+                                                 const int* ownedIDs,
+                                                 const int* neighborhoodList,
+                                                 PeridigmNS::DataManager& dataManager,
+                                                 const InlineDamageCriterion& criterion) const
+{
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(true, "**** Error:  Material::computeForceAndDamage() is not implemented for material " + Name() + ".\n");
+}
+
 void PeridigmNS::Material::computeJacobian(const double dt,
                                            const int numOwnedPoints,
                                            const int* ownedIDs,
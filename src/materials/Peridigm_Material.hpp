@@ -56,6 +56,7 @@
 #include <string>
 #include <float.h>
 #include "Peridigm_DataManager.hpp"
+#include "Peridigm_DamageModel.hpp"
 #include "Peridigm_SerialMatrix.hpp"
 #include "Peridigm_ScratchMatrix.hpp"
 
@@ -116,6 +117,18 @@ namespace PeridigmNS {
                  const int* neighborhoodList,
                  PeridigmNS::DataManager& dataManager) const = 0;
 
+    //! Returns true if the material can evaluate the given damage criterion within computeForceAndDamage().
+    virtual bool supportsInlineDamage(const InlineDamageCriterion& criterion) const { return false; }
+
+    //! Evaluate the damage criterion and the internal force in a single pass over the bonds, replacing DamageModel::computeDamage() followed by computeForce().
+    virtual void
+    computeForceAndDamage(const double dt,
+                          const int numOwnedPoints,
+                          const int* ownedIDs,
+                          const int* neighborhoodList,
+                          PeridigmNS::DataManager& dataManager,
+                          const InlineDamageCriterion& criterion) const;
+
     /// \enum JacobianType
     /// \brief Whether to compute the full tangent stiffness matrix or just its block diagonal entries
     ///
@@ -146,4 +146,86 @@ template void computeInternalForceElasticBondBased<Sacado::Fad::DFad<double> >
         double horizon
 );
 
+void computeInternalForceAndDamageElasticBondBased
+(
+		const double* xOverlap,
+		const double* yOverlap,
+		const double* volumeOverlap,
+		const double* bondDamageN,
+		double* bondDamageNP1,
+		double* damageOwned,
+		double* fInternalOverlap,
+		const int* localNeighborList,
+		int numOwnedPoints,
+		double BULK_MODULUS,
+        double horizon,
+        double criticalStretch,
+        double damageThermalExpansionCoefficient,
+        const double* damageDeltaTemperature
+)
+{
+  double volume, neighborVolume, X[3], neighborX[3], initialBondLength, damageOnBond, totalDamage;
+  double Y[3], neighborY[3], currentBondLength, stretch, t, fx, fy, fz;
+  int neighborhoodIndex(0), bondDamageIndex(0), neighborId;
+
+  const double pi = boost::math::constants::pi<double>();
+  double constant = 18.0*BULK_MODULUS/(pi*horizon*horizon*horizon*horizon);
+
+  for(int p=0 ; p<numOwnedPoints ; p++){
+
+    X[0] = xOverlap[p*3];
+    X[1] = xOverlap[p*3+1];
+    X[2] = xOverlap[p*3+2];
+    Y[0] = yOverlap[p*3];
+    Y[1] = yOverlap[p*3+1];
+    Y[2] = yOverlap[p*3+2];
+    volume = volumeOverlap[p];
+    totalDamage = 0.0;
+
+    // The thermal strain seen by the breaking criterion is the damage model's, not the material's
+    double criterionThermalStrain = 0.0;
+    if(damageDeltaTemperature)
+      criterionThermalStrain = damageThermalExpansionCoefficient*damageDeltaTemperature[p];
+
+    int numNeighbors = localNeighborList[neighborhoodIndex++];
+	for(int n=0; n<numNeighbors; n++){
+
+      neighborId = localNeighborList[neighborhoodIndex++];
+      neighborX[0] = xOverlap[neighborId*3];
+      neighborX[1] = xOverlap[neighborId*3+1];
+      neighborX[2] = xOverlap[neighborId*3+2];
+      neighborY[0] = yOverlap[neighborId*3];
+      neighborY[1] = yOverlap[neighborId*3+1];
+      neighborY[2] = yOverlap[neighborId*3+2];
+      neighborVolume = volumeOverlap[neighborId];
+
+      initialBondLength = std::sqrt( (neighborX[0]-X[0])*(neighborX[0]-X[0]) + (neighborX[1]-X[1])*(neighborX[1]-X[1]) + (neighborX[2]-X[2])*(neighborX[2]-X[2]) );
+      currentBondLength = std::sqrt( (neighborY[0]-Y[0])*(neighborY[0]-Y[0]) + (neighborY[1]-Y[1])*(neighborY[1]-Y[1]) + (neighborY[2]-Y[2])*(neighborY[2]-Y[2]) );
+      stretch = (currentBondLength - initialBondLength)/initialBondLength;
+
+      // Break the bond if the extension is greater than the critical extension; damage never heals
+      damageOnBond = bondDamageN[bondDamageIndex];
+      if(stretch - criterionThermalStrain > criticalStretch && damageOnBond < 1.0)
+        damageOnBond = 1.0;
+      bondDamageNP1[bondDamageIndex++] = damageOnBond;
+      totalDamage += damageOnBond;
+
+      t = 0.5*(1.0 - damageOnBond)*stretch*constant;
+
+      fx = t * (neighborY[0] - Y[0]) / currentBondLength;
+      fy = t * (neighborY[1] - Y[1]) / currentBondLength;
+      fz = t * (neighborY[2] - Y[2]) / currentBondLength;
+
+      fInternalOverlap[3*p+0] += fx*neighborVolume;
+      fInternalOverlap[3*p+1] += fy*neighborVolume;
+      fInternalOverlap[3*p+2] += fz*neighborVolume;
+      fInternalOverlap[3*neighborId+0] -= fx*volume;
+      fInternalOverlap[3*neighborId+1] -= fy*volume;
+      fInternalOverlap[3*neighborId+2] -= fz*volume;
+    }
+
+    damageOwned[p] = numNeighbors > 0 ? totalDamage/numNeighbors : 0.0;
+  }
+}
+
 }
@@ -64,6 +64,25 @@ void computeInternalForceElasticBondBased
         double horizon
 );
 
+//! Evaluates the critical stretch bond breaking criterion and the internal force in a single pass over the bonds.
+void computeInternalForceAndDamageElasticBondBased
+(
+		const double* xOverlapPtr,
+		const double* yOverlapPtr,
+		const double* volumeOverlapPtr,
+		const double* bondDamageN,
+		double* bondDamageNP1,
+		double* damageOwned,
+		double* fInternalOverlapPtr,
+		const int* localNeighborList,
+		int numOwnedPoints,
+		double BULK_MODULUS,
+        double horizon,
+        double criticalStretch,
+        double damageThermalExpansionCoefficient = 0.0,
+        const double* damageDeltaTemperature = 0
+);
+
 }
 
 #endif // ELASTIC_BOND_BASED_H
@@ -61,24 +61,29 @@ void computeAndStoreInfluenceFunctionValues
  double horizon,
  const FunctionPointer OMEGA
 ){
-  double coord[3], neighborCoord[3], distance, influenceFunctionValue;
+  // The bond lengths for each point are gathered so that user-defined
+  // influence functions can be evaluated in a single batch per point
+  double coord[3], neighborCoord[3];
+  std::vector<double> distances;
   int numNeighbors, neighborIndex, neighborListIndex(0), influenceFunctionIndex(0);
   for(int p=0 ; p<myNumPoints ; p++){
     coord[0] = xOverlap[3*p];
     coord[1] = xOverlap[3*p+1];
     coord[2] = xOverlap[3*p+2];
     numNeighbors = localNeighborList[neighborListIndex++];
+    distances.resize(numNeighbors);
     for(int i=0 ; i<numNeighbors ; i++){
       neighborIndex = localNeighborList[neighborListIndex++];
       neighborCoord[0] = xOverlap[3*neighborIndex];
       neighborCoord[1] = xOverlap[3*neighborIndex+1];
       neighborCoord[2] = xOverlap[3*neighborIndex+2];
-      distance = std::sqrt( (coord[0] - neighborCoord[0])*(coord[0] - neighborCoord[0]) +
-			    (coord[1] - neighborCoord[1])*(coord[1] - neighborCoord[1]) +
-			    (coord[2] - neighborCoord[2])*(coord[2] - neighborCoord[2]) );
-      influenceFunctionValue = OMEGA(distance, horizon);
-      influenceFunctionValues[influenceFunctionIndex++] = influenceFunctionValue;
+      distances[i] = std::sqrt( (coord[0] - neighborCoord[0])*(coord[0] - neighborCoord[0]) +
+				(coord[1] - neighborCoord[1])*(coord[1] - neighborCoord[1]) +
+				(coord[2] - neighborCoord[2])*(coord[2] - neighborCoord[2]) );
     }
+    if(numNeighbors > 0)
+      PeridigmNS::InfluenceFunction::evaluate(OMEGA, numNeighbors, &distances[0], horizon, &influenceFunctionValues[influenceFunctionIndex]);
+    influenceFunctionIndex += numNeighbors;
   }
 }
 
@@ -287,6 +292,79 @@ void computeDilatation
 	}
 }
 
+void computeDilatationAndDamage
+(
+		const double* xOverlap,
+		const double* yOverlap,
+		const double *mOwned,
+		const double* volumeOverlap,
+		const double* bondDamageN,
+		double* bondDamageNP1,
+		double* dilatationOwned,
+		double* damageOwned,
+		const int* localNeighborList,
+		int numOwnedPoints,
+        double horizon,
+        double criticalStretch,
+        const FunctionPointer OMEGA,
+        double thermalExpansionCoefficient,
+        const double* deltaTemperature,
+        double damageThermalExpansionCoefficient,
+        const double* damageDeltaTemperature
+)
+{
+	const double *xOwned = xOverlap;
+	const double *yOwned = yOverlap;
+	const double *deltaT = deltaTemperature;
+	const double *m = mOwned;
+	const double *v = volumeOverlap;
+	double *theta = dilatationOwned;
+	double cellVolume, damageOnBond, totalDamage;
+	const int *neighPtr = localNeighborList;
+	int bondIndex = 0;
+	for(int p=0; p<numOwnedPoints;p++, xOwned+=3, yOwned+=3, deltaT++, m++, theta++){
+		int numNeigh = *neighPtr; neighPtr++;
+		const double *X = xOwned;
+		const double *Y = yOwned;
+		*theta = 0.0;
+		totalDamage = 0.0;
+		// The thermal strain seen by the breaking criterion is the damage model's, not the material's
+		double criterionThermalStrain = 0.0;
+		if(damageDeltaTemperature)
+			criterionThermalStrain = damageThermalExpansionCoefficient*damageDeltaTemperature[p];
+		for(int n=0;n<numNeigh;n++,neighPtr++,bondIndex++){
+			int localId = *neighPtr;
+			cellVolume = v[localId];
+			const double *XP = &xOverlap[3*localId];
+			const double *YP = &yOverlap[3*localId];
+			double X_dx = XP[0]-X[0];
+			double X_dy = XP[1]-X[1];
+			double X_dz = XP[2]-X[2];
+			double zetaSquared = X_dx*X_dx+X_dy*X_dy+X_dz*X_dz;
+			double Y_dx = YP[0]-Y[0];
+			double Y_dy = YP[1]-Y[1];
+			double Y_dz = YP[2]-Y[2];
+			double dY = Y_dx*Y_dx+Y_dy*Y_dy+Y_dz*Y_dz;
+			double d = sqrt(zetaSquared);
+			double currentLength = sqrt(dY);
+
+			// Break the bond if the extension is greater than the critical extension; damage never heals
+			damageOnBond = bondDamageN[bondIndex];
+			if((currentLength - d)/d - criterionThermalStrain > criticalStretch && damageOnBond < 1.0)
+				damageOnBond = 1.0;
+			bondDamageNP1[bondIndex] = damageOnBond;
+			totalDamage += damageOnBond;
+
+			double e = currentLength - d;
+			if(deltaTemperature)
+			  e -= thermalExpansionCoefficient*(*deltaT)*d;
+			double omega = OMEGA(d,horizon);
+			*theta += 3.0*omega*(1.0-damageOnBond)*d*e*cellVolume/(*m);
+		}
+		damageOwned[p] = numNeigh > 0 ? totalDamage/numNeigh : 0.0;
+	}
+}
+
 /** Explicit template instantiation for double. */
 template
 void computeDilatation<double>
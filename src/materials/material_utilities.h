@@ -209,6 +209,28 @@ void computeDilatation
         const double* deltaTemperature = 0
  );
 
+//! Evaluates the critical stretch bond breaking criterion, the point damage, and the dilatation in a single pass over the bonds.
+void computeDilatationAndDamage
+(
+		const double* xOverlap,
+		const double* yOverlap,
+		const double *mOwned,
+		const double* volumeOverlap,
+		const double* bondDamageN,
+		double* bondDamageNP1,
+		double* dilatationOwned,
+		double* damageOwned,
+		const int* localNeighborList,
+		int numOwnedPoints,
+        double horizon,
+        double criticalStretch,
+        const FunctionPointer OMEGA=PeridigmNS::InfluenceFunction::self().getInfluenceFunction(),
+        double thermalExpansionCoefficient = 0,
+        const double* deltaTemperature = 0,
+        double damageThermalExpansionCoefficient = 0,
+        const double* damageDeltaTemperature = 0
+ );
+
 namespace WITH_BOND_VOLUME {
 
 /**
@@ -0,0 +1 @@
+../../PrecrackedPlate/Plate.g
\ No newline at end of file
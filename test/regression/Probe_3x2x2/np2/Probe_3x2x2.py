@@ -0,0 +1,86 @@
+#! /usr/bin/env python
+
+import sys
+import os
+import re
+from subprocess import Popen
+
+test_dir = "Probe_3x2x2/np2"
+base_name = "Probe_3x2x2"
+
+def read_csv(file_name):
+    csv_file = open(file_name)
+    lines = csv_file.readlines()
+    csv_file.close()
+    header = lines[0].strip().split(",")
+    rows = [line.strip().split(",") for line in lines[1:] if line.strip() != ""]
+    return header, rows
+
+def compare_csv(file_name, gold_file_name, logfile):
+    # every value must match the gold file to within an absolute plus relative tolerance
+    abs_tol = 1.0e-14
+    rel_tol = 1.0e-10
+    header, rows = read_csv(file_name)
+    gold_header, gold_rows = read_csv(gold_file_name)
+    if header != gold_header:
+        logfile.write("Column names do not match the gold file:\n  " + ",".join(header) + "\n  " + ",".join(gold_header) + "\n")
+        return 1
+    if len(rows) != len(gold_rows):
+        logfile.write("Found " + str(len(rows)) + " samples, the gold file has " + str(len(gold_rows)) + "\n")
+        return 1
+    result = 0
+    for i in range(len(rows)):
+        if rows[i][0] != gold_rows[i][0]:
+            logfile.write("Sample " + str(i) + ":  step " + rows[i][0] + " should be " + gold_rows[i][0] + "\n")
+            result = 1
+        for j in range(1, len(header)):
+            value = float(rows[i][j])
+            gold_value = float(gold_rows[i][j])
+            if abs(value - gold_value) > abs_tol + rel_tol*abs(gold_value):
+                logfile.write("Step " + rows[i][0] + ", " + header[j] + ":  " + rows[i][j] + " should be " + gold_rows[i][j] + "\n")
+                result = 1
+    return result
+
+if __name__ == "__main__":
+
+    result = 0
+
+    # log file will be dumped if verbose option is given
+    verbose = False
+    if "-verbose" in sys.argv:
+        verbose = True
+
+    # change to the specified test directory
+    os.chdir(test_dir)
+
+    # open log file
+    log_file_name = base_name + ".log"
+    if os.path.exists(log_file_name):
+        os.remove(log_file_name)
+    logfile = open(log_file_name, 'w')
+
+    # remove old output files, if any
+    files_to_remove = base_name + ".csv"
+    for file in os.listdir(os.getcwd()):
+      if file in files_to_remove:
+        os.remove(file)
+
+    # run Peridigm
+    command = ["mpiexec", "-np", "2", "../../../../src/Peridigm", "../"+base_name+".xml"]
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+
+    # compare the probe time history against the gold file
+    logfile.flush()
+    if result == 0:
+        result = compare_csv(base_name+".csv", "../"+base_name+"_gold.csv", logfile)
+
+    logfile.close()
+
+    # dump the output if the user requested verbose
+    if verbose == True:
+        os.system("cat " + log_file_name)
+
+    sys.exit(result)